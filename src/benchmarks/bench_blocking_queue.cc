@@ -0,0 +1,88 @@
+// Пропускная способность и задержка s21::blocking_queue при разном числе
+// производителей и потребителей. Потребители забирают элементы по одному
+// (pop) или пачками (pop_all). Задержка - время от push до извлечения.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_blocking_queue.h"
+#include "bench_utils.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kItems = 200000;
+constexpr std::size_t kCapacity = 1024;
+
+long long NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+void BenchPipeline(int producers, int consumers, bool batch) {
+  s21::blocking_queue<long long> queue(kCapacity);
+  std::vector<std::vector<long long>> latencies(consumers);
+
+  double ms = s21_bench::MeasureMs([&] {
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&queue, producers] {
+        for (std::size_t i = 0; i < kItems / producers; ++i) {
+          queue.push(NowNs());
+        }
+      });
+    }
+    std::vector<std::thread> readers;
+    for (int c = 0; c < consumers; ++c) {
+      readers.emplace_back([&queue, &latencies, c, batch] {
+        auto &lat = latencies[c];
+        lat.reserve(kItems);
+        if (batch) {
+          s21::vector<long long> items;
+          while (queue.pop_all(items, 256) > 0) {
+            long long now = NowNs();
+            for (long long pushed : items) lat.push_back(now - pushed);
+            items.clear();
+          }
+        } else {
+          long long pushed = 0;
+          while (queue.pop(pushed)) lat.push_back(NowNs() - pushed);
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    queue.close();
+    for (auto &thread : readers) thread.join();
+  });
+
+  std::vector<long long> all;
+  for (auto &lat : latencies) all.insert(all.end(), lat.begin(), lat.end());
+  std::sort(all.begin(), all.end());
+  long long p50 = all.empty() ? 0 : all[all.size() / 2];
+  long long p99 = all.empty() ? 0 : all[all.size() * 99 / 100];
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %dP/%dC", batch ? "pop_all" : "pop",
+                producers, consumers);
+  s21_bench::PrintResult(label, all.size(), ms);
+  std::printf("%-40s %.0f items/ms, p50 %lld ns, p99 %lld ns\n", "",
+              all.size() / ms, p50, p99);
+}
+
+}  // namespace
+
+int main() {
+  for (bool batch : {false, true}) {
+    for (int producers : {1, 2, 4}) {
+      for (int consumers : {1, 2, 4}) {
+        BenchPipeline(producers, consumers, batch);
+      }
+    }
+  }
+  return 0;
+}
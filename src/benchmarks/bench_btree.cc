@@ -0,0 +1,153 @@
+// Упорядоченные множества int из 10^4-10^7 ключей: s21::btree_set в
+// сравнении с s21::set и std::set. Меряются вставка ключей в случайном
+// порядке, 10^6 случайных поисков find/lower_bound и полный обход. Для 10^8
+// ключей запускается только btree_set (заполнение по возрастанию): красно-
+// черному дереву на такой размер нужно больше 4 ГБ памяти. В конце
+// btree_map<int, int> сравнивается с std::map на поиске.
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../headers/s21_btree.h"
+#include "../headers/s21_map.h"
+#include "../headers/s21_set.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kLookups = 1000000U;
+
+std::vector<int> ShuffledKeys(std::size_t n) {
+  std::vector<int> keys(n);
+  for (std::size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i * 2U);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+std::vector<int> LookupKeys(std::size_t n) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(n * 2U));
+  std::vector<int> keys(kLookups);
+  for (int &key : keys) key = dist(gen);
+  return keys;
+}
+
+// s21::set не предоставляет lower_bound, для него этот замер пропускается
+template <typename Set, typename = void>
+struct HasLowerBound : std::false_type {};
+
+template <typename Set>
+struct HasLowerBound<Set, std::void_t<decltype(std::declval<const Set &>()
+                                                   .lower_bound(0))>>
+    : std::true_type {};
+
+template <typename Set>
+void BenchLowerBound(const char *prefix, const Set &set,
+                     const std::vector<int> &lookups) {
+  char label[64];
+  double ms = s21_bench::MeasureMs([&] {
+    long long sum = 0;
+    for (int key : lookups) {
+      auto it = set.lower_bound(key);
+      if (it != set.end()) sum += *it;
+    }
+    s21_bench::g_sink = sum;
+  });
+  std::snprintf(label, sizeof(label), "%s lower_bound x1e6", prefix);
+  s21_bench::PrintResult(label, set.size(), ms);
+}
+
+template <typename Set>
+void BenchLookupIterate(const char *prefix, const Set &set,
+                        const std::vector<int> &lookups) {
+  char label[64];
+  std::size_t n = set.size();
+  double ms = s21_bench::MeasureMs([&] {
+    long long found = 0;
+    for (int key : lookups) found += set.find(key) != set.end();
+    s21_bench::g_sink = found;
+  });
+  std::snprintf(label, sizeof(label), "%s find x1e6", prefix);
+  s21_bench::PrintResult(label, n, ms);
+
+  if constexpr (HasLowerBound<Set>::value) {
+    BenchLowerBound(prefix, set, lookups);
+  }
+
+  ms = s21_bench::MeasureMs([&] {
+    long long sum = 0;
+    for (int key : set) sum += key;
+    s21_bench::g_sink = sum;
+  });
+  std::snprintf(label, sizeof(label), "%s iterate", prefix);
+  s21_bench::PrintResult(label, n, ms);
+}
+
+template <typename Set>
+void BenchSet(const char *prefix, const std::vector<int> &keys,
+              const std::vector<int> &lookups) {
+  char label[64];
+  Set set;
+  double ms = s21_bench::MeasureMs([&] {
+    for (int key : keys) set.insert(key);
+  });
+  std::snprintf(label, sizeof(label), "%s insert random", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+  BenchLookupIterate(prefix, set, lookups);
+}
+
+void BenchHugeBTree(std::size_t n) {
+  s21::btree_set<int> set;
+  double ms = s21_bench::MeasureMs([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      set.insert(set.end(), static_cast<int>(i * 2U));
+    }
+  });
+  s21_bench::PrintResult("s21::btree_set insert sorted", n, ms);
+  BenchLookupIterate("s21::btree_set", set, LookupKeys(n));
+}
+
+template <typename Map>
+void BenchMapLookup(const char *prefix, const std::vector<int> &keys,
+                    const std::vector<int> &lookups) {
+  char label[64];
+  Map map;
+  for (int key : keys) map.insert({key, key});
+  double ms = s21_bench::MeasureMs([&] {
+    long long sum = 0;
+    for (int key : lookups) {
+      auto it = map.find(key);
+      if (it != map.end()) sum += (*it).second;
+    }
+    s21_bench::g_sink = sum;
+  });
+  std::snprintf(label, sizeof(label), "%s find x1e6", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {10000U, 100000U, 1000000U, 10000000U}) {
+    std::vector<int> keys = ShuffledKeys(n);
+    std::vector<int> lookups = LookupKeys(n);
+    BenchSet<s21::btree_set<int>>("s21::btree_set", keys, lookups);
+    BenchSet<s21::set<int>>("s21::set", keys, lookups);
+    BenchSet<std::set<int>>("std::set", keys, lookups);
+  }
+  BenchHugeBTree(100000000U);
+  for (std::size_t n : {100000U, 1000000U}) {
+    std::vector<int> keys = ShuffledKeys(n);
+    std::vector<int> lookups = LookupKeys(n);
+    BenchMapLookup<s21::btree_map<int, int>>("s21::btree_map", keys, lookups);
+    BenchMapLookup<s21::map<int, int>>("s21::map", keys, lookups);
+    BenchMapLookup<std::map<int, int>>("std::map", keys, lookups);
+  }
+  return 0;
+}
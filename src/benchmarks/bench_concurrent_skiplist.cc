@@ -0,0 +1,99 @@
+// Масштабирование s21::concurrent_skiplist_map по числу потоков в сравнении
+// с s21::map под одним глобальным мьютексом. Каждый поток выполняет
+// одинаковое число операций со смесью чтений (find) и записей (insert/erase
+// поровну), поэтому при идеальном масштабировании время не растет с числом
+// потоков.
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_concurrent_skiplist.h"
+#include "../headers/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr int kKeyRange = 1 << 16;
+constexpr std::size_t kOpsPerThread = 50000;
+
+// Обертка над s21::map с глобальной блокировкой - текущий вариант индекса
+struct LockedMap {
+  bool Find(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return map.contains(key);
+  }
+  void Insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.insert(key, key);
+  }
+  void Erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // У s21::map нет find(), итератор на существующий ключ возвращает insert
+    if (map.contains(key)) {
+      map.erase(map.insert(key, key).first);
+    }
+  }
+
+  std::mutex mutex;
+  s21::map<int, int> map;
+};
+
+struct SkipListMap {
+  bool Find(int key) { return map.contains(key); }
+  void Insert(int key) { map.insert(key, key); }
+  void Erase(int key) { map.erase(key); }
+
+  s21::concurrent_skiplist_map<int, int> map;
+};
+
+template <typename Index>
+void BenchMix(const char *name, int threads, int write_percent) {
+  Index index;
+  for (int key = 0; key < kKeyRange; key += 2) {
+    index.Insert(key);
+  }
+  double ms = s21_bench::MeasureMs([&index, threads, write_percent] {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.emplace_back([&index, t, write_percent] {
+        std::uint32_t state = 2654435761U * static_cast<std::uint32_t>(t + 1);
+        long long hits = 0;
+        for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+          state ^= state << 13;
+          state ^= state >> 17;
+          state ^= state << 5;
+          int key = static_cast<int>(state % kKeyRange);
+          int op = static_cast<int>((state >> 16) % 100);
+          if (op >= write_percent) {
+            hits += index.Find(key);
+          } else if (op % 2) {
+            index.Insert(key);
+          } else {
+            index.Erase(key);
+          }
+        }
+        s21_bench::g_sink = hits;
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %d%% writes, %2d threads", name,
+                write_percent, threads);
+  s21_bench::PrintResult(label, kOpsPerThread * threads, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (int write_percent : {10, 50}) {
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+      BenchMix<LockedMap>("s21::map+mutex", threads, write_percent);
+      BenchMix<SkipListMap>("skiplist_map", threads, write_percent);
+    }
+  }
+  return 0;
+}
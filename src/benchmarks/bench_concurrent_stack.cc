@@ -0,0 +1,75 @@
+// Общий список свободных буферов: каждый поток попеременно берет буфер
+// (pop) и возвращает его (push). s21::concurrent_stack в сравнении с
+// s21::stack под мьютексом при росте числа потоков.
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_concurrent_stack.h"
+#include "../headers/s21_stack.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kOps = 1 << 20;
+constexpr int kBuffers = 256;
+
+class LockedStack {
+ public:
+  void push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(long long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<long long> stack_;
+};
+
+template <typename Stack>
+void BenchFreeList(const char *name, std::size_t threads) {
+  Stack stack;
+  for (int i = 0; i < kBuffers; ++i) stack.push(i);
+  std::size_t per_thread = kOps / threads;
+  double ms = s21_bench::MeasureMs([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&stack, per_thread] {
+        long long buffer = 0;
+        long long sum = 0;
+        for (std::size_t i = 0; i < per_thread; ++i) {
+          if (stack.try_pop(buffer)) {
+            sum += buffer;
+            stack.push(buffer);
+          }
+        }
+        s21_bench::g_sink = sum;
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %zu threads", name, threads);
+  s21_bench::PrintResult(label, per_thread * threads, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t threads : {1U, 2U, 4U, 8U, 16U}) {
+    BenchFreeList<s21::concurrent_stack<long long>>("concurrent_stack",
+                                                    threads);
+    BenchFreeList<LockedStack>("s21::stack + mutex", threads);
+  }
+  return 0;
+}
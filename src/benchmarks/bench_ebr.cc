@@ -0,0 +1,66 @@
+// Накладные расходы s21::ebr: вход и выход из критической секции в
+// сравнении с общим счетчиком активных операций (прежняя схема
+// s21::concurrent_skiplist) и мьютексом, а также retire() в сравнении с
+// немедленным delete. Каждый поток выполняет одинаковое число операций.
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_ebr.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kOps = 1 << 20;
+
+template <typename F>
+void BenchThreads(const char *name, std::size_t threads, F op) {
+  double ms = s21_bench::MeasureMs([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&op] {
+        for (std::size_t i = 0; i < kOps; ++i) op(i);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %zu threads", name, threads);
+  s21_bench::PrintResult(label, kOps * threads, ms);
+}
+
+}  // namespace
+
+int main() {
+  std::atomic<std::size_t> active(0);
+  std::mutex mutex;
+  for (std::size_t threads : {1U, 2U, 4U, 8U}) {
+    BenchThreads("ebr::guard", threads, [](std::size_t i) {
+      s21::ebr::guard guard;
+      s21_bench::g_sink = static_cast<long long>(i);
+    });
+    BenchThreads("shared counter", threads, [&active](std::size_t i) {
+      active.fetch_add(1U, std::memory_order_acq_rel);
+      s21_bench::g_sink = static_cast<long long>(i);
+      active.fetch_sub(1U, std::memory_order_acq_rel);
+    });
+    BenchThreads("std::mutex", threads, [&mutex](std::size_t i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      s21_bench::g_sink = static_cast<long long>(i);
+    });
+    BenchThreads("new + ebr::retire", threads, [](std::size_t i) {
+      s21::ebr::guard guard;
+      s21::ebr::retire(new long long(static_cast<long long>(i)));
+    });
+    BenchThreads("new + delete", threads, [](std::size_t i) {
+      auto *value = new long long(static_cast<long long>(i));
+      // Адрес в приемник, чтобы компилятор не убрал пару new/delete
+      s21_bench::g_sink = reinterpret_cast<long long>(value);
+      delete value;
+    });
+  }
+  return 0;
+}
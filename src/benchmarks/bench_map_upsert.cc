@@ -0,0 +1,56 @@
+// "Найти или вставить" в словаре: operator[], insert_or_assign и
+// try_emplace s21::map в сравнении с std::map. Половина ключей повторяется,
+// поэтому измеряются и попадания, и промахи.
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../headers/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kSize = 200000;
+
+template <typename Map>
+void BenchUpsert(const char *prefix, const std::vector<int> &keys) {
+  char label[64];
+  double ms = s21_bench::MeasureMs([&keys] {
+    Map map;
+    for (int key : keys) ++map[key];
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "%s operator[]", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+
+  ms = s21_bench::MeasureMs([&keys] {
+    Map map;
+    for (int key : keys) map.insert_or_assign(key, key);
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "%s insert_or_assign", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+
+  ms = s21_bench::MeasureMs([&keys] {
+    Map map;
+    for (int key : keys) map.try_emplace(key, key);
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "%s try_emplace", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 gen(42);
+  std::vector<int> keys(kSize);
+  for (auto &key : keys) {
+    key = static_cast<int>(gen() % (kSize / 2));
+  }
+  BenchUpsert<s21::map<int, int>>("s21::map", keys);
+  BenchUpsert<std::map<int, int>>("std::map", keys);
+  return 0;
+}
@@ -0,0 +1,84 @@
+// s21::mpmc_queue в сравнении с s21::queue под мьютексом при росте числа
+// потоков: N производителей и N потребителей (от 2 до 32 потоков всего)
+// передают фиксированное число элементов.
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_mpmc_queue.h"
+#include "../headers/s21_queue.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kItems = 1 << 20;
+constexpr std::size_t kCapacity = 1024;
+
+// Ограниченная s21::queue под мьютексом с тем же интерфейсом
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(long long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::size_t capacity_;
+  std::mutex mutex_;
+  s21::queue<long long> queue_;
+};
+
+template <typename Queue>
+void BenchContention(const char *name, std::size_t pairs) {
+  Queue queue(kCapacity);
+  std::size_t per_thread = kItems / pairs;
+  double ms = s21_bench::MeasureMs([&] {
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < pairs; ++p) {
+      threads.emplace_back([&queue, per_thread] {
+        for (std::size_t i = 0; i < per_thread; ++i) {
+          while (!queue.try_push(static_cast<long long>(i))) {
+            std::this_thread::yield();
+          }
+        }
+      });
+      threads.emplace_back([&queue, per_thread] {
+        long long value = 0;
+        long long sum = 0;
+        for (std::size_t i = 0; i < per_thread; ++i) {
+          while (!queue.try_pop(value)) std::this_thread::yield();
+          sum += value;
+        }
+        s21_bench::g_sink = sum;
+      });
+    }
+    for (auto &thread : threads) thread.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s %zuP/%zuC", name, pairs, pairs);
+  s21_bench::PrintResult(label, per_thread * pairs, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t pairs : {1U, 2U, 4U, 8U, 16U}) {
+    BenchContention<s21::mpmc_queue<long long>>("mpmc_queue", pairs);
+    BenchContention<LockedQueue>("s21::queue + mutex", pairs);
+  }
+  return 0;
+}
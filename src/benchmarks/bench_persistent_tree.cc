@@ -0,0 +1,107 @@
+// Снимки словаря int -> int из 10^4-10^6 элементов: s21::persistent_map::
+// snapshot() в сравнении с копией s21::map. Затем 10^5 вставок и удалений
+// случайных ключей в persistent_map без снимков, со снимком перед каждой
+// записью (копируется путь) и в s21::map, и 10^6 случайных поисков.
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../headers/s21_map.h"
+#include "../headers/s21_persistent_tree.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kWrites = 100000U;
+constexpr std::size_t kLookups = 1000000U;
+
+std::vector<int> RandomKeys(std::size_t count, std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(n * 2U));
+  std::vector<int> keys(count);
+  for (int &key : keys) key = dist(gen);
+  return keys;
+}
+
+template <typename Map>
+Map MakeMap(std::size_t n) {
+  Map map;
+  for (int key : RandomKeys(n, n, 1U)) map.insert({key, key});
+  return map;
+}
+
+void BenchSnapshot(std::size_t n) {
+  auto map = MakeMap<s21::map<int, int>>(n);
+  double ms = s21_bench::MeasureMs([&] {
+    s21::map<int, int> copy(map);
+    s21_bench::g_sink = static_cast<long long>(copy.size());
+  });
+  s21_bench::PrintResult("s21::map copy", n, ms);
+
+  auto persistent = MakeMap<s21::persistent_map<int, int>>(n);
+  ms = s21_bench::MeasureMs([&] {
+    auto snapshot = persistent.snapshot();
+    s21_bench::g_sink = static_cast<long long>(snapshot.size());
+  });
+  s21_bench::PrintResult("s21::persistent_map snapshot", n, ms);
+}
+
+// У s21::map нет erase() по ключу
+void EraseKey(s21::map<int, int> &map, int key) {
+  auto it = map.find(key);
+  if (it != map.end()) map.erase(it);
+}
+
+void EraseKey(s21::persistent_map<int, int> &map, int key) { map.erase(key); }
+
+// Половина записей - insert_or_assign, половина - erase
+template <typename Map, typename BeforeWrite>
+void BenchWrites(const char *name, std::size_t n, BeforeWrite before_write) {
+  auto map = MakeMap<Map>(n);
+  std::vector<int> keys = RandomKeys(kWrites, n, 2U);
+  double ms = s21_bench::MeasureMs([&] {
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      before_write(map);
+      if (i % 2 == 0) {
+        map.insert_or_assign(keys[i], keys[i]);
+      } else {
+        EraseKey(map, keys[i]);
+      }
+    }
+  });
+  s21_bench::PrintResult(name, n, ms);
+}
+
+template <typename Map>
+void BenchLookup(const char *name, std::size_t n) {
+  auto map = MakeMap<Map>(n);
+  std::vector<int> keys = RandomKeys(kLookups, n, 3U);
+  double ms = s21_bench::MeasureMs([&] {
+    long long found = 0;
+    for (int key : keys) found += map.find(key) != map.end();
+    s21_bench::g_sink = found;
+  });
+  s21_bench::PrintResult(name, n, ms);
+}
+
+}  // namespace
+
+int main() {
+  using PersistentMap = s21::persistent_map<int, int>;
+  for (std::size_t n : {10000U, 100000U, 1000000U}) {
+    BenchSnapshot(n);
+    BenchWrites<s21::map<int, int>>("s21::map write x1e5", n,
+                                    [](s21::map<int, int> &) {});
+    BenchWrites<PersistentMap>("s21::persistent_map write x1e5", n,
+                               [](PersistentMap &) {});
+    PersistentMap snapshot;
+    BenchWrites<PersistentMap>(
+        "s21::persistent_map snapshot+write x1e5", n,
+        [&snapshot](PersistentMap &map) { snapshot = map.snapshot(); });
+    BenchLookup<s21::map<int, int>>("s21::map find x1e6", n);
+    BenchLookup<PersistentMap>("s21::persistent_map find x1e6", n);
+  }
+  return 0;
+}
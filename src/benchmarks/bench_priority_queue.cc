@@ -0,0 +1,108 @@
+// s21::priority_queue (2- и 4-арная куча) и s21::indexed_priority_queue в
+// сравнении с s21::multiset, который использовался как очередь с
+// приоритетом: вставка + извлечение минимума и уменьшение ключа.
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../headers/s21_multiset.h"
+#include "../headers/s21_priority_queue.h"
+#include "bench_utils.h"
+
+namespace {
+
+std::vector<int> RandomValues(std::size_t n) {
+  std::vector<int> values(n);
+  std::uint32_t state = 2463534242U;
+  for (auto &value : values) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    value = static_cast<int>(state % 1000000);
+  }
+  return values;
+}
+
+// n вставок, затем n извлечений минимума
+template <typename Queue>
+void BenchPushPop(const char *name, const std::vector<int> &values) {
+  double ms = s21_bench::MeasureMs([&values] {
+    Queue pq;
+    for (int value : values) pq.push(value);
+    long long sum = 0;
+    while (!pq.empty()) {
+      sum += pq.top();
+      pq.pop();
+    }
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult(name, values.size(), ms);
+}
+
+void BenchMultisetPushPop(const std::vector<int> &values) {
+  double ms = s21_bench::MeasureMs([&values] {
+    s21::multiset<int> ms;
+    for (int value : values) ms.insert(value);
+    long long sum = 0;
+    while (!ms.empty()) {
+      sum += *ms.begin();
+      ms.erase(ms.begin());
+    }
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult("push+pop: s21::multiset", values.size(), ms);
+}
+
+// n элементов, затем n уменьшений ключа случайных элементов, как в
+// алгоритме Дейкстры
+void BenchIndexedDecreaseKey(const std::vector<int> &values) {
+  double ms = s21_bench::MeasureMs([&values] {
+    s21::indexed_priority_queue<int, std::greater<int>> pq;
+    std::vector<std::size_t> handles;
+    std::vector<int> keys = values;
+    for (int value : values) handles.push_back(pq.push(value));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      std::size_t victim = values[i] % values.size();
+      keys[victim] -= keys[victim] / 2 + 1;
+      pq.decrease_key(handles[victim], keys[victim]);
+    }
+    s21_bench::g_sink = pq.top();
+  });
+  s21_bench::PrintResult("decrease_key: indexed_priority_queue",
+                         values.size(), ms);
+}
+
+void BenchMultisetDecreaseKey(const std::vector<int> &values) {
+  double ms = s21_bench::MeasureMs([&values] {
+    s21::multiset<int> ms;
+    std::vector<int> keys = values;
+    for (int value : values) ms.insert(value);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      std::size_t victim = values[i] % values.size();
+      ms.erase(ms.find(keys[victim]));
+      keys[victim] -= keys[victim] / 2 + 1;
+      ms.insert(keys[victim]);
+    }
+    s21_bench::g_sink = *ms.begin();
+  });
+  s21_bench::PrintResult("decrease_key: s21::multiset", values.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {10000U, 100000U, 1000000U}) {
+    std::vector<int> values = RandomValues(n);
+    BenchPushPop<s21::priority_queue<int, s21::vector<int>, std::greater<int>,
+                                     2>>("push+pop: priority_queue d=2",
+                                         values);
+    BenchPushPop<s21::priority_queue<int, s21::vector<int>, std::greater<int>,
+                                     4>>("push+pop: priority_queue d=4",
+                                         values);
+    BenchMultisetPushPop(values);
+    BenchIndexedDecreaseKey(values);
+    BenchMultisetDecreaseKey(values);
+  }
+  return 0;
+}
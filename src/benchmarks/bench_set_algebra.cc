@@ -0,0 +1,156 @@
+// Операции над множествами через split/join: s21::set::merge(),
+// intersect() и subtract() для множеств из 10^6 и 10^2-10^6 случайных
+// ключей, а также merge() множеств с непересекающимися диапазонами ключей.
+// Для сравнения - вставка элементов по одному, std::set::merge() и
+// std::set_intersection()/std::set_difference() с записью результата в новый
+// std::set. Параллельные версии запускаются на s21::ws_scheduler со всеми
+// ядрами.
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../headers/s21_set.h"
+#include "../headers/s21_ws_scheduler.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kLarge = 1000000U;
+
+std::vector<int> RandomKeys(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, static_cast<int>(kLarge * 4U));
+  std::vector<int> keys(n);
+  for (int &key : keys) key = dist(gen);
+  return keys;
+}
+
+template <typename Set>
+Set MakeSet(const std::vector<int> &keys) {
+  return Set(keys.begin(), keys.end());
+}
+
+template <typename F>
+void Report(const char *name, std::size_t m, F &&fn) {
+  s21_bench::PrintResult(name, m, s21_bench::MeasureMs(fn));
+}
+
+void BenchMerge(const std::vector<int> &large, const std::vector<int> &small,
+                s21::ws_scheduler &scheduler) {
+  std::size_t m = small.size();
+  {
+    auto a = MakeSet<s21::set<int>>(large);
+    auto b = MakeSet<s21::set<int>>(small);
+    Report("s21::set merge", m, [&] { a.merge(b); });
+  }
+  {
+    auto a = MakeSet<s21::set<int>>(large);
+    auto b = MakeSet<s21::set<int>>(small);
+    Report("s21::set merge (parallel)", m, [&] { a.merge(b, scheduler); });
+  }
+  {
+    auto a = MakeSet<s21::set<int>>(large);
+    auto b = MakeSet<s21::set<int>>(small);
+    Report("s21::set insert one by one", m, [&] {
+      for (int key : b) a.insert(key);
+    });
+  }
+  {
+    auto a = MakeSet<std::set<int>>(large);
+    auto b = MakeSet<std::set<int>>(small);
+    Report("std::set merge", m, [&] { a.merge(b); });
+  }
+}
+
+void BenchIntersect(const std::vector<int> &large,
+                    const std::vector<int> &small,
+                    s21::ws_scheduler &scheduler) {
+  std::size_t m = small.size();
+  {
+    auto a = MakeSet<s21::set<int>>(small);
+    auto b = MakeSet<s21::set<int>>(large);
+    Report("s21::set intersect", m, [&] { a.intersect(b); });
+    s21_bench::g_sink = static_cast<long long>(a.size());
+  }
+  {
+    auto a = MakeSet<s21::set<int>>(small);
+    auto b = MakeSet<s21::set<int>>(large);
+    Report("s21::set intersect (parallel)", m,
+           [&] { a.intersect(b, scheduler); });
+    s21_bench::g_sink = static_cast<long long>(a.size());
+  }
+  {
+    auto a = MakeSet<std::set<int>>(small);
+    auto b = MakeSet<std::set<int>>(large);
+    Report("std::set_intersection", m, [&] {
+      std::set<int> result;
+      std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                            std::inserter(result, result.end()));
+      s21_bench::g_sink = static_cast<long long>(result.size());
+    });
+  }
+}
+
+void BenchSubtract(const std::vector<int> &large,
+                   const std::vector<int> &small,
+                   s21::ws_scheduler &scheduler) {
+  std::size_t m = small.size();
+  {
+    auto a = MakeSet<s21::set<int>>(large);
+    auto b = MakeSet<s21::set<int>>(small);
+    Report("s21::set subtract", m, [&] { a.subtract(b); });
+  }
+  {
+    auto a = MakeSet<s21::set<int>>(large);
+    auto b = MakeSet<s21::set<int>>(small);
+    Report("s21::set subtract (parallel)", m,
+           [&] { a.subtract(b, scheduler); });
+  }
+  {
+    auto a = MakeSet<std::set<int>>(large);
+    auto b = MakeSet<std::set<int>>(small);
+    Report("std::set_difference", m, [&] {
+      std::set<int> result;
+      std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                          std::inserter(result, result.end()));
+      s21_bench::g_sink = static_cast<long long>(result.size());
+    });
+  }
+}
+
+// Ключи other больше всех ключей дерева: split/join сливает их за O(log n)
+void BenchDisjointMerge(std::size_t m) {
+  std::vector<int> low(kLarge);
+  std::vector<int> high(m);
+  for (std::size_t i = 0; i < kLarge; ++i) low[i] = static_cast<int>(i);
+  for (std::size_t i = 0; i < m; ++i) high[i] = static_cast<int>(kLarge + i);
+  {
+    auto a = MakeSet<s21::set<int>>(low);
+    auto b = MakeSet<s21::set<int>>(high);
+    Report("s21::set merge (disjoint)", m, [&] { a.merge(b); });
+  }
+  {
+    auto a = MakeSet<std::set<int>>(low);
+    auto b = MakeSet<std::set<int>>(high);
+    Report("std::set merge (disjoint)", m, [&] { a.merge(b); });
+  }
+}
+
+}  // namespace
+
+int main() {
+  s21::ws_scheduler scheduler;
+  std::vector<int> large = RandomKeys(kLarge, 1U);
+  for (std::size_t m : {100U, 10000U, 1000000U}) {
+    std::vector<int> small = RandomKeys(m, 2U);
+    BenchMerge(large, small, scheduler);
+    BenchIntersect(large, small, scheduler);
+    BenchSubtract(large, small, scheduler);
+  }
+  BenchDisjointMerge(1000000U);
+  return 0;
+}
@@ -0,0 +1,138 @@
+// Масштабирование s21::sharded_map по числу потоков при смеси 90% чтений
+// (find) и 10% записей (insert_or_assign/erase поровну) в сравнении с
+// s21::map под одним глобальным мьютексом и s21::concurrent_skiplist_map.
+// sharded_map с одним сегментом показывает вклад одной только блокировки
+// чтения-записи. Каждый поток выполняет одинаковое число операций, поэтому
+// при идеальном масштабировании время не растет с числом потоков. В конце
+// упорядоченный обход (k-путевое слияние сегментов) сравнивается с обходом
+// одного s21::map.
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_concurrent_skiplist.h"
+#include "../headers/s21_map.h"
+#include "../headers/s21_sharded_map.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr int kKeyRange = 1 << 16;
+constexpr std::size_t kOpsPerThread = 200000;
+constexpr int kWritePercent = 10;
+
+// Текущий вариант: s21::map под глобальным мьютексом
+struct LockedMap {
+  bool Find(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return map.contains(key);
+  }
+  void Insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.insert_or_assign(key, key);
+  }
+  void Erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = map.find(key);
+    if (it != map.end()) map.erase(it);
+  }
+
+  std::mutex mutex;
+  s21::map<int, int> map;
+};
+
+template <std::size_t Shards>
+struct ShardedMap {
+  bool Find(int key) {
+    int value = 0;
+    return map.find(key, value);
+  }
+  void Insert(int key) { map.insert_or_assign(key, key); }
+  void Erase(int key) { map.erase(key); }
+
+  s21::sharded_map<int, int, Shards> map;
+};
+
+struct SkipListMap {
+  bool Find(int key) { return map.contains(key); }
+  void Insert(int key) { map.insert(key, key); }
+  void Erase(int key) { map.erase(key); }
+
+  s21::concurrent_skiplist_map<int, int> map;
+};
+
+template <typename Index>
+void BenchMix(const char *name, int threads) {
+  Index index;
+  for (int key = 0; key < kKeyRange; key += 2) {
+    index.Insert(key);
+  }
+  double ms = s21_bench::MeasureMs([&index, threads] {
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+      workers.emplace_back([&index, t] {
+        std::uint32_t state = 2654435761U * static_cast<std::uint32_t>(t + 1);
+        long long hits = 0;
+        for (std::size_t i = 0; i < kOpsPerThread; ++i) {
+          state ^= state << 13;
+          state ^= state >> 17;
+          state ^= state << 5;
+          int key = static_cast<int>(state % kKeyRange);
+          int op = static_cast<int>((state >> 16) % 100);
+          if (op >= kWritePercent) {
+            hits += index.Find(key);
+          } else if (op % 2) {
+            index.Insert(key);
+          } else {
+            index.Erase(key);
+          }
+        }
+        s21_bench::g_sink = hits;
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %2d threads", name, threads);
+  s21_bench::PrintResult(label, kOpsPerThread * threads, ms);
+}
+
+void BenchOrderedIteration(std::size_t n) {
+  s21::map<int, int> map;
+  s21::sharded_map<int, int, 16> sharded;
+  for (std::size_t i = 0; i < n; ++i) {
+    int key = static_cast<int>(i * 2654435761U % (n * 4));
+    map.insert_or_assign(key, key);
+    sharded.insert_or_assign(key, key);
+  }
+  double ms = s21_bench::MeasureMs([&map] {
+    long long sum = 0;
+    for (const auto &item : map) sum += item.second;
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult("s21::map iterate", map.size(), ms);
+  ms = s21_bench::MeasureMs([&sharded] {
+    long long sum = 0;
+    sharded.for_each_ordered(
+        [&sum](const std::pair<const int, int> &item) { sum += item.second; });
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult("sharded_map<16> for_each_ordered", map.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  for (int threads : {1, 2, 4, 8, 16}) {
+    BenchMix<LockedMap>("s21::map+mutex", threads);
+    BenchMix<ShardedMap<1>>("sharded_map<1>", threads);
+    BenchMix<ShardedMap<16>>("sharded_map<16>", threads);
+    BenchMix<ShardedMap<64>>("sharded_map<64>", threads);
+    BenchMix<SkipListMap>("skiplist_map", threads);
+  }
+  BenchOrderedIteration(1000000U);
+  return 0;
+}
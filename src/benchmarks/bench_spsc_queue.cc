@@ -0,0 +1,154 @@
+// Передача элементов от одного потока другому: s21::spsc_queue (по одному и
+// пачками) в сравнении с s21::queue под мьютексом и s21::blocking_queue.
+// Печатается пропускная способность и задержка (время от вставки до
+// извлечения, p50/p99).
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_blocking_queue.h"
+#include "../headers/s21_queue.h"
+#include "../headers/s21_spsc_queue.h"
+#include "bench_utils.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kItems = 2000000;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 64;
+
+long long NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+// Очередь s21::queue под мьютексом, как было у ingest-потока
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(long long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::size_t capacity_;
+  std::mutex mutex_;
+  s21::queue<long long> queue_;
+};
+
+void Report(const char *name, std::vector<long long> &lat, double ms) {
+  std::sort(lat.begin(), lat.end());
+  long long p50 = lat.empty() ? 0 : lat[lat.size() / 2];
+  long long p99 = lat.empty() ? 0 : lat[lat.size() * 99 / 100];
+  s21_bench::PrintResult(name, kItems, ms);
+  std::printf("%-40s %.1f Mops/s, p50 %lld ns, p99 %lld ns\n", "",
+              kItems / ms / 1000.0, p50, p99);
+}
+
+// Каждый элемент - время вставки. Задержка измеряется у каждого 64-го
+// элемента, чтобы вызовы часов не доминировали в пропускной способности.
+template <typename Queue>
+void BenchSingle(const char *name) {
+  Queue queue(kCapacity);
+  std::vector<long long> lat;
+  lat.reserve(kItems / 64 + 1);
+  double ms = s21_bench::MeasureMs([&] {
+    std::thread producer([&queue] {
+      for (std::size_t i = 0; i < kItems; ++i) {
+        long long stamp = i % 64 == 0 ? NowNs() : 0;
+        while (!queue.try_push(stamp)) std::this_thread::yield();
+      }
+    });
+    long long stamp = 0;
+    for (std::size_t i = 0; i < kItems; ++i) {
+      while (!queue.try_pop(stamp)) std::this_thread::yield();
+      if (stamp != 0) lat.push_back(NowNs() - stamp);
+    }
+    producer.join();
+  });
+  Report(name, lat, ms);
+}
+
+void BenchSpscBulk() {
+  s21::spsc_queue<long long> queue(kCapacity);
+  std::vector<long long> lat;
+  lat.reserve(kItems / 64 + 1);
+  double ms = s21_bench::MeasureMs([&] {
+    std::thread producer([&queue] {
+      long long batch[kBatch];
+      for (std::size_t i = 0; i < kItems; i += kBatch) {
+        batch[0] = NowNs();
+        for (std::size_t j = 1; j < kBatch; ++j) batch[j] = 0;
+        std::size_t sent = 0;
+        while (sent < kBatch) {
+          sent += queue.try_push_bulk(batch + sent, kBatch - sent);
+          if (sent < kBatch) std::this_thread::yield();
+        }
+      }
+    });
+    long long batch[kBatch];
+    for (std::size_t received = 0; received < kItems;) {
+      std::size_t count = queue.try_pop_bulk(batch, kBatch);
+      if (count == 0U) {
+        std::this_thread::yield();
+        continue;
+      }
+      long long now = NowNs();
+      for (std::size_t j = 0; j < count; ++j) {
+        if (batch[j] != 0) lat.push_back(now - batch[j]);
+      }
+      received += count;
+    }
+    producer.join();
+  });
+  Report("spsc_queue bulk", lat, ms);
+}
+
+void BenchBlocking() {
+  s21::blocking_queue<long long> queue(kCapacity);
+  std::vector<long long> lat;
+  lat.reserve(kItems / 64 + 1);
+  double ms = s21_bench::MeasureMs([&] {
+    std::thread producer([&queue] {
+      for (std::size_t i = 0; i < kItems; ++i) {
+        queue.push(i % 64 == 0 ? NowNs() : 0);
+      }
+    });
+    long long stamp = 0;
+    for (std::size_t i = 0; i < kItems; ++i) {
+      queue.pop(stamp);
+      if (stamp != 0) lat.push_back(NowNs() - stamp);
+    }
+    producer.join();
+  });
+  Report("blocking_queue", lat, ms);
+}
+
+}  // namespace
+
+int main() {
+  BenchSingle<s21::spsc_queue<long long>>("spsc_queue");
+  BenchSpscBulk();
+  BenchSingle<LockedQueue>("s21::queue + mutex");
+  BenchBlocking();
+  return 0;
+}
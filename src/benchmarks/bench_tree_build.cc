@@ -0,0 +1,57 @@
+// Построение s21::map из готового набора пар (как при загрузке снимка):
+// конструктор диапазона в сравнении с поэлементной вставкой и std::map, для
+// отсортированного и перемешанного входа.
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../headers/s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kSize = 1000000;
+
+using Items = std::vector<std::pair<int, int>>;
+
+void BenchBuild(const char *order, const Items &items) {
+  char label[64];
+  double ms = s21_bench::MeasureMs([&items] {
+    s21::map<int, int> map(items.begin(), items.end());
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "s21::map range, %s", order);
+  s21_bench::PrintResult(label, items.size(), ms);
+
+  ms = s21_bench::MeasureMs([&items] {
+    s21::map<int, int> map;
+    for (const auto &item : items) map.insert(item);
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "s21::map insert, %s", order);
+  s21_bench::PrintResult(label, items.size(), ms);
+
+  ms = s21_bench::MeasureMs([&items] {
+    std::map<int, int> map(items.begin(), items.end());
+    s21_bench::g_sink = map.size();
+  });
+  std::snprintf(label, sizeof(label), "std::map range, %s", order);
+  s21_bench::PrintResult(label, items.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  Items items(kSize);
+  for (std::size_t i = 0; i < kSize; ++i) {
+    items[i] = {static_cast<int>(i), static_cast<int>(i)};
+  }
+  BenchBuild("sorted", items);
+  std::shuffle(items.begin(), items.end(), std::mt19937(42));
+  BenchBuild("shuffled", items);
+  return 0;
+}
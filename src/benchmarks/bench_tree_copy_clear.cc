@@ -0,0 +1,83 @@
+// Копирование и очистка деревьев из 10^5-10^7 элементов: s21::set (копия без
+// рекурсии, разбор дерева поворотами) в сравнении с std::set. Очистка
+// s21::set меряется в двух режимах: пул узлов принадлежит только дереву
+// (блоки освобождаются разом) и пул разделен после merge (узлы удаляются по
+// одному). Для строк очистка вызывает деструкторы всех ключей.
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../headers/s21_set.h"
+#include "bench_utils.h"
+
+namespace {
+
+template <typename Key>
+Key MakeKey(std::size_t i);
+
+template <>
+int MakeKey<int>(std::size_t i) {
+  return static_cast<int>(i);
+}
+
+template <>
+std::string MakeKey<std::string>(std::size_t i) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "key-%020zu", i);
+  return buffer;
+}
+
+template <typename Set>
+Set MakeSet(std::size_t n) {
+  Set set;
+  for (std::size_t i = 0; i < n; ++i) {
+    set.insert(set.end(), MakeKey<typename Set::key_type>(i));
+  }
+  return set;
+}
+
+template <typename Set>
+void BenchCopyClear(const char *prefix, std::size_t n) {
+  char label[64];
+  Set source = MakeSet<Set>(n);
+  Set copy;
+  double ms = s21_bench::MeasureMs([&] { copy = source; });
+  std::snprintf(label, sizeof(label), "%s copy", prefix);
+  s21_bench::PrintResult(label, n, ms);
+
+  ms = s21_bench::MeasureMs([&] { copy.clear(); });
+  std::snprintf(label, sizeof(label), "%s clear", prefix);
+  s21_bench::PrintResult(label, n, ms);
+}
+
+// Очистка s21::set, пул которого делит блоки с другим деревом
+template <typename Key>
+void BenchSharedClear(const char *prefix, std::size_t n) {
+  char label[64];
+  s21::set<Key> set = MakeSet<s21::set<Key>>(n);
+  s21::set<Key> donor = {MakeKey<Key>(n), MakeKey<Key>(n + 1)};
+  // Первый ключ donor уходит в set, поэтому блоки остаются общими
+  donor.insert(MakeKey<Key>(n + 2));
+  set.merge(donor);
+  double ms = s21_bench::MeasureMs([&] { set.clear(); });
+  std::snprintf(label, sizeof(label), "%s clear (shared pool)", prefix);
+  s21_bench::PrintResult(label, n, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {100000U, 1000000U, 10000000U}) {
+    BenchCopyClear<s21::set<int>>("s21::set<int>", n);
+    BenchSharedClear<int>("s21::set<int>", n);
+    BenchCopyClear<std::set<int>>("std::set<int>", n);
+  }
+  for (std::size_t n : {100000U, 1000000U}) {
+    BenchCopyClear<s21::set<std::string>>("s21::set<string>", n);
+    BenchSharedClear<std::string>("s21::set<string>", n);
+    BenchCopyClear<std::set<std::string>>("std::set<string>", n);
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+// Порядковые статистики: count() по ключам с большим числом повторов, поиск
+// перцентиля (k-го элемента) и ранга ключа. s21::multiset с OrderStatistics
+// отвечает за O(log n), без него и std::multiset - перебором. Отдельно
+// печатается цена поддержки размеров поддеревьев при вставке и удалении.
+
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+
+#include "../headers/s21_multiset.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kSize = 200000;
+constexpr int kKeys = 100;
+constexpr std::size_t kQueries = 200;
+
+using Plain = s21::multiset<int>;
+using Ranked = s21::multiset<int, std::less<int>, true>;
+
+template <typename Set>
+void Fill(Set &set) {
+  std::mt19937 gen(42);
+  for (std::size_t i = 0; i < kSize; ++i) {
+    set.insert(static_cast<int>(gen() % kKeys));
+  }
+}
+
+template <typename Set>
+void BenchInsertErase(const char *name) {
+  double ms = s21_bench::MeasureMs([] {
+    Set set;
+    Fill(set);
+    for (int key = 0; key < kKeys; ++key) set.erase(set.find(key));
+    s21_bench::g_sink = static_cast<long long>(set.size());
+  });
+  s21_bench::PrintResult(name, kSize, ms);
+}
+
+template <typename Set>
+void BenchCount(const char *name) {
+  Set set;
+  Fill(set);
+  double ms = s21_bench::MeasureMs([&set] {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < kQueries; ++i) {
+      total += set.count(static_cast<int>(i % kKeys));
+    }
+    s21_bench::g_sink = static_cast<long long>(total);
+  });
+  s21_bench::PrintResult(name, kQueries, ms);
+}
+
+void BenchSelect() {
+  Ranked ranked;
+  std::multiset<int> plain;
+  Fill(ranked);
+  Fill(plain);
+  double ms = s21_bench::MeasureMs([&ranked] {
+    long long total = 0;
+    for (std::size_t i = 0; i < kQueries; ++i) {
+      total += *ranked.select(i * (kSize / kQueries));
+    }
+    s21_bench::g_sink = total;
+  });
+  s21_bench::PrintResult("s21::multiset<..., true> select(k)", kQueries, ms);
+  ms = s21_bench::MeasureMs([&plain] {
+    long long total = 0;
+    for (std::size_t i = 0; i < kQueries; ++i) {
+      total += *std::next(plain.begin(), i * (kSize / kQueries));
+    }
+    s21_bench::g_sink = total;
+  });
+  s21_bench::PrintResult("std::multiset std::next(begin(), k)", kQueries,
+                         ms);
+}
+
+void BenchRank() {
+  Ranked ranked;
+  std::multiset<int> plain;
+  Fill(ranked);
+  Fill(plain);
+  double ms = s21_bench::MeasureMs([&ranked] {
+    long long total = 0;
+    for (std::size_t i = 0; i < kQueries; ++i) {
+      total += static_cast<long long>(ranked.rank(static_cast<int>(i % kKeys)));
+    }
+    s21_bench::g_sink = total;
+  });
+  s21_bench::PrintResult("s21::multiset<..., true> rank(key)", kQueries, ms);
+  ms = s21_bench::MeasureMs([&plain] {
+    long long total = 0;
+    for (std::size_t i = 0; i < kQueries; ++i) {
+      total += std::distance(plain.begin(),
+                             plain.lower_bound(static_cast<int>(i % kKeys)));
+    }
+    s21_bench::g_sink = total;
+  });
+  s21_bench::PrintResult("std::multiset distance(lower_bound)", kQueries, ms);
+}
+
+}  // namespace
+
+int main() {
+  BenchInsertErase<Plain>("s21::multiset insert/erase");
+  BenchInsertErase<Ranked>("s21::multiset<..., true> insert/erase");
+  BenchCount<Plain>("s21::multiset count");
+  BenchCount<Ranked>("s21::multiset<..., true> count");
+  BenchCount<std::multiset<int>>("std::multiset count");
+  BenchSelect();
+  BenchRank();
+  return 0;
+}
@@ -0,0 +1,75 @@
+// Выделение узлов красно-чёрного дерева из пула: вставка, повторная вставка
+// существующих ключей и очистка s21::map/s21::set в сравнении с std::map и
+// std::set.
+
+#include <cstdio>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../headers/s21_map.h"
+#include "../headers/s21_set.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kSize = 200000;
+
+std::vector<int> RandomKeys(std::size_t n) {
+  std::mt19937 gen(42);
+  std::vector<int> keys(n);
+  for (auto &key : keys) {
+    key = static_cast<int>(gen());
+  }
+  return keys;
+}
+
+template <typename Set>
+void BenchSet(const char *prefix, const std::vector<int> &keys) {
+  char label[64];
+  Set set;
+  double ms = s21_bench::MeasureMs([&] {
+    for (int key : keys) set.insert(key);
+  });
+  std::snprintf(label, sizeof(label), "%s insert", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+
+  ms = s21_bench::MeasureMs([&] {
+    long long inserted = 0;
+    for (int key : keys) inserted += set.insert(key).second;
+    s21_bench::g_sink = inserted;
+  });
+  std::snprintf(label, sizeof(label), "%s insert duplicates", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+
+  ms = s21_bench::MeasureMs([&] { set.clear(); });
+  std::snprintf(label, sizeof(label), "%s clear", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+}
+
+template <typename Map>
+void BenchMap(const char *prefix, const std::vector<int> &keys) {
+  char label[64];
+  Map map;
+  double ms = s21_bench::MeasureMs([&] {
+    for (int key : keys) map.insert({key, key});
+  });
+  std::snprintf(label, sizeof(label), "%s insert", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+
+  ms = s21_bench::MeasureMs([&] { map.clear(); });
+  std::snprintf(label, sizeof(label), "%s clear", prefix);
+  s21_bench::PrintResult(label, keys.size(), ms);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<int> keys = RandomKeys(kSize);
+  BenchSet<s21::set<int>>("s21::set", keys);
+  BenchSet<std::set<int>>("std::set", keys);
+  BenchMap<s21::map<int, int>>("s21::map", keys);
+  BenchMap<std::map<int, int>>("std::map", keys);
+  return 0;
+}
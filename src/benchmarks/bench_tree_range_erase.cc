@@ -0,0 +1,76 @@
+// Удаление диапазона из s21::set<int> из 10^4-10^6 элементов: erase(first,
+// last) (split/join и разбор вырезанного поддерева) в сравнении с циклом
+// erase(pos), который балансирует дерево после каждого узла, для диапазонов
+// в 1%, 10% и 50% элементов. Затем сумма ключей диапазона через
+// for_each_in_range() и через итераторы. У s21::set нет lower_bound(), но
+// ключи - перестановка 0..n-1, поэтому начало диапазона находит find().
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../headers/s21_set.h"
+#include "bench_utils.h"
+
+namespace {
+
+s21::set<int> MakeSet(std::size_t n) {
+  std::vector<int> keys(n);
+  for (std::size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(1));
+  s21::set<int> set;
+  for (int key : keys) set.insert(key);
+  return set;
+}
+
+void BenchErase(std::size_t n, std::size_t percent) {
+  int lo = static_cast<int>(n / 4);
+  int hi = lo + static_cast<int>(n * percent / 100);
+  char label[64];
+
+  s21::set<int> set = MakeSet(n);
+  double ms = s21_bench::MeasureMs([&] {
+    for (auto it = set.find(lo); it != set.end() && *it < hi;) {
+      set.erase(it++);
+    }
+  });
+  std::snprintf(label, sizeof(label), "erase(pos) loop, %3zu%%", percent);
+  s21_bench::PrintResult(label, n, ms);
+
+  set = MakeSet(n);
+  ms = s21_bench::MeasureMs([&] { set.erase(set.find(lo), set.find(hi)); });
+  std::snprintf(label, sizeof(label), "erase(first, last), %3zu%%", percent);
+  s21_bench::PrintResult(label, n, ms);
+  s21_bench::g_sink = static_cast<long long>(set.size());
+}
+
+void BenchVisit(std::size_t n) {
+  s21::set<int> set = MakeSet(n);
+  int lo = static_cast<int>(n / 4);
+  int hi = lo + static_cast<int>(n / 2);
+  double ms = s21_bench::MeasureMs([&] {
+    long long sum = 0;
+    for (auto it = set.find(lo); it != set.end() && *it < hi; ++it) {
+      sum += *it;
+    }
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult("iterate [lo, hi), 50%", n, ms);
+  ms = s21_bench::MeasureMs([&] {
+    long long sum = 0;
+    set.for_each_in_range(lo, hi, [&sum](int key) { sum += key; });
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult("for_each_in_range, 50%", n, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {10000U, 100000U, 1000000U}) {
+    for (std::size_t percent : {1U, 10U, 50U}) BenchErase(n, percent);
+    BenchVisit(n);
+  }
+  return 0;
+}
@@ -0,0 +1,61 @@
+// Вставка возрастающих ключей (как в индексе временного ряда): обычный
+// insert (с быстрым путем для ключа больше максимального), insert с
+// подсказкой end() и с подсказкой - результатом предыдущей вставки, в
+// сравнении с std::set.
+
+#include <cstdio>
+#include <set>
+
+#include "../headers/s21_set.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr std::size_t kSize = 1000000;
+
+template <typename Set>
+void BenchInsert(const char *name) {
+  double ms = s21_bench::MeasureMs([] {
+    Set set;
+    for (std::size_t i = 0; i < kSize; ++i) set.insert(static_cast<int>(i));
+    s21_bench::g_sink = set.size();
+  });
+  s21_bench::PrintResult(name, kSize, ms);
+}
+
+template <typename Set>
+void BenchHintEnd(const char *name) {
+  double ms = s21_bench::MeasureMs([] {
+    Set set;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      set.insert(set.end(), static_cast<int>(i));
+    }
+    s21_bench::g_sink = set.size();
+  });
+  s21_bench::PrintResult(name, kSize, ms);
+}
+
+template <typename Set>
+void BenchHintPrevious(const char *name) {
+  double ms = s21_bench::MeasureMs([] {
+    Set set;
+    auto it = set.end();
+    for (std::size_t i = 0; i < kSize; ++i) {
+      it = set.insert(it, static_cast<int>(i));
+    }
+    s21_bench::g_sink = set.size();
+  });
+  s21_bench::PrintResult(name, kSize, ms);
+}
+
+}  // namespace
+
+int main() {
+  BenchInsert<s21::set<int>>("s21::set insert");
+  BenchInsert<std::set<int>>("std::set insert");
+  BenchHintEnd<s21::set<int>>("s21::set insert(end(), key)");
+  BenchHintEnd<std::set<int>>("std::set insert(end(), key)");
+  BenchHintPrevious<s21::set<int>>("s21::set insert(prev, key)");
+  BenchHintPrevious<std::set<int>>("std::set insert(prev, key)");
+  return 0;
+}
@@ -0,0 +1,79 @@
+// Сравнение s21::unrolled_list с s21::list и s21::vector: последовательный
+// обход и вставка в середину.
+
+#include "../headers/s21_list.h"
+#include "../headers/s21_unrolled_list.h"
+#include "../headers/s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+
+template <typename Container>
+void BenchTraversal(const char *name, std::size_t n) {
+  Container c;
+  for (std::size_t i = 0; i < n; ++i) {
+    c.push_back(static_cast<int>(i));
+  }
+  double ms = s21_bench::MeasureMs([&c] {
+    long long sum = 0;
+    for (int round = 0; round < 10; ++round) {
+      for (auto it = c.begin(); it != c.end(); ++it) {
+        sum += *it;
+      }
+    }
+    s21_bench::g_sink = sum;
+  });
+  s21_bench::PrintResult(name, n, ms);
+}
+
+// Вставка в середину: итератор на середину ищется один раз, затем все
+// вставки идут в эту позицию (для вектора итератор пересчитывается, т.к.
+// вставка его инвалидирует)
+template <typename Container>
+void BenchMidInsert(const char *name, std::size_t n, std::size_t inserts) {
+  Container c;
+  for (std::size_t i = 0; i < n; ++i) {
+    c.push_back(static_cast<int>(i));
+  }
+  double ms = s21_bench::MeasureMs([&c, n, inserts] {
+    auto it = c.begin();
+    for (std::size_t i = 0; i < n / 2; ++i) {
+      ++it;
+    }
+    for (std::size_t i = 0; i < inserts; ++i) {
+      it = c.insert(it, static_cast<int>(i));
+    }
+  });
+  s21_bench::PrintResult(name, n, ms);
+}
+
+void BenchVectorMidInsert(std::size_t n, std::size_t inserts) {
+  s21::vector<int> c;
+  for (std::size_t i = 0; i < n; ++i) {
+    c.push_back(static_cast<int>(i));
+  }
+  double ms = s21_bench::MeasureMs([&c, n, inserts] {
+    for (std::size_t i = 0; i < inserts; ++i) {
+      c.insert(c.begin() + n / 2, static_cast<int>(i));
+    }
+  });
+  s21_bench::PrintResult("insert middle x1000: s21::vector", n, ms);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t n : {10000U, 100000U, 1000000U}) {
+    BenchTraversal<s21::list<int>>("traverse x10: s21::list", n);
+    BenchTraversal<s21::unrolled_list<int>>("traverse x10: s21::unrolled_list",
+                                            n);
+    BenchTraversal<s21::vector<int>>("traverse x10: s21::vector", n);
+  }
+  for (std::size_t n : {10000U, 100000U}) {
+    BenchMidInsert<s21::list<int>>("insert middle x1000: s21::list", n, 1000);
+    BenchMidInsert<s21::unrolled_list<int>>(
+        "insert middle x1000: s21::unrolled_list", n, 1000);
+    BenchVectorMidInsert(n, 1000);
+  }
+  return 0;
+}
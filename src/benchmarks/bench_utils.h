@@ -0,0 +1,45 @@
+/**
+ * @file bench_utils.h
+ * @brief Общие вспомогательные функции для бенчмарков контейнеров.
+ *
+ * @details Бенчмарки собираются отдельно от тестов (make benchmark) с
+ * оптимизацией -O2. Каждый бенчмарк - самостоятельная программа, которая
+ * печатает таблицу результатов в stdout.
+ */
+
+#ifndef S21_CONTAINERS_BENCHMARKS_BENCH_UTILS_H_
+#define S21_CONTAINERS_BENCHMARKS_BENCH_UTILS_H_
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+namespace s21_bench {
+
+/**
+ * @brief Переменная-приемник, запись в которую не дает компилятору выбросить
+ * вычисления, результат которых больше нигде не используется.
+ */
+inline volatile long long g_sink = 0;
+
+/**
+ * @brief Измеряет время выполнения fn в миллисекундах
+ */
+template <typename F>
+double MeasureMs(F &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  std::forward<F>(fn)();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+/**
+ * @brief Печатает строку таблицы результатов: название, размер и время
+ */
+inline void PrintResult(const char *name, std::size_t n, double ms) {
+  std::printf("%-40s n=%-10zu %10.3f ms\n", name, n, ms);
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_CONTAINERS_BENCHMARKS_BENCH_UTILS_H_
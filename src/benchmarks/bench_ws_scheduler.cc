@@ -0,0 +1,52 @@
+// Масштабирование s21::ws_scheduler на задаче "разделяй и властвуй":
+// параллельное вычисление числа Фибоначчи при разном числе потоков в
+// сравнении с последовательной версией.
+
+#include <cstdio>
+
+#include "../headers/s21_ws_scheduler.h"
+#include "bench_utils.h"
+
+namespace {
+
+constexpr int kN = 36;
+constexpr int kCutoff = 20;
+
+long long SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+
+long long ParallelFib(s21::ws_scheduler &scheduler, int n) {
+  if (n < kCutoff) return SerialFib(n);
+  long long a = 0;
+  s21::ws_scheduler::task_group group(scheduler);
+  group.run([&scheduler, &a, n] { a = ParallelFib(scheduler, n - 1); });
+  long long b = ParallelFib(scheduler, n - 2);
+  group.wait();
+  return a + b;
+}
+
+void BenchSerial() {
+  double ms = s21_bench::MeasureMs([] { s21_bench::g_sink = SerialFib(kN); });
+  s21_bench::PrintResult("fib: serial", kN, ms);
+}
+
+void BenchParallel(std::size_t threads) {
+  s21::ws_scheduler scheduler(threads);
+  double ms = s21_bench::MeasureMs(
+      [&scheduler] { s21_bench::g_sink = ParallelFib(scheduler, kN); });
+  char label[64];
+  std::snprintf(label, sizeof(label), "fib: ws_scheduler %zu threads",
+                threads);
+  s21_bench::PrintResult(label, kN, ms);
+}
+
+}  // namespace
+
+int main() {
+  BenchSerial();
+  for (std::size_t threads : {1U, 2U, 4U, 8U}) {
+    BenchParallel(threads);
+  }
+  return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file s21_blocking_queue.h
+ * @brief s21::blocking_queue - ограниченная по размеру потокобезопасная
+ * очередь для схем "производитель-потребитель" с любым числом производителей
+ * и потребителей.
+ *
+ * @details Элементы хранятся в s21::queue под одним мьютексом. Два условия
+ * (not_empty_ и not_full_) будят ровно тех, кто ждет: потребителей после
+ * вставки и производителей после извлечения.
+ *
+ * Завершение работы: после close() новые элементы не принимаются (push
+ * возвращает false), а потребители дочитывают оставшиеся элементы, после
+ * чего pop возвращает false. Все ожидающие потоки просыпаются.
+ *
+ * pop_all() забирает за один захват мьютекса все доступные элементы, что
+ * снижает накладные расходы на синхронизацию при большом потоке данных.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_queue.h"
+#include "s21_vector.h"
+
+namespace s21 {
+template <typename T, typename Container = s21::list<T>>
+class blocking_queue {
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Внутренняя очередь
+  using queue_type = s21::queue<T, Container>;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пустую очередь
+   *
+   * @param capacity Максимальное количество элементов. По умолчанию очередь
+   * фактически не ограничена.
+   * @throw std::invalid_argument capacity равна нулю
+   */
+  explicit blocking_queue(
+      size_type capacity = std::numeric_limits<size_type>::max())
+      : capacity_(capacity), closed_(false) {
+    if (capacity_ == 0U) {
+      throw std::invalid_argument("blocking_queue capacity must be positive");
+    }
+  }
+
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  /**
+   * @brief Добавляет элемент, ожидая свободного места
+   *
+   * @return true элемент добавлен
+   * @return false очередь закрыта, элемент не добавлен
+   */
+  bool push(const_reference value) { return Push(value); }
+  bool push(value_type &&value) { return Push(std::move(value)); }
+
+  /**
+   * @brief Добавляет элемент, если есть свободное место. Не блокируется.
+   *
+   * @return false очередь заполнена или закрыта, элемент не добавлен
+   */
+  bool try_push(const_reference value) { return TryPush(value); }
+  bool try_push(value_type &&value) { return TryPush(std::move(value)); }
+
+  /**
+   * @brief Добавляет элемент, ожидая свободного места не дольше timeout
+   *
+   * @return false время истекло или очередь закрыта, элемент не добавлен.
+   * Неудачная вставка rvalue не забирает значение.
+   */
+  template <typename Rep, typename Period>
+  bool try_push_for(const_reference value,
+                    const std::chrono::duration<Rep, Period> &timeout) {
+    return PushFor(value, timeout);
+  }
+  template <typename Rep, typename Period>
+  bool try_push_for(value_type &&value,
+                    const std::chrono::duration<Rep, Period> &timeout) {
+    return PushFor(std::move(value), timeout);
+  }
+
+  /**
+   * @brief Извлекает первый элемент, ожидая его появления
+   *
+   * @param value Сюда переносится извлеченный элемент
+   * @return false очередь закрыта и пуста
+   */
+  bool pop(reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    return PopLocked(value, lock);
+  }
+
+  /**
+   * @brief Извлекает первый элемент, если он есть. Не блокируется.
+   *
+   * @return false очередь пуста
+   */
+  bool try_pop(reference value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return PopLocked(value, lock);
+  }
+
+  /**
+   * @brief Извлекает первый элемент, ожидая его не дольше timeout
+   *
+   * @return false время истекло или очередь закрыта и пуста
+   */
+  template <typename Rep, typename Period>
+  bool try_pop_for(reference value,
+                   const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait_for(lock, timeout,
+                        [this] { return !queue_.empty() || closed_; });
+    return PopLocked(value, lock);
+  }
+
+  /**
+   * @brief Дожидается хотя бы одного элемента и переносит в конец out все
+   * доступные элементы (но не больше max_count) за один захват мьютекса
+   *
+   * @return size_type Количество извлеченных элементов. 0 - очередь закрыта
+   * и пуста.
+   */
+  size_type pop_all(
+      s21::vector<value_type> &out,
+      size_type max_count = std::numeric_limits<size_type>::max()) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    size_type count = 0U;
+    while (count < max_count && !queue_.empty()) {
+      out.push_back(std::move(queue_.front()));
+      queue_.pop();
+      ++count;
+    }
+    lock.unlock();
+    if (count == 1U) {
+      not_full_.notify_one();
+    } else if (count > 1U) {
+      not_full_.notify_all();
+    }
+    return count;
+  }
+
+  /**
+   * @brief Закрывает очередь: новые элементы не принимаются, ожидающие
+   * потоки просыпаются. Уже добавленные элементы можно дочитать.
+   */
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  /**
+   * @brief Количество элементов на момент вызова
+   */
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+  }
+
+  bool empty() const { return size() == 0U; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  template <typename Value>
+  bool Push(Value &&value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock,
+                   [this] { return queue_.size() < capacity_ || closed_; });
+    return PushLocked(std::forward<Value>(value), lock);
+  }
+
+  template <typename Value>
+  bool TryPush(Value &&value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return PushLocked(std::forward<Value>(value), lock);
+  }
+
+  template <typename Value, typename Rep, typename Period>
+  bool PushFor(Value &&value,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait_for(lock, timeout, [this] {
+      return queue_.size() < capacity_ || closed_;
+    });
+    return PushLocked(std::forward<Value>(value), lock);
+  }
+
+  // Вставка под захваченным мьютексом. Потребителя будим уже после
+  // освобождения мьютекса, чтобы он сразу мог его взять.
+  template <typename Value>
+  bool PushLocked(Value &&value, std::unique_lock<std::mutex> &lock) {
+    if (closed_ || queue_.size() >= capacity_) {
+      return false;
+    }
+    queue_.push(std::forward<Value>(value));
+    lock.unlock();
+    not_empty_.notify_one();
+    return true;
+  }
+
+  bool PopLocked(reference value, std::unique_lock<std::mutex> &lock) {
+    if (queue_.empty()) {
+      return false;
+    }
+    value = std::move(queue_.front());
+    queue_.pop();
+    lock.unlock();
+    not_full_.notify_one();
+    return true;
+  }
+
+  // Элементы очереди (mutable: size() у s21::queue не константный)
+  mutable queue_type queue_;
+  // Максимальное количество элементов
+  const size_type capacity_;
+  // Очередь закрыта вызовом close()
+  bool closed_;
+  mutable std::mutex mutex_;
+  // Ждут потребители: очередь пуста
+  std::condition_variable not_empty_;
+  // Ждут производители: очередь заполнена
+  std::condition_variable not_full_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_BLOCKING_QUEUE_H_
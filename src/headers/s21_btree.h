@@ -0,0 +1,1478 @@
+/**
+ * @file s21_btree.h
+ * @brief B-дерево BTree и построенные на нем упорядоченные контейнеры
+ * s21::btree_set, s21::btree_map и s21::btree_multiset.
+ *
+ * @details В красно-черном дереве (s21_tree.h) каждый элемент лежит в
+ * отдельном узле с тремя указателями и цветом, и поиск проходит около
+ * 2 * log2(n) узлов, почти каждый из которых - промах кэша. Узел B-дерева
+ * хранит подряд до kNodeSlots элементов (около 256 байт - несколько строк
+ * кэша), поэтому высота дерева в несколько раз меньше, а служебные данные
+ * (указатель на родителя, позиция и количество элементов) делятся на все
+ * элементы узла.
+ *
+ * Устройство:
+ * 1) Все листья на одной глубине. В листе только элементы, во внутреннем
+ * узле с count_ элементами еще count_ + 1 потомков: элемент i разделяет
+ * поддеревья потомков i и i + 1.
+ * 2) Вставка всегда идет в лист. Переполненный узел делится пополам, а
+ * средний элемент поднимается в родителя (и так до корня). Если элемент
+ * добавляется в конец самого правого узла (вставка по возрастанию), узел
+ * не делится пополам, а остается заполненным целиком: так отсортированные
+ * данные занимают минимум узлов.
+ * 3) При удалении узел, в котором осталось меньше kMinSlots элементов, берет
+ * элемент у соседа или сливается с ним.
+ * 4) Внутри узла позиция ищется линейно для арифметических ключей со
+ * стандартным сравнением (без ветвлений, компилятор векторизует цикл) и
+ * двоичным поиском для остальных.
+ *
+ * @warning В отличие от s21::set и s21::map, элементы перемещаются между
+ * ячейками и узлами, поэтому любая вставка и удаление делают
+ * недействительными все итераторы, указатели и ссылки на элементы
+ * контейнера. Методы insert() и erase() возвращают действительные
+ * итераторы. Если конструктор перемещения элемента (для словаря -
+ * конструктор копирования ключа) выбросит исключение, состояние контейнера
+ * не определено, как у std::vector::insert().
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_BTREE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief B-дерево элементов Value, упорядоченных по ключу KeyOfValue()(value)
+ * компаратором Compare
+ */
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Compare = std::less<Key>>
+class BTree {
+ private:
+  struct Node;
+  struct InternalNode;
+  template <bool Const>
+  class Iterator;
+
+ public:
+  // Тип ключа
+  using key_type = Key;
+  // Тип элемента
+  using value_type = Value;
+  // Компаратор ключей
+  using key_compare = Compare;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using tree_type = BTree<Key, Value, KeyOfValue, Compare>;
+
+  // Желаемый размер узла в байтах (4 строки кэша)
+  static constexpr size_type kTargetNodeSize = 256;
+  // Максимальное количество элементов в узле
+  static constexpr size_type kNodeSlots =
+      std::max<size_type>(3, (kTargetNodeSize - 2 * sizeof(void *)) /
+                                 sizeof(value_type));
+  // Минимальное количество элементов в узле, кроме корня, после удаления
+  static constexpr size_type kMinSlots = kNodeSlots / 2;
+
+  BTree() noexcept
+      : root_(nullptr), leftmost_(nullptr), rightmost_(nullptr), size_(0) {}
+
+  BTree(const tree_type &other) : BTree() { CopyFrom(other); }
+
+  BTree(tree_type &&other) noexcept : BTree() { Swap(other); }
+
+  tree_type &operator=(const tree_type &other) {
+    if (this != &other) {
+      tree_type copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  tree_type &operator=(tree_type &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  ~BTree() { Clear(); }
+
+  iterator Begin() noexcept { return iterator(leftmost_, 0); }
+  const_iterator Begin() const noexcept { return const_iterator(leftmost_, 0); }
+
+  /**
+   * @brief Итератор за последним элементом: позиция после последнего
+   * элемента самого правого листа, поэтому --End() - последний элемент
+   */
+  iterator End() noexcept {
+    return iterator(rightmost_, rightmost_ ? rightmost_->count_ : 0);
+  }
+  const_iterator End() const noexcept {
+    return const_iterator(rightmost_, rightmost_ ? rightmost_->count_ : 0);
+  }
+
+  bool Empty() const noexcept { return size_ == 0; }
+  size_type Size() const noexcept { return size_; }
+
+  size_type MaxSize() const noexcept {
+    return (std::numeric_limits<size_type>::max() / 2) / sizeof(value_type);
+  }
+
+  /**
+   * @brief Удаляет все элементы и узлы
+   */
+  void Clear() noexcept {
+    DestroySubtree(root_);
+    root_ = leftmost_ = rightmost_ = nullptr;
+    size_ = 0;
+  }
+
+  void Swap(tree_type &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(leftmost_, other.leftmost_);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(size_, other.size_);
+    std::swap(cmp_, other.cmp_);
+  }
+
+  /**
+   * @brief Вставляет value, если в дереве нет элемента с эквивалентным
+   * ключом. Элемент создается только при вставке.
+   */
+  template <typename V>
+  std::pair<iterator, bool> InsertUnique(V &&value) {
+    InsertPosition position = FindInsertPosition(key_of_(value), true);
+    if (position.found_) {
+      return {iterator(position.node_, position.index_), false};
+    }
+    return {InsertAt(position, std::forward<V>(value)), true};
+  }
+
+  /**
+   * @brief Вставляет value после всех элементов с эквивалентным ключом
+   */
+  template <typename V>
+  iterator Insert(V &&value) {
+    return InsertAt(FindInsertPosition(key_of_(value), false),
+                    std::forward<V>(value));
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его (при unique_only - только
+   * если нет элемента с эквивалентным ключом)
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceOne(bool unique_only, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    InsertPosition position = FindInsertPosition(key_of_(value), unique_only);
+    if (position.found_) {
+      return {iterator(position.node_, position.index_), false};
+    }
+    return {InsertAt(position, std::move(value)), true};
+  }
+
+  /**
+   * @brief Вставляет элемент, созданный из args, если нет элемента с ключом
+   * key. Ключ ищется до создания элемента.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> TryEmplace(const key_type &key, Args &&...args) {
+    InsertPosition position = FindInsertPosition(key, true);
+    if (position.found_) {
+      return {iterator(position.node_, position.index_), false};
+    }
+    return {InsertAt(position, std::forward<Args>(args)...), true};
+  }
+
+  /**
+   * @brief Вставляет элемент, созданный из args, как можно ближе к позиции
+   * перед hint
+   *
+   * @details Если элемент встает прямо перед hint (в частности, в конец при
+   * hint == End() - вставка по возрастанию), спуск от корня не нужен.
+   * Иначе выполняется обычная вставка.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceHint(const_iterator hint, bool unique_only,
+                                        Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    const key_type &key = key_of_(value);
+    if (FitsBefore(hint, key, unique_only)) {
+      return {InsertAt(PositionBefore(hint), std::move(value)), true};
+    }
+    InsertPosition position = FindInsertPosition(key, unique_only);
+    if (position.found_) {
+      return {iterator(position.node_, position.index_), false};
+    }
+    return {InsertAt(position, std::move(value)), true};
+  }
+
+  /**
+   * @brief Вставляет элементы args по одному. Итераторы в результате
+   * собираются после вставки всех элементов, т.к. каждая вставка делает
+   * прежние итераторы недействительными.
+   */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> EmplaceMany(bool unique_only,
+                                                     Args &&...args) {
+    std::vector<value_type> items;
+    items.reserve(sizeof...(args));
+    (items.emplace_back(std::forward<Args>(args)), ...);
+    std::vector<key_type> keys;
+    keys.reserve(items.size());
+    std::vector<bool> inserted;
+    inserted.reserve(items.size());
+    for (value_type &item : items) {
+      keys.push_back(key_of_(item));
+      inserted.push_back(EmplaceOne(unique_only, std::move(item)).second);
+    }
+    std::vector<std::pair<iterator, bool>> result(items.size(),
+                                                  {End(), false});
+    for (size_type i = items.size(); i-- > 0;) {
+      iterator position = End();
+      if (unique_only) {
+        position = Find(keys[i]);
+      } else {
+        // Элемент встал после всех эквивалентных, вставленных раньше, и
+        // перед эквивалентными, вставленными позже
+        size_type later = i + 1;
+        while (later < keys.size() && !Equivalent(keys[i], keys[later])) {
+          ++later;
+        }
+        position = later < keys.size() ? result[later].first
+                                       : UpperBound(keys[i]);
+        --position;
+      }
+      result[i] = {position, inserted[i]};
+    }
+    return result;
+  }
+
+  /**
+   * @brief Удаляет элемент pos
+   *
+   * @return iterator Итератор на элемент, следовавший за удаленным
+   */
+  iterator Erase(const_iterator pos) {
+    Node *node = const_cast<Node *>(pos.node_);
+    size_type index = pos.position_;
+    bool internal = !node->leaf_;
+    if (internal) {
+      // Элемент внутреннего узла заменяем предыдущим - последним элементом
+      // самого правого листа левого поддерева - и удаляем уже его из листа
+      Node *leaf = Child(node, index);
+      while (!leaf->leaf_) {
+        leaf = Child(leaf, leaf->count_);
+      }
+      DestroySlot(node, index);
+      Relocate(node->Slot(index), leaf->Slot(leaf->count_ - 1));
+      --leaf->count_;
+      node = leaf;
+      index = leaf->count_;
+    } else {
+      DestroySlot(node, index);
+      RelocateRange(node->Slot(index), node->Slot(index + 1),
+                    node->count_ - index - 1);
+      --node->count_;
+    }
+    --size_;
+    // (node, index) - место, где теперь стоит следующий элемент (после
+    // удаления из внутреннего узла - перенесенный в него предыдущий)
+    RebalanceAfterErase(node, index);
+    if (root_ == nullptr) return End();
+    iterator result = Normalize(node, index);
+    if (internal) ++result;
+    return result;
+  }
+
+  /**
+   * @brief Удаляет все элементы с ключом key
+   *
+   * @return size_type Количество удаленных элементов
+   */
+  size_type EraseKey(const key_type &key) {
+    size_type erased = 0;
+    for (iterator it = LowerBound(key);
+         it != End() && !cmp_(key, key_of_(*it)); ++erased) {
+      it = Erase(it);
+    }
+    return erased;
+  }
+
+  /**
+   * @brief Переносит в this элементы other (при unique_only - только те,
+   * ключей которых нет в this)
+   */
+  void Merge(tree_type &other, bool unique_only) {
+    if (&other == this) return;
+    for (iterator it = other.Begin(); it != other.End();) {
+      InsertPosition position = FindInsertPosition(key_of_(*it), unique_only);
+      if (position.found_) {
+        ++it;
+      } else {
+        InsertAt(position, std::move(*it));
+        it = other.Erase(it);
+      }
+    }
+  }
+
+  /**
+   * @brief Заменяет содержимое дерева элементами [first, last). Для
+   * отсортированного диапазона каждый элемент добавляется в конец без
+   * спуска от корня, и дерево строится за O(n).
+   */
+  template <typename InputIt>
+  void Assign(InputIt first, InputIt last, bool unique_only) {
+    tree_type result;
+    result.cmp_ = cmp_;
+    for (; first != last; ++first) {
+      result.EmplaceHint(result.End(), unique_only, *first);
+    }
+    Swap(result);
+  }
+
+  /**
+   * @brief Находит элемент с ключом key (из нескольких эквивалентных -
+   * первый, как std::multiset в gcc)
+   */
+  iterator Find(const key_type &key) {
+    iterator found = LowerBound(key);
+    if (found != End() && !cmp_(key, key_of_(*found))) return found;
+    return End();
+  }
+
+  const_iterator Find(const key_type &key) const {
+    return const_cast<tree_type *>(this)->Find(key);
+  }
+
+  /**
+   * @brief Первый элемент, ключ которого не меньше key
+   */
+  iterator LowerBound(const key_type &key) {
+    return Bound(key, [this](const Node *node, const key_type &k) {
+      return LowerIndex(node, k);
+    });
+  }
+  const_iterator LowerBound(const key_type &key) const {
+    return const_cast<tree_type *>(this)->LowerBound(key);
+  }
+
+  /**
+   * @brief Первый элемент, ключ которого больше key
+   */
+  iterator UpperBound(const key_type &key) {
+    return Bound(key, [this](const Node *node, const key_type &k) {
+      return UpperIndex(node, k);
+    });
+  }
+  const_iterator UpperBound(const key_type &key) const {
+    return const_cast<tree_type *>(this)->UpperBound(key);
+  }
+
+  std::pair<iterator, iterator> EqualRange(const key_type &key) {
+    return {LowerBound(key), UpperBound(key)};
+  }
+  std::pair<const_iterator, const_iterator> EqualRange(
+      const key_type &key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+
+  size_type Count(const key_type &key) const {
+    std::pair<const_iterator, const_iterator> range = EqualRange(key);
+    return static_cast<size_type>(std::distance(range.first, range.second));
+  }
+
+ private:
+  // Узел (лист). Элементы хранятся в сырой памяти slots_, создаются и
+  // уничтожаются по мере заполнения.
+  struct Node {
+    explicit Node(bool leaf) noexcept
+        : parent_(nullptr), position_(0), count_(0), leaf_(leaf) {}
+
+    value_type *Slot(size_type index) noexcept {
+      return std::launder(reinterpret_cast<value_type *>(slots_) + index);
+    }
+    const value_type *Slot(size_type index) const noexcept {
+      return std::launder(reinterpret_cast<const value_type *>(slots_) +
+                          index);
+    }
+
+    Node *parent_;
+    // Номер узла среди потомков родителя
+    std::uint16_t position_;
+    // Количество элементов
+    std::uint16_t count_;
+    bool leaf_;
+    alignas(value_type) unsigned char slots_[kNodeSlots * sizeof(value_type)];
+  };
+
+  // Внутренний узел: узел с потомками
+  struct InternalNode : Node {
+    InternalNode() noexcept : Node(false), children_{} {}
+
+    Node *children_[kNodeSlots + 1];
+  };
+
+  static_assert(kNodeSlots < std::numeric_limits<std::uint16_t>::max(),
+                "too many slots for uint16_t positions");
+
+  // Поиск внутри узла линейный для арифметических ключей со стандартными
+  // сравнениями: ключи в узле идут подряд, и счет без ветвлений быстрее
+  // двоичного поиска с непредсказуемыми переходами
+  static constexpr bool kLinearSearch =
+      std::is_arithmetic<key_type>::value &&
+      (std::is_same<key_compare, std::less<key_type>>::value ||
+       std::is_same<key_compare, std::less<>>::value ||
+       std::is_same<key_compare, std::greater<key_type>>::value ||
+       std::is_same<key_compare, std::greater<>>::value);
+
+  // Место для вставки: лист и позиция в нем, либо (при found_) найденный
+  // эквивалентный элемент
+  struct InsertPosition {
+    Node *node_;
+    size_type index_;
+    bool found_;
+  };
+
+  template <bool Const>
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename tree_type::value_type;
+    using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+    using reference =
+        std::conditional_t<Const, const value_type &, value_type &>;
+    using node_pointer = std::conditional_t<Const, const Node *, Node *>;
+
+    Iterator(node_pointer node, size_type position) noexcept
+        : node_(node), position_(position) {}
+
+    // Неявное преобразование iterator в const_iterator
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false> &other) noexcept
+        : node_(other.node_), position_(other.position_) {}
+
+    reference operator*() const noexcept { return *node_->Slot(position_); }
+    pointer operator->() const noexcept { return node_->Slot(position_); }
+
+    Iterator &operator++() noexcept {
+      if (!node_->leaf_) {
+        // Следующий - самый левый элемент правого поддерева
+        node_ = Child(node_, position_ + 1);
+        while (!node_->leaf_) node_ = Child(node_, 0);
+        position_ = 0;
+        return *this;
+      }
+      if (++position_ < node_->count_) return *this;
+      // Лист закончился: поднимаемся, пока не придем слева от элемента.
+      // Для последнего элемента остаемся в позиции end()
+      node_pointer node = node_;
+      size_type position = position_;
+      while (position == node->count_ && node->parent_ != nullptr) {
+        position = node->position_;
+        node = node->parent_;
+      }
+      if (position < node->count_) {
+        node_ = node;
+        position_ = position;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    Iterator &operator--() noexcept {
+      if (!node_->leaf_) {
+        // Предыдущий - самый правый элемент левого поддерева
+        node_ = Child(node_, position_);
+        while (!node_->leaf_) node_ = Child(node_, node_->count_);
+        position_ = node_->count_ - 1;
+        return *this;
+      }
+      if (position_ > 0) {
+        --position_;
+        return *this;
+      }
+      while (position_ == 0 && node_->parent_ != nullptr) {
+        position_ = node_->position_;
+        node_ = node_->parent_;
+      }
+      --position_;
+      return *this;
+    }
+
+    Iterator operator--(int) noexcept {
+      Iterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) noexcept {
+      return a.node_ == b.node_ && a.position_ == b.position_;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) noexcept {
+      return !(a == b);
+    }
+
+   private:
+    friend class BTree;
+    template <bool>
+    friend class Iterator;
+
+    node_pointer node_;
+    size_type position_;
+  };
+
+  static Node *&Child(Node *node, size_type index) noexcept {
+    return static_cast<InternalNode *>(node)->children_[index];
+  }
+  static const Node *Child(const Node *node, size_type index) noexcept {
+    return static_cast<const InternalNode *>(node)->children_[index];
+  }
+
+  static void SetChild(Node *node, size_type index, Node *child) noexcept {
+    Child(node, index) = child;
+    child->parent_ = node;
+    child->position_ = static_cast<std::uint16_t>(index);
+  }
+
+  const key_type &KeyAt(const Node *node, size_type index) const noexcept {
+    return key_of_(*node->Slot(index));
+  }
+
+  bool Equivalent(const key_type &a, const key_type &b) const {
+    return !cmp_(a, b) && !cmp_(b, a);
+  }
+
+  /**
+   * @brief Количество элементов узла с ключом меньше key
+   */
+  size_type LowerIndex(const Node *node, const key_type &key) const {
+    if constexpr (kLinearSearch) {
+      size_type index = 0;
+      for (size_type i = 0; i < node->count_; ++i) {
+        index += cmp_(KeyAt(node, i), key);
+      }
+      return index;
+    } else {
+      size_type low = 0;
+      size_type high = node->count_;
+      while (low < high) {
+        size_type middle = (low + high) / 2;
+        if (cmp_(KeyAt(node, middle), key)) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      return low;
+    }
+  }
+
+  /**
+   * @brief Количество элементов узла с ключом не больше key
+   */
+  size_type UpperIndex(const Node *node, const key_type &key) const {
+    if constexpr (kLinearSearch) {
+      size_type index = 0;
+      for (size_type i = 0; i < node->count_; ++i) {
+        index += !cmp_(key, KeyAt(node, i));
+      }
+      return index;
+    } else {
+      size_type low = 0;
+      size_type high = node->count_;
+      while (low < high) {
+        size_type middle = (low + high) / 2;
+        if (!cmp_(key, KeyAt(node, middle))) {
+          low = middle + 1;
+        } else {
+          high = middle;
+        }
+      }
+      return low;
+    }
+  }
+
+  /**
+   * @brief Общий спуск для LowerBound()/UpperBound(): ответ - самый
+   * глубокий узел, в котором индекс указывает на существующий элемент
+   */
+  template <typename IndexFn>
+  iterator Bound(const key_type &key, IndexFn index_of) {
+    iterator result = End();
+    for (Node *node = root_; node != nullptr;) {
+      size_type index = index_of(node, key);
+      if (index < node->count_) result = iterator(node, index);
+      if (node->leaf_) break;
+      node = Child(node, index);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Спуск до листа, в который встанет элемент с ключом key: после
+   * всех эквивалентных, а при unique_only - с остановкой на эквивалентном
+   */
+  InsertPosition FindInsertPosition(const key_type &key, bool unique_only) {
+    Node *node = root_;
+    if (node == nullptr) return {nullptr, 0, false};
+    for (;;) {
+      size_type index = 0;
+      if (unique_only) {
+        index = LowerIndex(node, key);
+        if (index < node->count_ && !cmp_(key, KeyAt(node, index))) {
+          return {node, index, true};
+        }
+      } else {
+        index = UpperIndex(node, key);
+      }
+      if (node->leaf_) return {node, index, false};
+      node = Child(node, index);
+    }
+  }
+
+  /**
+   * @brief Можно ли вставить элемент с ключом key прямо перед hint
+   */
+  bool FitsBefore(const_iterator hint, const key_type &key,
+                  bool unique_only) const {
+    if (root_ == nullptr) return true;
+    if (hint != End()) {
+      const key_type &next = key_of_(*hint);
+      if (unique_only ? !cmp_(key, next) : cmp_(next, key)) return false;
+    }
+    if (hint != Begin()) {
+      const key_type &prev = key_of_(*std::prev(hint));
+      if (unique_only ? !cmp_(prev, key) : cmp_(key, prev)) return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Место в листе прямо перед hint: сама позиция hint в листе или
+   * конец самого правого листа левого поддерева элемента внутреннего узла
+   */
+  InsertPosition PositionBefore(const_iterator hint) const {
+    Node *node = const_cast<Node *>(hint.node_);
+    if (node == nullptr) return {nullptr, 0, false};
+    if (node->leaf_) return {node, hint.position_, false};
+    node = Child(node, hint.position_);
+    while (!node->leaf_) node = Child(node, node->count_);
+    return {node, node->count_, false};
+  }
+
+  /**
+   * @brief Создает элемент из args в позиции position листа
+   *
+   * @details Элемент сначала создается во временном объекте: если
+   * конструктор выбросит исключение, дерево не изменится. Узлы, нужные для
+   * деления, выделяются заранее, до изменения дерева.
+   */
+  template <typename... Args>
+  iterator InsertAt(InsertPosition position, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    if (root_ == nullptr) {
+      root_ = leftmost_ = rightmost_ = new Node(true);
+      position = {root_, 0, false};
+    }
+    SpareNodes spare;
+    spare.Reserve(position.node_);
+    std::pair<Node *, size_type> placed =
+        InsertValue(position.node_, position.index_, value, nullptr,
+                    position.node_ == rightmost_, spare);
+    ++size_;
+    return iterator(placed.first, placed.second);
+  }
+
+  /**
+   * @brief Узлы, заранее выделенные для деления переполненных узлов при
+   * одной вставке
+   */
+  class SpareNodes {
+   public:
+    SpareNodes() noexcept : count_(0), next_(0) {}
+    SpareNodes(const SpareNodes &) = delete;
+    SpareNodes &operator=(const SpareNodes &) = delete;
+    ~SpareNodes() {
+      for (size_type i = next_; i < count_; ++i) DeleteNode(nodes_[i]);
+    }
+
+    /**
+     * @brief Выделяет по узлу на каждый заполненный узел пути от leaf к
+     * корню и новый корень, если заполнен весь путь
+     */
+    void Reserve(const Node *leaf) {
+      const Node *node = leaf;
+      while (node != nullptr && node->count_ == kNodeSlots) {
+        nodes_[count_] = node->leaf_ ? new Node(true) : new InternalNode();
+        ++count_;
+        node = node->parent_;
+      }
+      if (node == nullptr) {
+        nodes_[count_] = new InternalNode();
+        ++count_;
+      }
+    }
+
+    Node *Take() noexcept { return nodes_[next_++]; }
+
+   private:
+    // Высота дерева не больше количества бит size_type
+    Node *nodes_[std::numeric_limits<size_type>::digits + 1];
+    size_type count_;
+    size_type next_;
+  };
+
+  /**
+   * @brief Вставляет value (и, во внутренний узел, потомка right_child
+   * справа от него) в позицию index узла node, деля узел при переполнении
+   *
+   * @param right_spine Лежит ли node на правом краю дерева: при вставке в
+   * его конец узел делится неравномерно
+   * @return std::pair<Node *, size_type> Узел и позиция вставленного
+   * элемента
+   */
+  std::pair<Node *, size_type> InsertValue(Node *node, size_type index,
+                                           value_type &value,
+                                           Node *right_child, bool right_spine,
+                                           SpareNodes &spare) {
+    if (node->count_ < kNodeSlots) {
+      PlaceValue(node, index, value, right_child);
+      return {node, index};
+    }
+    Node *sibling = spare.Take();
+    // Сколько элементов уходит в новый узел: половина, а при вставке в конец
+    // правого края - ни одного, чтобы узлы при вставке по возрастанию
+    // оставались заполненными
+    size_type moved =
+        right_spine && index == kNodeSlots ? 0 : kNodeSlots / 2;
+    size_type kept = kNodeSlots - moved - 1;
+    RelocateRange(sibling->Slot(0), node->Slot(kept + 1), moved);
+    if (!node->leaf_) {
+      for (size_type i = 0; i <= moved; ++i) {
+        SetChild(sibling, i, Child(node, kept + 1 + i));
+      }
+    }
+    sibling->count_ = static_cast<std::uint16_t>(moved);
+    node->count_ = static_cast<std::uint16_t>(kept);
+    value_type separator(std::move(*node->Slot(kept)));
+    DestroySlot(node, kept);
+    if (node == rightmost_) rightmost_ = sibling;
+
+    std::pair<Node *, size_type> placed{node, index};
+    if (index <= kept) {
+      PlaceValue(node, index, value, right_child);
+    } else {
+      placed = {sibling, index - kept - 1};
+      PlaceValue(sibling, placed.second, value, right_child);
+    }
+
+    Node *parent = node->parent_;
+    if (parent == nullptr) {
+      parent = spare.Take();
+      SetChild(parent, 0, node);
+      root_ = parent;
+    }
+    InsertValue(parent, node->position_, separator, sibling,
+                right_spine && node->position_ == parent->count_, spare);
+    return placed;
+  }
+
+  /**
+   * @brief Вставка в незаполненный узел со сдвигом элементов и потомков
+   */
+  static void PlaceValue(Node *node, size_type index, value_type &value,
+                         Node *right_child) {
+    RelocateRange(node->Slot(index + 1), node->Slot(index),
+                  node->count_ - index);
+    new (node->Slot(index)) value_type(std::move(value));
+    if (right_child != nullptr) {
+      for (size_type i = node->count_ + 1; i > index + 1; --i) {
+        SetChild(node, i, Child(node, i - 1));
+      }
+      SetChild(node, index + 1, right_child);
+    }
+    ++node->count_;
+  }
+
+  /**
+   * @brief Восстанавливает заполненность узлов после удаления элемента из
+   * листа node. (node, index) - отслеживаемая позиция: она сдвигается
+   * вместе с элементами, если те переезжают в другой узел
+   */
+  void RebalanceAfterErase(Node *&node, size_type &index) {
+    for (Node *current = node;
+         current != root_ && current->count_ < kMinSlots;) {
+      Node *parent = current->parent_;
+      size_type position = current->position_;
+      if (position > 0 && Child(parent, position - 1)->count_ > kMinSlots) {
+        RotateRight(parent, position - 1);
+        if (node == current) ++index;
+        break;
+      }
+      if (position < parent->count_ &&
+          Child(parent, position + 1)->count_ > kMinSlots) {
+        RotateLeft(parent, position);
+        break;
+      }
+      if (position > 0) {
+        Node *left = Child(parent, position - 1);
+        if (node == current) {
+          index += left->count_ + 1;
+          node = left;
+        }
+        MergeChildren(parent, position - 1);
+      } else {
+        MergeChildren(parent, position);
+      }
+      current = parent;
+    }
+    if (root_->count_ == 0) {
+      Node *old_root = root_;
+      if (root_->leaf_) {
+        root_ = leftmost_ = rightmost_ = nullptr;
+      } else {
+        root_ = Child(root_, 0);
+        root_->parent_ = nullptr;
+        root_->position_ = 0;
+      }
+      DeleteNode(old_root);
+    }
+  }
+
+  /**
+   * @brief Переносит последний элемент потомка index через родителя в
+   * начало потомка index + 1
+   */
+  static void RotateRight(Node *parent, size_type index) {
+    Node *left = Child(parent, index);
+    Node *right = Child(parent, index + 1);
+    RelocateRange(right->Slot(1), right->Slot(0), right->count_);
+    Relocate(right->Slot(0), parent->Slot(index));
+    Relocate(parent->Slot(index), left->Slot(left->count_ - 1));
+    if (!right->leaf_) {
+      for (size_type i = right->count_ + 1; i > 0; --i) {
+        SetChild(right, i, Child(right, i - 1));
+      }
+      SetChild(right, 0, Child(left, left->count_));
+    }
+    --left->count_;
+    ++right->count_;
+  }
+
+  /**
+   * @brief Переносит первый элемент потомка index + 1 через родителя в
+   * конец потомка index
+   */
+  static void RotateLeft(Node *parent, size_type index) {
+    Node *left = Child(parent, index);
+    Node *right = Child(parent, index + 1);
+    Relocate(left->Slot(left->count_), parent->Slot(index));
+    Relocate(parent->Slot(index), right->Slot(0));
+    RelocateRange(right->Slot(0), right->Slot(1), right->count_ - 1);
+    if (!left->leaf_) {
+      SetChild(left, left->count_ + 1, Child(right, 0));
+      for (size_type i = 0; i < right->count_; ++i) {
+        SetChild(right, i, Child(right, i + 1));
+      }
+    }
+    ++left->count_;
+    --right->count_;
+  }
+
+  /**
+   * @brief Сливает потомка index + 1 и разделяющий элемент родителя в
+   * потомка index
+   */
+  void MergeChildren(Node *parent, size_type index) {
+    Node *left = Child(parent, index);
+    Node *right = Child(parent, index + 1);
+    Relocate(left->Slot(left->count_), parent->Slot(index));
+    RelocateRange(left->Slot(left->count_ + 1), right->Slot(0),
+                  right->count_);
+    if (!left->leaf_) {
+      for (size_type i = 0; i <= right->count_; ++i) {
+        SetChild(left, left->count_ + 1 + i, Child(right, i));
+      }
+    }
+    left->count_ = static_cast<std::uint16_t>(left->count_ + right->count_ + 1);
+    RelocateRange(parent->Slot(index), parent->Slot(index + 1),
+                  parent->count_ - index - 1);
+    for (size_type i = index + 1; i < parent->count_; ++i) {
+      SetChild(parent, i, Child(parent, i + 1));
+    }
+    --parent->count_;
+    if (right == rightmost_) rightmost_ = left;
+    right->count_ = 0;
+    DeleteNode(right);
+  }
+
+  /**
+   * @brief Итератор по позиции, которая может быть за концом узла: тогда
+   * это следующий элемент одного из предков или end()
+   */
+  iterator Normalize(Node *node, size_type index) noexcept {
+    Node *current = node;
+    size_type position = index;
+    while (position == current->count_ && current->parent_ != nullptr) {
+      position = current->position_;
+      current = current->parent_;
+    }
+    if (position == current->count_) return End();
+    return iterator(current, position);
+  }
+
+  /**
+   * @brief Перемещает элемент из src в неинициализированную ячейку dst
+   */
+  static void Relocate(value_type *dst, value_type *src) {
+    new (dst) value_type(std::move(*src));
+    src->~value_type();
+  }
+
+  /**
+   * @brief Перемещает count элементов из src в dst (диапазоны могут
+   * пересекаться). Тривиально копируемые элементы копируются memmove.
+   */
+  static void RelocateRange(value_type *dst, value_type *src,
+                            size_type count) {
+    if (count == 0 || dst == src) return;
+    if constexpr (std::is_trivially_copyable<value_type>::value) {
+      std::memmove(static_cast<void *>(dst), static_cast<const void *>(src),
+                   count * sizeof(value_type));
+    } else if (dst < src) {
+      for (size_type i = 0; i < count; ++i) Relocate(dst + i, src + i);
+    } else {
+      for (size_type i = count; i-- > 0;) Relocate(dst + i, src + i);
+    }
+  }
+
+  static void DestroySlot(Node *node, size_type index) noexcept {
+    node->Slot(index)->~value_type();
+  }
+
+  static void DeleteNode(Node *node) noexcept {
+    for (size_type i = 0; i < node->count_; ++i) DestroySlot(node, i);
+    if (node->leaf_) {
+      delete node;
+    } else {
+      delete static_cast<InternalNode *>(node);
+    }
+  }
+
+  /**
+   * @brief Удаляет поддерево. Рекурсия неглубокая: высота B-дерева - единицы
+   * уровней даже для миллиардов элементов.
+   */
+  static void DestroySubtree(Node *node) noexcept {
+    if (node == nullptr) return;
+    if (!node->leaf_) {
+      for (size_type i = 0; i <= node->count_; ++i) {
+        DestroySubtree(Child(node, i));
+      }
+    }
+    DeleteNode(node);
+  }
+
+  /**
+   * @brief Копирует поддерево node. При исключении уже скопированная часть
+   * удаляется: элементы считаются в count_ по мере создания, а еще не
+   * скопированные потомки равны nullptr.
+   */
+  static Node *CopySubtree(const Node *node, Node *parent) {
+    Node *copy = node->leaf_ ? new Node(true) : new InternalNode();
+    copy->parent_ = parent;
+    copy->position_ = node->position_;
+    try {
+      for (size_type i = 0; i < node->count_; ++i) {
+        new (copy->Slot(i)) value_type(*node->Slot(i));
+        ++copy->count_;
+      }
+      if (!node->leaf_) {
+        for (size_type i = 0; i <= node->count_; ++i) {
+          Child(copy, i) = CopySubtree(Child(node, i), copy);
+        }
+      }
+    } catch (...) {
+      DestroySubtree(copy);
+      throw;
+    }
+    return copy;
+  }
+
+  void CopyFrom(const tree_type &other) {
+    cmp_ = other.cmp_;
+    if (other.root_ == nullptr) return;
+    root_ = CopySubtree(other.root_, nullptr);
+    size_ = other.size_;
+    leftmost_ = rightmost_ = root_;
+    while (!leftmost_->leaf_) leftmost_ = Child(leftmost_, 0);
+    while (!rightmost_->leaf_) {
+      rightmost_ = Child(rightmost_, rightmost_->count_);
+    }
+  }
+
+  Node *root_;
+  // Самый левый и самый правый листья (для begin() и end())
+  Node *leftmost_;
+  Node *rightmost_;
+  size_type size_;
+  key_compare cmp_;
+  KeyOfValue key_of_;
+};
+
+/**
+ * @brief Упорядоченное множество уникальных ключей на B-дереве. Интерфейс
+ * повторяет s21::set (см. предупреждение об итераторах в начале файла).
+ */
+template <class Key, class Compare = std::less<Key>>
+class btree_set {
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const Key &value) const noexcept { return value; }
+  };
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (само значение является ключом)
+  using value_type = key_type;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Внутренний класс для дерева
+  using tree_type = BTree<key_type, value_type, KeyOfValue, key_compare>;
+  // Итераторы константные: ключ нельзя менять на месте
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  btree_set() = default;
+
+  btree_set(std::initializer_list<value_type> const &items)
+      : btree_set(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  btree_set(InputIt first, InputIt last) {
+    assign(first, last);
+  }
+
+  iterator begin() const noexcept { return tree_.Begin(); }
+  iterator end() const noexcept { return tree_.End(); }
+  bool empty() const noexcept { return tree_.Empty(); }
+  size_type size() const noexcept { return tree_.Size(); }
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+  void clear() noexcept { tree_.Clear(); }
+
+  /**
+   * @brief Заменяет содержимое элементами [first, last): из эквивалентных
+   * остается первый. Отсортированный диапазон строится за O(n).
+   */
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.Assign(first, last, true);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.InsertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.InsertUnique(std::move(value));
+  }
+
+  /**
+   * @brief Вставка с подсказкой: если value встает прямо перед hint
+   * (например, в конец при hint == end()), спуск от корня не нужен
+   */
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.EmplaceHint(hint, true, value).first;
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
+
+  /**
+   * @brief Удаляет элемент pos
+   *
+   * @return iterator Следующий элемент (остальные итераторы
+   * недействительны)
+   */
+  iterator erase(const_iterator pos) { return tree_.Erase(pos); }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) { return tree_.EraseKey(key); }
+
+  void swap(btree_set &other) noexcept { tree_.Swap(other.tree_); }
+
+  /**
+   * @brief Переносит из other элементы, ключей которых нет в this
+   */
+  void merge(btree_set &other) { tree_.Merge(other.tree_, true); }
+
+  iterator find(const key_type &key) const { return tree_.Find(key); }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) const {
+    return tree_.LowerBound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree_.UpperBound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return tree_.EqualRange(key);
+  }
+
+  /**
+   * @brief Вставляет args, пропуская ключи, которые уже есть. Итераторы в
+   * результате действительны после всех вставок.
+   */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    auto inserted = tree_.EmplaceMany(true, std::forward<Args>(args)...);
+    return std::vector<std::pair<iterator, bool>>(inserted.begin(),
+                                                  inserted.end());
+  }
+
+ private:
+  tree_type tree_;
+};
+
+/**
+ * @brief Упорядоченное мультимножество на B-дереве. Интерфейс повторяет
+ * s21::multiset (см. предупреждение об итераторах в начале файла).
+ */
+template <class Key, class Compare = std::less<Key>>
+class btree_multiset {
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const Key &value) const noexcept { return value; }
+  };
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (само значение является ключом)
+  using value_type = key_type;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Внутренний класс для дерева
+  using tree_type = BTree<key_type, value_type, KeyOfValue, key_compare>;
+  // Итераторы константные: ключ нельзя менять на месте
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  btree_multiset() = default;
+
+  btree_multiset(std::initializer_list<value_type> const &items)
+      : btree_multiset(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  btree_multiset(InputIt first, InputIt last) {
+    assign(first, last);
+  }
+
+  iterator begin() const noexcept { return tree_.Begin(); }
+  iterator end() const noexcept { return tree_.End(); }
+  bool empty() const noexcept { return tree_.Empty(); }
+  size_type size() const noexcept { return tree_.Size(); }
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+  void clear() noexcept { tree_.Clear(); }
+
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.Assign(first, last, false);
+  }
+
+  /**
+   * @brief Вставляет value после всех элементов с эквивалентным ключом
+   */
+  iterator insert(const value_type &value) { return tree_.Insert(value); }
+  iterator insert(value_type &&value) { return tree_.Insert(std::move(value)); }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.EmplaceHint(hint, false, value).first;
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, false, std::forward<Args>(args)...).first;
+  }
+
+  /**
+   * @brief Удаляет элемент pos
+   *
+   * @return iterator Следующий элемент (остальные итераторы
+   * недействительны)
+   */
+  iterator erase(const_iterator pos) { return tree_.Erase(pos); }
+
+  /**
+   * @brief Удаляет все элементы с ключом key
+   *
+   * @return size_type Количество удаленных элементов
+   */
+  size_type erase(const key_type &key) { return tree_.EraseKey(key); }
+
+  void swap(btree_multiset &other) noexcept { tree_.Swap(other.tree_); }
+
+  /**
+   * @brief Переносит в this все элементы other
+   */
+  void merge(btree_multiset &other) { tree_.Merge(other.tree_, false); }
+
+  size_type count(const key_type &key) const { return tree_.Count(key); }
+  iterator find(const key_type &key) const { return tree_.Find(key); }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  iterator lower_bound(const key_type &key) const {
+    return tree_.LowerBound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree_.UpperBound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return tree_.EqualRange(key);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    auto inserted = tree_.EmplaceMany(false, std::forward<Args>(args)...);
+    return std::vector<std::pair<iterator, bool>>(inserted.begin(),
+                                                  inserted.end());
+  }
+
+ private:
+  tree_type tree_;
+};
+
+/**
+ * @brief Упорядоченный словарь на B-дереве. Интерфейс повторяет s21::map
+ * (см. предупреждение об итераторах в начале файла). Элементы сравниваются
+ * только по ключу, поэтому поиск внутри узла для арифметических ключей
+ * линейный, как у btree_set.
+ */
+template <class Key, class Type, class Compare = std::less<Key>>
+class btree_map {
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const std::pair<const Key, Type> &value) const
+        noexcept {
+      return value.first;
+    }
+  };
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (Type — параметр шаблона)
+  using mapped_type = Type;
+  // Тип данных для пары ключ-значение
+  using value_type = std::pair<const key_type, mapped_type>;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Внутренний класс для дерева
+  using tree_type = BTree<key_type, value_type, KeyOfValue, key_compare>;
+  // Внутренний класс для итератора
+  using iterator = typename tree_type::iterator;
+  // Внутренний класс для константного итератора
+  using const_iterator = typename tree_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  btree_map() = default;
+
+  btree_map(std::initializer_list<value_type> const &items)
+      : btree_map(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  btree_map(InputIt first, InputIt last) {
+    assign(first, last);
+  }
+
+  /**
+   * @brief Возвращает ссылку на значение с ключом key
+   *
+   * @throw std::out_of_range элемента с ключом key нет
+   */
+  mapped_type &at(const key_type &key) {
+    iterator it = tree_.Find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "s21::btree_map::at: No element exists with key equivalent to key");
+    }
+    return it->second;
+  }
+
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<btree_map *>(this)->at(key);
+  }
+
+  /**
+   * @brief Возвращает ссылку на значение с ключом key, вставляя значение
+   * по умолчанию, если ключа нет
+   */
+  mapped_type &operator[](const key_type &key) {
+    return try_emplace(key).first->second;
+  }
+
+  iterator begin() noexcept { return tree_.Begin(); }
+  const_iterator begin() const noexcept { return tree_.Begin(); }
+  iterator end() noexcept { return tree_.End(); }
+  const_iterator end() const noexcept { return tree_.End(); }
+  bool empty() const noexcept { return tree_.Empty(); }
+  size_type size() const noexcept { return tree_.Size(); }
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+  void clear() noexcept { tree_.Clear(); }
+
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_.Assign(first, last, true);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.InsertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_.EmplaceHint(hint, true, value).first;
+  }
+
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_.EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
+
+  /**
+   * @brief Вставляет пару (key, obj) или присваивает obj значению
+   * существующего ключа
+   */
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    std::pair<iterator, bool> result = try_emplace(key, obj);
+    if (!result.second) result.first->second = obj;
+    return result;
+  }
+
+  /**
+   * @brief Вставляет элемент с ключом key и значением из args, если ключа
+   * нет. Если есть, args не используются.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.TryEmplace(key, std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Удаляет элемент pos
+   *
+   * @return iterator Следующий элемент (остальные итераторы
+   * недействительны)
+   */
+  iterator erase(const_iterator pos) { return tree_.Erase(pos); }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) { return tree_.EraseKey(key); }
+
+  void swap(btree_map &other) noexcept { tree_.Swap(other.tree_); }
+
+  /**
+   * @brief Переносит из other элементы, ключей которых нет в this
+   */
+  void merge(btree_map &other) { tree_.Merge(other.tree_, true); }
+
+  iterator find(const key_type &key) { return tree_.Find(key); }
+  const_iterator find(const key_type &key) const { return tree_.Find(key); }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) { return tree_.LowerBound(key); }
+  const_iterator lower_bound(const key_type &key) const {
+    return tree_.LowerBound(key);
+  }
+  iterator upper_bound(const key_type &key) { return tree_.UpperBound(key); }
+  const_iterator upper_bound(const key_type &key) const {
+    return tree_.UpperBound(key);
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return tree_.EqualRange(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return tree_.EqualRange(key);
+  }
+
+  /**
+   * @brief Вставляет args, пропуская ключи, которые уже есть. Итераторы в
+   * результате действительны после всех вставок.
+   */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return tree_.EmplaceMany(true, std::forward<Args>(args)...);
+  }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_BTREE_H_
@@ -0,0 +1,935 @@
+/**
+ * @file s21_concurrent_skiplist.h
+ * @brief Потокобезопасный упорядоченный список с пропусками (skip list) и
+ * построенные на нем контейнеры s21::concurrent_skiplist_set и
+ * s21::concurrent_skiplist_map.
+ *
+ * @details
+ * Реализован "ленивый" список с пропусками (Herlihy, Lev, Luchangco, Shavit,
+ * "A Simple Optimistic Skiplist Algorithm"):
+ * 1) Поиск (find, contains, lower_bound, обход итератором) не берет никаких
+ * блокировок - только читает атомарные указатели.
+ * 2) Вставка и удаление блокируют только узлы-предшественники на тех уровнях,
+ * которые меняют, и проверяют (валидируют), что за время поиска эти узлы не
+ * изменились. Если проверка не прошла, операция повторяется.
+ * 3) Удаление сначала логически помечает узел (marked_), а затем физически
+ * исключает его из всех уровней. Вставка считается завершенной, когда узел
+ * связан на всех уровнях (fully_linked_).
+ *
+ * Освобождение памяти. Исключенный из списка узел может все еще читаться
+ * другими потоками, которые начали поиск раньше, поэтому он передается в
+ * s21::ebr::retire() и удаляется, когда все такие потоки выйдут из своих
+ * критических секций. Каждая операция (и каждый живой итератор) выполняется
+ * в критической секции s21::ebr.
+ *
+ * @warning Пока жив хотя бы один итератор, отложенные узлы (во всех
+ * контейнерах на s21::ebr) не освобождаются. Не храните итераторы дольше,
+ * чем нужно, и не передавайте их в другой поток: критическая секция
+ * привязана к потоку, создавшему итератор.
+ *
+ * Элементы после вставки не изменяются (итераторы константные), в том числе
+ * значения словаря: для обновления значения удалите элемент и вставьте новый.
+ *
+ * Операции swap(), merge() и присваивания не являются атомарными по
+ * отношению к другим операциям над теми же объектами.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_SKIPLIST_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_SKIPLIST_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_ebr.h"
+
+namespace s21 {
+
+template <typename Key, typename Comparator = std::less<Key>>
+class ConcurrentSkipList {
+ private:
+  struct NodeBase;
+  struct Node;
+  struct ConcurrentSkipListIterator;
+
+ public:
+  // Тип элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип ссылки на элемент (элементы не изменяются после вставки)
+  using reference = const key_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const key_type &;
+  // Внутренний класс для итератора
+  using iterator = ConcurrentSkipListIterator;
+  // Итератор и так константный
+  using const_iterator = ConcurrentSkipListIterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Максимальное количество уровней. При вероятности перехода на следующий
+  // уровень 1/2 этого хватает на 2^32 элементов.
+  static constexpr int kMaxLevel = 32;
+
+  /**
+   * @brief Конструктор по умолчанию, создает пустой список
+   */
+  ConcurrentSkipList()
+      : head_(kMaxLevel, head_links_), size_(0U) {
+    head_.fully_linked_.store(true, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Конструктор копирования. Элементы other копируются по одному.
+   *
+   * @param other копируемый объект
+   */
+  ConcurrentSkipList(const ConcurrentSkipList &other) : ConcurrentSkipList() {
+    for (auto it = other.Begin(); it != other.End(); ++it) {
+      InsertUnique(*it);
+    }
+  }
+
+  /**
+   * @brief Конструктор переноса
+   *
+   * @param other переносимый объект
+   */
+  ConcurrentSkipList(ConcurrentSkipList &&other) noexcept
+      : ConcurrentSkipList() {
+    Swap(other);
+  }
+
+  /**
+   * @brief Оператор присваивания копированием
+   */
+  ConcurrentSkipList &operator=(const ConcurrentSkipList &other) {
+    if (this != &other) {
+      Clear();
+      for (auto it = other.Begin(); it != other.End(); ++it) {
+        InsertUnique(*it);
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Оператор присваивания переносом
+   */
+  ConcurrentSkipList &operator=(ConcurrentSkipList &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Деструктор. Вызывается, когда с объектом больше никто не работает,
+   * поэтому узлы списка удаляются сразу. Уже исключенные узлы удалит
+   * s21::ebr: они не ссылаются на сам список.
+   */
+  ~ConcurrentSkipList() {
+    NodeBase *node = head_.next_[0].load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      NodeBase *next = node->next_[0].load(std::memory_order_relaxed);
+      DestroyNode(node);
+      node = next;
+    }
+  }
+
+  /**
+   * @brief Возвращает итератор на наименьший элемент
+   */
+  iterator Begin() const {
+    iterator result(this);
+    result.node_ =
+        NextLinked(head_.next_[0].load(std::memory_order_acquire));
+    return result;
+  }
+
+  /**
+   * @brief Возвращает итератор на конец списка
+   * @details Разыменование end() - UB
+   */
+  iterator End() const noexcept { return iterator(); }
+
+  /**
+   * @brief Количество элементов. При параллельных изменениях значение
+   * может устареть сразу после чтения.
+   */
+  size_type Size() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Проверяет, является ли список пустым
+   */
+  bool Empty() const noexcept { return Size() == 0U; }
+
+  /**
+   * @brief Максимально допустимое количество элементов
+   */
+  size_type MaxSize() const noexcept {
+    return ((std::numeric_limits<size_type>::max() / 2) - sizeof(NodeBase)) /
+           (sizeof(Node) + sizeof(std::atomic<NodeBase *>) * 2);
+  }
+
+  /**
+   * @brief Удаляет все элементы. Элементы, вставленные параллельно с
+   * очисткой, могут остаться в списке.
+   */
+  void Clear() {
+    for (auto it = Begin(); it != End(); ++it) {
+      Erase(*it);
+    }
+  }
+
+  /**
+   * @brief Вставляет элемент, если в списке нет эквивалентного ему.
+   * @details Узел создается только после того, как место вставки найдено и
+   * заблокировано, поэтому неудачная вставка ничего не выделяет.
+   *
+   * @param value Вставляемое значение
+   * @return std::pair<iterator, bool> Итератор на вставленный элемент (или на
+   * элемент, который помешал вставке) и признак вставки
+   */
+  template <typename Value>
+  std::pair<iterator, bool> InsertUnique(Value &&value) {
+    iterator result(this);
+    const int height = RandomHeight();
+    NodeBase *preds[kMaxLevel];
+    NodeBase *succs[kMaxLevel];
+
+    while (true) {
+      int found = FindNode(value, preds, succs);
+      if (found != -1) {
+        NodeBase *node = succs[found];
+        if (!node->marked_.load(std::memory_order_acquire)) {
+          // Эквивалентный элемент уже вставляется другим потоком -
+          // дожидаемся, пока он станет виден на всех уровнях
+          while (!node->fully_linked_.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+          }
+          result.node_ = node;
+          return {result, false};
+        }
+        // Найденный узел удаляется - ждем, пока его исключат из списка
+        continue;
+      }
+
+      LockedNodes locks;
+      bool valid = true;
+      for (int level = 0; valid && level < height; ++level) {
+        locks.Lock(preds[level]);
+        valid = !preds[level]->marked_.load(std::memory_order_acquire) &&
+                (succs[level] == nullptr ||
+                 !succs[level]->marked_.load(std::memory_order_acquire)) &&
+                preds[level]->next_[level].load(std::memory_order_acquire) ==
+                    succs[level];
+      }
+      if (!valid) {
+        continue;
+      }
+
+      Node *node = CreateNode(height, std::forward<Value>(value));
+      for (int level = 0; level < height; ++level) {
+        node->next_[level].store(succs[level], std::memory_order_relaxed);
+      }
+      for (int level = 0; level < height; ++level) {
+        preds[level]->next_[level].store(node, std::memory_order_release);
+      }
+      node->fully_linked_.store(true, std::memory_order_release);
+      size_.fetch_add(1U, std::memory_order_relaxed);
+      result.node_ = node;
+      return {result, true};
+    }
+  }
+
+  /**
+   * @brief Удаляет элемент, эквивалентный key
+   *
+   * @details Здесь и в Find(), Contains(), LowerBound(), UpperBound() тип K
+   * - key_type или любой тип, который компаратор сравнивает с элементами в
+   * обоих порядках (например, ключ словаря без значения).
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  template <typename K>
+  size_type Erase(const K &key) {
+    ebr::guard guard;
+    NodeBase *preds[kMaxLevel];
+    NodeBase *succs[kMaxLevel];
+    NodeBase *victim = nullptr;
+    bool is_marked = false;
+    int height = 0;
+
+    while (true) {
+      int found = FindNode(key, preds, succs);
+      if (!is_marked) {
+        if (found == -1) {
+          return 0U;
+        }
+        victim = succs[found];
+        // Удаляем только полностью вставленный узел, найденный на своем
+        // верхнем уровне
+        if (!victim->fully_linked_.load(std::memory_order_acquire) ||
+            victim->height_ - 1 != found ||
+            victim->marked_.load(std::memory_order_acquire)) {
+          return 0U;
+        }
+        height = victim->height_;
+        victim->lock_.lock();
+        if (victim->marked_.load(std::memory_order_relaxed)) {
+          victim->lock_.unlock();
+          return 0U;
+        }
+        victim->marked_.store(true, std::memory_order_release);
+        is_marked = true;
+      }
+
+      LockedNodes locks;
+      bool valid = true;
+      for (int level = 0; valid && level < height; ++level) {
+        locks.Lock(preds[level]);
+        valid = !preds[level]->marked_.load(std::memory_order_acquire) &&
+                preds[level]->next_[level].load(std::memory_order_acquire) ==
+                    victim;
+      }
+      if (!valid) {
+        continue;
+      }
+
+      for (int level = height - 1; level >= 0; --level) {
+        preds[level]->next_[level].store(
+            victim->next_[level].load(std::memory_order_relaxed),
+            std::memory_order_release);
+      }
+      victim->lock_.unlock();
+      size_.fetch_sub(1U, std::memory_order_relaxed);
+      Retire(victim);
+      return 1U;
+    }
+  }
+
+  /**
+   * @brief Находит элемент, эквивалентный key
+   *
+   * @return iterator Итератор на элемент или End()
+   */
+  template <typename K>
+  iterator Find(const K &key) const {
+    iterator result(this);
+    NodeBase *preds[kMaxLevel];
+    NodeBase *succs[kMaxLevel];
+    int found = FindNode(key, preds, succs);
+    if (found != -1 && IsLinked(succs[found])) {
+      result.node_ = succs[found];
+    }
+    return result;
+  }
+
+  /**
+   * @brief Проверяет наличие элемента, эквивалентного key
+   */
+  template <typename K>
+  bool Contains(const K &key) const { return Find(key) != End(); }
+
+  /**
+   * @brief Возвращает итератор на первый элемент, не меньший key
+   */
+  template <typename K>
+  iterator LowerBound(const K &key) const {
+    return Bound(key, [this](const key_type &value, const K &bound) {
+      return comparator_(value, bound);
+    });
+  }
+
+  /**
+   * @brief Возвращает итератор на первый элемент, больший key
+   */
+  template <typename K>
+  iterator UpperBound(const K &key) const {
+    return Bound(key, [this](const key_type &value, const K &bound) {
+      return !comparator_(bound, value);
+    });
+  }
+
+  /**
+   * @brief Обменивает содержимое списков. Не потокобезопасно.
+   */
+  void Swap(ConcurrentSkipList &other) noexcept {
+    for (int level = 0; level < kMaxLevel; ++level) {
+      NodeBase *next = head_.next_[level].load(std::memory_order_relaxed);
+      head_.next_[level].store(
+          other.head_.next_[level].load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      other.head_.next_[level].store(next, std::memory_order_relaxed);
+    }
+    size_type size = size_.load(std::memory_order_relaxed);
+    size_.store(other.size_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    other.size_.store(size, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Переносит из other элементы, которых нет в this. Элементы, уже
+   * присутствующие в this, остаются в other.
+   */
+  void MergeUnique(ConcurrentSkipList &other) {
+    if (this != &other) {
+      for (auto it = other.Begin(); it != other.End(); ++it) {
+        if (InsertUnique(*it).second) {
+          other.Erase(*it);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Вставляет несколько элементов (аналог EmplaceUnique() дерева)
+   */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> EmplaceUnique(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(args));
+
+    for (auto item : {std::forward<Args>(args)...}) {
+      result.push_back(InsertUnique(std::move(item)));
+    }
+    return result;
+  }
+
+ private:
+  /**
+   * @brief Блокировка узла. Она держится всего несколько присваиваний, поэтому
+   * вместо std::mutex (40 байт) используется однобайтовый спинлок: узел
+   * целиком помещается в одну-две строки кэша.
+   */
+  struct SpinLock {
+    void lock() noexcept {
+      while (locked_.exchange(true, std::memory_order_acquire)) {
+        while (locked_.load(std::memory_order_relaxed)) {
+          std::this_thread::yield();
+        }
+      }
+    }
+    void unlock() noexcept { locked_.store(false, std::memory_order_release); }
+
+    std::atomic<bool> locked_{false};
+  };
+
+  /**
+   * @brief Служебная часть узла: ссылки на следующие узлы на каждом уровне,
+   * блокировка и флаги состояния. Голова списка - NodeBase без значения.
+   */
+  struct NodeBase {
+    NodeBase(int height, std::atomic<NodeBase *> *next)
+        : next_(next),
+          height_(height),
+          marked_(false),
+          fully_linked_(false) {
+      for (int level = 0; level < height; ++level) {
+        next_[level].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    NodeBase(const NodeBase &) = delete;
+    NodeBase &operator=(const NodeBase &) = delete;
+
+    std::atomic<NodeBase *> *next_;
+    int height_;
+    SpinLock lock_;
+    std::atomic<bool> marked_;
+    std::atomic<bool> fully_linked_;
+  };
+
+  /**
+   * @brief Узел со значением
+   */
+  struct Node : NodeBase {
+    template <typename Value>
+    Node(int height, std::atomic<NodeBase *> *next, Value &&value)
+        : NodeBase(height, next), value_(std::forward<Value>(value)) {}
+
+    key_type value_;
+  };
+
+  /**
+   * @brief Итератор списка. Обходит нижний уровень, пропуская удаляемые и
+   * еще не до конца вставленные узлы. Пока итератор жив, узлы, на которые он
+   * может перейти, не освобождаются.
+   */
+  struct ConcurrentSkipListIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = key_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const key_type *;
+    using reference = const key_type &;
+
+    ConcurrentSkipListIterator() noexcept : list_(nullptr), node_(nullptr) {}
+
+    ConcurrentSkipListIterator(const ConcurrentSkipListIterator &other)
+        : list_(other.list_), node_(other.node_) {
+      if (list_ != nullptr) {
+        list_->Enter();
+      }
+    }
+
+    ConcurrentSkipListIterator(ConcurrentSkipListIterator &&other) noexcept
+        : list_(other.list_), node_(other.node_) {
+      other.list_ = nullptr;
+      other.node_ = nullptr;
+    }
+
+    ConcurrentSkipListIterator &operator=(
+        const ConcurrentSkipListIterator &other) {
+      if (this != &other) {
+        if (other.list_ != nullptr) {
+          other.list_->Enter();
+        }
+        if (list_ != nullptr) {
+          list_->Exit();
+        }
+        list_ = other.list_;
+        node_ = other.node_;
+      }
+      return *this;
+    }
+
+    ConcurrentSkipListIterator &operator=(
+        ConcurrentSkipListIterator &&other) noexcept {
+      std::swap(list_, other.list_);
+      std::swap(node_, other.node_);
+      return *this;
+    }
+
+    ~ConcurrentSkipListIterator() {
+      if (list_ != nullptr) {
+        list_->Exit();
+      }
+    }
+
+    reference operator*() const noexcept {
+      return static_cast<Node *>(node_)->value_;
+    }
+
+    pointer operator->() const noexcept {
+      return &static_cast<Node *>(node_)->value_;
+    }
+
+    ConcurrentSkipListIterator &operator++() noexcept {
+      node_ = NextLinked(node_->next_[0].load(std::memory_order_acquire));
+      return *this;
+    }
+
+    ConcurrentSkipListIterator operator++(int) {
+      ConcurrentSkipListIterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const ConcurrentSkipListIterator &other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const ConcurrentSkipListIterator &other) const noexcept {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class ConcurrentSkipList;
+
+    explicit ConcurrentSkipListIterator(const ConcurrentSkipList *list)
+        : list_(list), node_(nullptr) {
+      list_->Enter();
+    }
+
+    const ConcurrentSkipList *list_;
+    NodeBase *node_;
+  };
+
+  /**
+   * @brief Набор заблокированных предшественников. Один и тот же узел может
+   * быть предшественником на нескольких соседних уровнях, но блокируется
+   * один раз. Блокировки снимаются в деструкторе.
+   */
+  struct LockedNodes {
+    LockedNodes() : count_(0) {}
+    LockedNodes(const LockedNodes &) = delete;
+    LockedNodes &operator=(const LockedNodes &) = delete;
+    ~LockedNodes() {
+      while (count_ > 0) {
+        nodes_[--count_]->lock_.unlock();
+      }
+    }
+
+    void Lock(NodeBase *node) {
+      if (count_ == 0 || nodes_[count_ - 1] != node) {
+        node->lock_.lock();
+        nodes_[count_++] = node;
+      }
+    }
+
+    NodeBase *nodes_[kMaxLevel];
+    int count_;
+  };
+
+  /**
+   * @brief Создает узел одним выделением памяти: ссылки на следующие узлы
+   * лежат сразу за узлом, поэтому переход по уровню - один промах кэша.
+   */
+  template <typename Value>
+  static Node *CreateNode(int height, Value &&value) {
+    void *memory = ::operator new(sizeof(Node) +
+                                  sizeof(std::atomic<NodeBase *>) * height);
+    auto *links = reinterpret_cast<std::atomic<NodeBase *> *>(
+        static_cast<char *>(memory) + sizeof(Node));
+    for (int level = 0; level < height; ++level) {
+      new (links + level) std::atomic<NodeBase *>(nullptr);
+    }
+    try {
+      return new (memory) Node(height, links, std::forward<Value>(value));
+    } catch (...) {
+      ::operator delete(memory);
+      throw;
+    }
+  }
+
+  static void DestroyNode(NodeBase *node) noexcept {
+    Node *value_node = static_cast<Node *>(node);
+    value_node->~Node();
+    ::operator delete(value_node);
+  }
+
+  static const key_type &Value(NodeBase *node) noexcept {
+    return static_cast<Node *>(node)->value_;
+  }
+
+  static bool IsLinked(NodeBase *node) noexcept {
+    return node->fully_linked_.load(std::memory_order_acquire) &&
+           !node->marked_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Первый начиная с node узел, который полностью вставлен и не
+   * помечен на удаление
+   */
+  static NodeBase *NextLinked(NodeBase *node) noexcept {
+    while (node != nullptr && !IsLinked(node)) {
+      node = node->next_[0].load(std::memory_order_acquire);
+    }
+    return node;
+  }
+
+  /**
+   * @brief Спуск по уровням в поисках key
+   *
+   * @param preds Последний узел меньше key на каждом уровне
+   * @param succs Следующий за preds узел на каждом уровне
+   * @return int Верхний уровень, на котором найден эквивалентный key узел,
+   * или -1
+   */
+  template <typename K>
+  int FindNode(const K &key, NodeBase **preds, NodeBase **succs) const {
+    int found = -1;
+    NodeBase *pred = const_cast<NodeBase *>(&head_);
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      NodeBase *curr = pred->next_[level].load(std::memory_order_acquire);
+      while (curr != nullptr && comparator_(Value(curr), key)) {
+        pred = curr;
+        curr = pred->next_[level].load(std::memory_order_acquire);
+      }
+      if (found == -1 && curr != nullptr && !comparator_(key, Value(curr))) {
+        found = level;
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    return found;
+  }
+
+  /**
+   * @brief Первый элемент, для которого before(value, key) ложно
+   */
+  template <typename K, typename Before>
+  iterator Bound(const K &key, Before before) const {
+    iterator result(this);
+    NodeBase *pred = const_cast<NodeBase *>(&head_);
+    NodeBase *curr = nullptr;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      curr = pred->next_[level].load(std::memory_order_acquire);
+      while (curr != nullptr && before(Value(curr), key)) {
+        pred = curr;
+        curr = pred->next_[level].load(std::memory_order_acquire);
+      }
+    }
+    result.node_ = NextLinked(curr);
+    return result;
+  }
+
+  /**
+   * @brief Высота нового узла: каждый следующий уровень с вероятностью 1/2
+   */
+  static int RandomHeight() noexcept {
+    thread_local std::uint32_t state = static_cast<std::uint32_t>(
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1U);
+    // xorshift32
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    std::uint32_t bits = state;
+    int height = 1;
+    while (height < kMaxLevel && (bits & 1U)) {
+      ++height;
+      bits >>= 1;
+    }
+    return height;
+  }
+
+  void Enter() const { ebr::enter(); }
+
+  void Exit() const noexcept { ebr::exit(); }
+
+  static void Retire(NodeBase *node) {
+    ebr::retire(node, [](void *retired) {
+      DestroyNode(static_cast<NodeBase *>(retired));
+    });
+  }
+
+  // Ссылки головы списка на всех уровнях
+  std::atomic<NodeBase *> head_links_[kMaxLevel];
+  // Голова списка (служебный узел максимальной высоты без значения)
+  NodeBase head_;
+  // Количество элементов
+  std::atomic<size_type> size_;
+  Comparator comparator_;
+};
+
+/**
+ * @brief Потокобезопасное множество на основе ConcurrentSkipList. Интерфейс
+ * повторяет s21::set.
+ */
+template <class Key>
+class concurrent_skiplist_set {
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (само значение является ключом)
+  using value_type = key_type;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Внутренний класс для списка
+  using skiplist_type = ConcurrentSkipList<value_type>;
+  // Внутренний класс для итератора
+  using iterator = typename skiplist_type::iterator;
+  // Внутренний класс для константного итератора
+  using const_iterator = typename skiplist_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  concurrent_skiplist_set() = default;
+
+  concurrent_skiplist_set(std::initializer_list<value_type> const &items) {
+    for (auto item : items) {
+      insert(item);
+    }
+  }
+
+  iterator begin() const { return list_.Begin(); }
+  iterator end() const noexcept { return list_.End(); }
+  bool empty() const noexcept { return list_.Empty(); }
+  size_type size() const noexcept { return list_.Size(); }
+  size_type max_size() const noexcept { return list_.MaxSize(); }
+  void clear() { list_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return list_.InsertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return list_.InsertUnique(std::move(value));
+  }
+
+  /**
+   * @brief Удаляет элемент, на который указывает pos
+   */
+  void erase(iterator pos) { list_.Erase(*pos); }
+
+  /**
+   * @brief Удаляет элемент, эквивалентный key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) { return list_.Erase(key); }
+
+  void swap(concurrent_skiplist_set &other) noexcept {
+    list_.Swap(other.list_);
+  }
+
+  void merge(concurrent_skiplist_set &other) { list_.MergeUnique(other.list_); }
+
+  iterator find(const key_type &key) const { return list_.Find(key); }
+
+  bool contains(const key_type &key) const { return list_.Contains(key); }
+
+  iterator lower_bound(const key_type &key) const {
+    return list_.LowerBound(key);
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return list_.UpperBound(key);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return list_.EmplaceUnique(std::forward<Args>(args)...);
+  }
+
+ private:
+  skiplist_type list_;
+};
+
+/**
+ * @brief Потокобезопасный словарь на основе ConcurrentSkipList. Интерфейс
+ * повторяет s21::map, но значения после вставки не изменяются: at()
+ * возвращает копию значения, а operator[] отсутствует.
+ */
+template <class Key, class Type>
+class concurrent_skiplist_map {
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (Type — параметр шаблона)
+  using mapped_type = Type;
+  // Тип данных для пары ключ-значение
+  using value_type = std::pair<const key_type, mapped_type>;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+
+  // Элементы равны, если равны их ключи (см. s21::map)
+  struct MapValueComparator {
+    bool operator()(const_reference value1,
+                    const_reference value2) const noexcept {
+      return value1.first < value2.first;
+    }
+    // Сравнения элемента с ключом: поиск по ключу не создает пару и не
+    // требует конструктора значения по умолчанию
+    bool operator()(const key_type &key,
+                    const_reference value) const noexcept {
+      return key < value.first;
+    }
+    bool operator()(const_reference value,
+                    const key_type &key) const noexcept {
+      return value.first < key;
+    }
+  };
+
+  // Внутренний класс для списка
+  using skiplist_type = ConcurrentSkipList<value_type, MapValueComparator>;
+  // Внутренний класс для итератора
+  using iterator = typename skiplist_type::iterator;
+  // Внутренний класс для константного итератора
+  using const_iterator = typename skiplist_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  concurrent_skiplist_map() = default;
+
+  concurrent_skiplist_map(std::initializer_list<value_type> const &items) {
+    for (auto item : items) {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Возвращает копию значения, сопоставленного с key. Ссылку вернуть
+   * нельзя: элемент может быть удален другим потоком.
+   *
+   * @throw std::out_of_range элемента с ключом key нет
+   */
+  mapped_type at(const key_type &key) const {
+    iterator it_search = find(key);
+    if (it_search == end()) {
+      throw std::out_of_range(
+          "s21::concurrent_skiplist_map::at: No element exists with key "
+          "equivalent to key");
+    }
+    return it_search->second;
+  }
+
+  iterator begin() const { return list_.Begin(); }
+  iterator end() const noexcept { return list_.End(); }
+  bool empty() const noexcept { return list_.Empty(); }
+  size_type size() const noexcept { return list_.Size(); }
+  size_type max_size() const noexcept { return list_.MaxSize(); }
+  void clear() { list_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return list_.InsertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return list_.InsertUnique(value_type(key, obj));
+  }
+
+  /**
+   * @brief Удаляет элемент, на который указывает pos
+   */
+  void erase(iterator pos) { list_.Erase(*pos); }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) {
+    return list_.Erase(key);
+  }
+
+  void swap(concurrent_skiplist_map &other) noexcept {
+    list_.Swap(other.list_);
+  }
+
+  void merge(concurrent_skiplist_map &other) { list_.MergeUnique(other.list_); }
+
+  iterator find(const key_type &key) const {
+    return list_.Find(key);
+  }
+
+  bool contains(const key_type &key) const {
+    return list_.Contains(key);
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return list_.LowerBound(key);
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return list_.UpperBound(key);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    return list_.EmplaceUnique(std::forward<Args>(args)...);
+  }
+
+ private:
+  skiplist_type list_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_SKIPLIST_H_
@@ -0,0 +1,360 @@
+/**
+ * @file s21_concurrent_stack.h
+ * @brief s21::concurrent_stack - стек без блокировок (стек Трайбера) с
+ * безопасным освобождением памяти через указатели опасности (hazard
+ * pointers) и массивом исключения (elimination) для высокой конкуренции.
+ *
+ * @details Вершина стека head_ меняется одним CAS:
+ * 1) push: новый узел ссылается на текущую вершину и становится вершиной.
+ * 2) pop: вершина заменяется своим next_.
+ *
+ * Проблема ABA и освобождение памяти. Перед чтением head_->next_ поток
+ * публикует адрес вершины в своей записи опасности (HazardRecord). Узел,
+ * снятый со стека, не удаляется сразу, а попадает в список отложенных
+ * (retired_) той же записи. Когда список вырастает, узлы, адресов которых
+ * нет ни в одной записи, удаляются. Пока узел опубликован, его память не
+ * переиспользуется, поэтому CAS не может спутать его с новым узлом по тому
+ * же адресу.
+ *
+ * Записи опасности принадлежат стеку и захватываются на время одной
+ * операции, поэтому потоки не нужно регистрировать, а после завершения
+ * потока не остается его данных.
+ *
+ * Массив исключения: если CAS на head_ не удался из-за конкуренции, push
+ * оставляет узел в случайной ячейке массива и немного ждет. pop, тоже
+ * проигравший CAS, может забрать узел прямо из ячейки. Такая пара push/pop
+ * "взаимно уничтожается", не трогая head_, и нагрузка на вершину падает.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+template <typename T>
+class concurrent_stack {
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  concurrent_stack()
+      : head_(nullptr),
+        id_(NextStackId()),
+        records_(nullptr),
+        record_count_(0U) {
+    for (auto &slot : elimination_) {
+      slot.store(0U, std::memory_order_relaxed);
+    }
+  }
+
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+  /**
+   * @brief Уничтожает стек. Параллельных операций в этот момент быть не
+   * должно.
+   */
+  ~concurrent_stack() {
+    Node *node = head_.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node *next = node->next_;
+      delete node;
+      node = next;
+    }
+    HazardRecord *record = records_.load(std::memory_order_relaxed);
+    while (record != nullptr) {
+      HazardRecord *next = record->next_;
+      for (Node *retired : record->retired_) {
+        delete retired;
+      }
+      delete record;
+      record = next;
+    }
+  }
+
+  /**
+   * @brief Кладет элемент на вершину стека
+   */
+  void push(const_reference value) { PushNode(new Node(value)); }
+  void push(value_type &&value) { PushNode(new Node(std::move(value))); }
+
+  /**
+   * @brief Создает элемент из args на вершине стека
+   */
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    PushNode(new Node(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Снимает элемент с вершины стека
+   *
+   * @param value Сюда переносится снятый элемент
+   * @return false стек пуст
+   */
+  bool try_pop(reference value) {
+    HazardRecord *record = AcquireRecord();
+    Node *head = nullptr;
+    for (;;) {
+      head = head_.load(std::memory_order_acquire);
+      if (head == nullptr) {
+        record->Release();
+        return false;
+      }
+      // Публикуем вершину и проверяем, что она не сменилась: иначе узел
+      // могли удалить до публикации
+      record->hazard_.store(head, std::memory_order_seq_cst);
+      if (head_.load(std::memory_order_seq_cst) != head) {
+        continue;
+      }
+      if (head_.compare_exchange_strong(head, head->next_,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed)) {
+        break;
+      }
+      Node *partner = TryEliminatePop();
+      if (partner != nullptr) {
+        // Узел из массива исключения никогда не был в стеке, и забрать его
+        // мог только этот поток
+        record->Release();
+        value = std::move(partner->value_);
+        delete partner;
+        return true;
+      }
+    }
+    record->hazard_.store(nullptr, std::memory_order_release);
+    value = std::move(head->value_);
+    Retire(record, head);
+    record->Release();
+    return true;
+  }
+
+  /**
+   * @brief Пуст ли стек. При параллельной работе значение может устареть
+   * сразу после чтения.
+   */
+  bool empty() const noexcept {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+ private:
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args &&...args)
+        : value_(std::forward<Args>(args)...), next_(nullptr) {}
+
+    value_type value_;
+    Node *next_;
+  };
+
+  /**
+   * @brief Запись опасности: опубликованный адрес и отложенные узлы.
+   * Записи только добавляются в список и живут до уничтожения стека.
+   */
+  struct HazardRecord {
+    HazardRecord() : active_(true), hazard_(nullptr), next_(nullptr) {}
+
+    void Release() noexcept {
+      hazard_.store(nullptr, std::memory_order_release);
+      active_.store(false, std::memory_order_release);
+    }
+
+    std::atomic<bool> active_;
+    std::atomic<Node *> hazard_;
+    HazardRecord *next_;
+    // Узлы, снятые владельцем записи и ожидающие удаления
+    std::vector<Node *> retired_;
+    // Буфер для опубликованных адресов при очистке retired_
+    std::vector<Node *> scratch_;
+  };
+
+  // Запись, которой поток пользовался последней. Стек узнается по
+  // уникальному номеру, а не по адресу: по адресу уничтоженного стека может
+  // оказаться новый.
+  struct RecordHint {
+    std::uint64_t stack_id_;
+    HazardRecord *record_;
+  };
+
+  // Размер массива исключения
+  static constexpr size_type kEliminationSlots = 16U;
+  // Сколько итераций push ждет партнера в ячейке
+  static constexpr int kEliminationSpins = 64;
+  // Отметка ячейки: узел из нее забрал pop
+  static constexpr std::uintptr_t kTaken = 1U;
+  // Минимальное число отложенных узлов, после которого запускается очистка
+  static constexpr size_type kScanThreshold = 64U;
+
+  void PushNode(Node *node) {
+    node->next_ = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      if (head_.compare_exchange_weak(node->next_, node,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+        return;
+      }
+      if (TryEliminatePush(node)) {
+        return;
+      }
+      node->next_ = head_.load(std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Оставляет узел в случайной ячейке массива исключения и ждет pop
+   *
+   * @return true узел забрал pop
+   */
+  bool TryEliminatePush(Node *node) {
+    auto &slot = elimination_[NextRandom() % kEliminationSlots];
+    std::uintptr_t expected = 0U;
+    auto mine = reinterpret_cast<std::uintptr_t>(node);
+    if (!slot.compare_exchange_strong(expected, mine,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    for (int i = 0; i < kEliminationSpins; ++i) {
+      if (slot.load(std::memory_order_relaxed) == kTaken) {
+        break;
+      }
+    }
+    expected = mine;
+    if (slot.compare_exchange_strong(expected, 0U, std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+      // Никто не забрал: возвращаемся к стеку
+      return false;
+    }
+    // Ячейка помечена kTaken, и только этот поток ее очищает. Поэтому
+    // другой push не может положить в нее узел по тому же адресу, пока мы
+    // не закончили
+    slot.store(0U, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Пробует забрать узел, оставленный push в массиве исключения
+   */
+  Node *TryEliminatePop() {
+    auto &slot = elimination_[NextRandom() % kEliminationSlots];
+    std::uintptr_t value = slot.load(std::memory_order_acquire);
+    if (value == 0U || value == kTaken) {
+      return nullptr;
+    }
+    if (!slot.compare_exchange_strong(value, kTaken,
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return reinterpret_cast<Node *>(value);
+  }
+
+  /**
+   * @brief Захватывает свободную запись опасности или добавляет новую
+   */
+  HazardRecord *AcquireRecord() {
+    // Обычно свободна запись, которой поток пользовался в прошлый раз
+    RecordHint &hint = LastRecord();
+    if (hint.stack_id_ == id_ &&
+        !hint.record_->active_.exchange(true, std::memory_order_acquire)) {
+      return hint.record_;
+    }
+    HazardRecord *record = FindOrAddRecord();
+    hint.stack_id_ = id_;
+    hint.record_ = record;
+    return record;
+  }
+
+  HazardRecord *FindOrAddRecord() {
+    for (HazardRecord *record = records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next_) {
+      if (!record->active_.load(std::memory_order_relaxed) &&
+          !record->active_.exchange(true, std::memory_order_acquire)) {
+        return record;
+      }
+    }
+    auto *record = new HazardRecord();
+    record->next_ = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(record->next_, record,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    record_count_.fetch_add(1U, std::memory_order_relaxed);
+    return record;
+  }
+
+  /**
+   * @brief Откладывает удаление узла. Когда отложенных узлов заметно
+   * больше, чем записей, удаляет все неопубликованные.
+   */
+  void Retire(HazardRecord *record, Node *node) {
+    record->retired_.push_back(node);
+    if (record->retired_.size() <
+        2U * record_count_.load(std::memory_order_relaxed) + kScanThreshold) {
+      return;
+    }
+    std::vector<Node *> &hazards = record->scratch_;
+    hazards.clear();
+    for (HazardRecord *other = records_.load(std::memory_order_acquire);
+         other != nullptr; other = other->next_) {
+      Node *hazard = other->hazard_.load(std::memory_order_seq_cst);
+      if (hazard != nullptr) {
+        hazards.push_back(hazard);
+      }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    auto &retired = record->retired_;
+    auto kept = std::partition(retired.begin(), retired.end(),
+                               [&hazards](Node *candidate) {
+                                 return std::binary_search(
+                                     hazards.begin(), hazards.end(), candidate);
+                               });
+    for (auto it = kept; it != retired.end(); ++it) {
+      delete *it;
+    }
+    retired.erase(kept, retired.end());
+  }
+
+  static RecordHint &LastRecord() noexcept {
+    thread_local RecordHint hint{0U, nullptr};
+    return hint;
+  }
+
+  static std::uint64_t NextStackId() noexcept {
+    static std::atomic<std::uint64_t> counter(0U);
+    return counter.fetch_add(1U, std::memory_order_relaxed) + 1U;
+  }
+
+  static std::uint32_t NextRandom() noexcept {
+    thread_local std::uint32_t state = static_cast<std::uint32_t>(
+        std::hash<std::thread::id>()(std::this_thread::get_id()) | 1U);
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  alignas(64) std::atomic<Node *> head_;
+  const std::uint64_t id_;
+  alignas(64) std::atomic<HazardRecord *> records_;
+  std::atomic<size_type> record_count_;
+  // Ячейки массива исключения: 0 - пусто, kTaken - узел забран, иначе
+  // адрес узла, ожидающего pop
+  alignas(64) std::atomic<std::uintptr_t> elimination_[kEliminationSlots];
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_CONCURRENT_STACK_H_
@@ -0,0 +1,388 @@
+/**
+ * @file s21_ebr.h
+ * @brief s21::ebr - освобождение памяти на основе эпох (epoch-based
+ * reclamation) для потокобезопасных контейнеров без блокировок.
+ *
+ * @details Контейнер без блокировок не может удалить исключенный узел сразу:
+ * другой поток мог прочитать указатель на него раньше и еще не закончил
+ * работу. EBR откладывает удаление до момента, когда таких потоков
+ * гарантированно не осталось:
+ * 1) Поток, работающий с общими узлами, находится в критической секции
+ * (enter()/exit() или s21::ebr::guard) и объявляет в своей записи текущую
+ * глобальную эпоху.
+ * 2) Исключенный узел передается в retire() и попадает в список ожидания
+ * (limbo) потока с пометкой текущей эпохи.
+ * 3) Глобальная эпоха увеличивается на 1, только когда все потоки в
+ * критических секциях объявили текущую эпоху. Поэтому когда эпоха выросла на
+ * 2 с момента retire(), ни один поток не может держать указатель на узел, и
+ * его можно удалить.
+ *
+ * Продвижение эпохи амортизировано: каждая kAdvanceInterval-я операция
+ * retire() потока пробует продвинуть эпоху (проход по записям потоков) и
+ * освобождает свои списки ожидания. collect() делает то же явно.
+ *
+ * Потоки регистрируются автоматически при первом обращении, а при
+ * завершении потока его запись освобождается для повторного использования,
+ * и неосвобожденные узлы передаются в общий список "сирот", который
+ * освобождают другие потоки.
+ *
+ * Все контейнеры используют одну общую систему эпох, поэтому поток,
+ * надолго оставшийся в критической секции, задерживает освобождение памяти
+ * во всех контейнерах. Критическая секция привязана к потоку: объект guard
+ * нельзя передавать в другой поток.
+ *
+ * Пример:
+ * @code
+ * {
+ *   s21::ebr::guard guard;
+ *   Node *node = head.load();
+ *   if (node != nullptr && head.compare_exchange_strong(node, node->next)) {
+ *     s21::ebr::retire(node);  // delete node, когда станет безопасно
+ *   }
+ * }
+ * @endcode
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_EBR_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_EBR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+class ebr {
+ public:
+  // Тип для размера
+  using size_type = std::size_t;
+  // Функция, удаляющая отложенный объект
+  using deleter_type = void (*)(void *);
+
+  // Каждая какая по счету retire() потока пробует продвинуть эпоху
+  static constexpr size_type kAdvanceInterval = 64U;
+
+  /**
+   * @brief Критическая секция на время жизни объекта. Секции могут быть
+   * вложенными.
+   */
+  class guard {
+   public:
+    guard() { enter(); }
+    guard(const guard &) = delete;
+    guard &operator=(const guard &) = delete;
+    ~guard() { exit(); }
+  };
+
+  ebr() = delete;
+
+  /**
+   * @brief Регистрирует текущий поток. Вызывать не обязательно: поток
+   * регистрируется при первом обращении.
+   */
+  static void register_thread() { Register(Local()); }
+
+  /**
+   * @brief Снимает регистрацию текущего потока (например, перед долгим
+   * простоем потока из пула). Неосвобожденные объекты потока передаются
+   * другим потокам. Поток не должен находиться в критической секции.
+   */
+  static void unregister_thread() { Unregister(Local()); }
+
+  /**
+   * @brief Входит в критическую секцию: пока поток в ней, объекты,
+   * переданные в retire() после входа, не удаляются
+   */
+  static void enter() {
+    ThreadState &state = Local();
+    if (state.nesting_++ == 0U) {
+      Record *record = Register(state);
+      std::uint64_t epoch =
+          GetGlobal().epoch_.load(std::memory_order_acquire);
+      // RMW с seq_cst упорядочивает объявление эпохи перед всеми
+      // следующими чтениями общих указателей
+      record->state_.exchange(Active(epoch), std::memory_order_seq_cst);
+    }
+  }
+
+  /**
+   * @brief Выходит из критической секции
+   */
+  static void exit() noexcept {
+    ThreadState &state = Local();
+    if (state.nesting_ > 0U && --state.nesting_ == 0U) {
+      Record *record = state.record_;
+      record->state_.store(
+          record->state_.load(std::memory_order_relaxed) & ~kActiveBit,
+          std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Находится ли текущий поток в критической секции
+   */
+  static bool in_critical_section() noexcept {
+    return Local().nesting_ > 0U;
+  }
+
+  /**
+   * @brief Откладывает удаление объекта ptr функцией deleter до момента,
+   * когда ни один поток не сможет к нему обратиться. Объект уже должен быть
+   * недоступен для новых читателей.
+   */
+  static void retire(void *ptr, deleter_type deleter) {
+    ThreadState &state = Local();
+    Register(state);
+    std::uint64_t epoch = GetGlobal().epoch_.load(std::memory_order_acquire);
+    Limbo &limbo = state.limbo_[epoch % kLimboLists];
+    if (limbo.epoch_ != epoch) {
+      // В этом списке объекты эпохи не позже epoch - 3: их уже можно
+      // удалить
+      state.pending_ -= limbo.items_.size();
+      FreeLimbo(limbo);
+      limbo.epoch_ = epoch;
+    }
+    limbo.items_.push_back({ptr, deleter});
+    ++state.pending_;
+    if (++state.retire_count_ % kAdvanceInterval == 0U) {
+      Collect(state);
+    }
+  }
+
+  /**
+   * @brief Откладывает delete ptr
+   */
+  template <typename T>
+  static void retire(T *ptr) {
+    retire(static_cast<void *>(ptr),
+           [](void *object) { delete static_cast<T *>(object); });
+  }
+
+  /**
+   * @brief Пробует продвинуть эпоху и освобождает все объекты текущего
+   * потока (и завершившихся потоков), которые уже безопасно удалить
+   */
+  static void collect() { Collect(Local()); }
+
+  /**
+   * @brief Количество объектов текущего потока, ожидающих удаления
+   */
+  static size_type pending() noexcept { return Local().pending_; }
+
+  /**
+   * @brief Текущая глобальная эпоха
+   */
+  static std::uint64_t epoch() noexcept {
+    return GetGlobal().epoch_.load(std::memory_order_acquire);
+  }
+
+ private:
+  // Списков ожидания у потока три: текущая эпоха и две предыдущие
+  static constexpr size_type kLimboLists = 3U;
+  // Младший бит состояния записи: поток в критической секции
+  static constexpr std::uint64_t kActiveBit = 1U;
+
+  struct Retired {
+    void *ptr_;
+    deleter_type deleter_;
+  };
+
+  struct Limbo {
+    std::uint64_t epoch_ = 0U;
+    std::vector<Retired> items_;
+  };
+
+  /**
+   * @brief Запись потока: объявленная эпоха и признак критической секции.
+   * Записи только добавляются в общий список, а после завершения потока
+   * переиспользуются.
+   */
+  struct Record {
+    Record() : state_(0U), in_use_(true), next_(nullptr) {}
+
+    // (эпоха << 1) | kActiveBit
+    alignas(64) std::atomic<std::uint64_t> state_;
+    std::atomic<bool> in_use_;
+    Record *next_;
+  };
+
+  /**
+   * @brief Состояние потока. Деструктор срабатывает при завершении потока.
+   */
+  struct ThreadState {
+    ThreadState() = default;
+    ThreadState(const ThreadState &) = delete;
+    ThreadState &operator=(const ThreadState &) = delete;
+    ~ThreadState() {
+      nesting_ = 0U;
+      Unregister(*this);
+    }
+
+    Record *record_ = nullptr;
+    size_type nesting_ = 0U;
+    size_type retire_count_ = 0U;
+    size_type pending_ = 0U;
+    Limbo limbo_[kLimboLists];
+  };
+
+  /**
+   * @brief Общее состояние: глобальная эпоха, записи потоков и объекты
+   * завершившихся потоков
+   */
+  struct Global {
+    Global() : epoch_(kLimboLists), records_(nullptr) {}
+    Global(const Global &) = delete;
+    Global &operator=(const Global &) = delete;
+
+    // Вызывается при завершении программы, когда остальные потоки уже
+    // завершены
+    ~Global() {
+      for (Limbo &limbo : orphans_) {
+        for (Retired &item : limbo.items_) {
+          item.deleter_(item.ptr_);
+        }
+      }
+      Record *record = records_.load(std::memory_order_relaxed);
+      while (record != nullptr) {
+        Record *next = record->next_;
+        delete record;
+        record = next;
+      }
+    }
+
+    alignas(64) std::atomic<std::uint64_t> epoch_;
+    alignas(64) std::atomic<Record *> records_;
+    std::mutex orphans_mutex_;
+    std::vector<Limbo> orphans_;
+  };
+
+  static Global &GetGlobal() {
+    static Global global;
+    return global;
+  }
+
+  static ThreadState &Local() {
+    thread_local ThreadState state;
+    return state;
+  }
+
+  static std::uint64_t Active(std::uint64_t epoch) noexcept {
+    return (epoch << 1U) | kActiveBit;
+  }
+
+  /**
+   * @brief Закрепляет за потоком свободную запись или добавляет новую
+   */
+  static Record *Register(ThreadState &state) {
+    if (state.record_ != nullptr) {
+      return state.record_;
+    }
+    Global &global = GetGlobal();
+    for (Record *record = global.records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next_) {
+      if (!record->in_use_.load(std::memory_order_relaxed) &&
+          !record->in_use_.exchange(true, std::memory_order_acquire)) {
+        state.record_ = record;
+        return record;
+      }
+    }
+    auto *record = new Record();
+    record->next_ = global.records_.load(std::memory_order_relaxed);
+    while (!global.records_.compare_exchange_weak(
+        record->next_, record, std::memory_order_release,
+        std::memory_order_relaxed)) {
+    }
+    state.record_ = record;
+    return record;
+  }
+
+  static void Unregister(ThreadState &state) {
+    if (state.record_ == nullptr) {
+      return;
+    }
+    Global &global = GetGlobal();
+    {
+      std::lock_guard<std::mutex> lock(global.orphans_mutex_);
+      for (Limbo &limbo : state.limbo_) {
+        if (!limbo.items_.empty()) {
+          global.orphans_.push_back(std::move(limbo));
+          limbo.items_.clear();
+        }
+      }
+    }
+    state.pending_ = 0U;
+    state.record_->state_.store(0U, std::memory_order_release);
+    state.record_->in_use_.store(false, std::memory_order_release);
+    state.record_ = nullptr;
+  }
+
+  /**
+   * @brief Продвигает эпоху, если все потоки в критических секциях уже
+   * объявили текущую
+   */
+  static void TryAdvance() {
+    Global &global = GetGlobal();
+    std::uint64_t epoch = global.epoch_.load(std::memory_order_seq_cst);
+    for (Record *record = global.records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next_) {
+      std::uint64_t state = record->state_.load(std::memory_order_seq_cst);
+      if ((state & kActiveBit) != 0U && state != Active(epoch)) {
+        return;
+      }
+    }
+    global.epoch_.compare_exchange_strong(epoch, epoch + 1U,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed);
+  }
+
+  static void Collect(ThreadState &state) {
+    TryAdvance();
+    Global &global = GetGlobal();
+    std::uint64_t epoch = global.epoch_.load(std::memory_order_acquire);
+    for (Limbo &limbo : state.limbo_) {
+      if (limbo.epoch_ + 2U <= epoch) {
+        state.pending_ -= limbo.items_.size();
+        FreeLimbo(limbo);
+      }
+    }
+    // Объекты завершившихся потоков освобождает тот, кто первым успел
+    std::unique_lock<std::mutex> lock(global.orphans_mutex_,
+                                      std::try_to_lock);
+    if (lock.owns_lock() && !global.orphans_.empty()) {
+      std::vector<Limbo> garbage;
+      auto &orphans = global.orphans_;
+      for (size_type i = 0; i < orphans.size();) {
+        if (orphans[i].epoch_ + 2U <= epoch) {
+          garbage.push_back(std::move(orphans[i]));
+          orphans[i] = std::move(orphans.back());
+          orphans.pop_back();
+        } else {
+          ++i;
+        }
+      }
+      lock.unlock();
+      for (Limbo &limbo : garbage) {
+        FreeLimbo(limbo);
+      }
+    }
+  }
+
+  static void FreeLimbo(Limbo &limbo) {
+    // Деструктор объекта может сам вызвать retire(), поэтому список
+    // сначала забирается
+    std::vector<Retired> items;
+    items.swap(limbo.items_);
+    for (Retired &item : items) {
+      item.deleter_(item.ptr_);
+    }
+    // Возвращаем буфер, чтобы не выделять память заново в следующей эпохе
+    if (limbo.items_.empty()) {
+      items.clear();
+      limbo.items_.swap(items);
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_EBR_H_
@@ -0,0 +1,587 @@
+/**
+ * @file s21_intrusive_list.h
+ * @brief s21::intrusive_list - двусвязный список, который связывает сами
+ * объекты через встроенный в них хук (intrusive_list_hook) и никогда не
+ * выделяет память.
+ *
+ * @details В s21::list<T *> на каждый элемент выделяется отдельный узел, а при
+ * переходе к объекту добавляется лишнее разыменование. Интрузивный список
+ * хранит указатели next/prev прямо внутри объекта:
+ *
+ *   struct Timer {
+ *     int deadline;
+ *     s21::intrusive_list_hook hook;
+ *   };
+ *   s21::intrusive_list<Timer, &Timer::hook> timers;
+ *
+ * Список не владеет объектами: он не копирует, не создает и не удаляет их.
+ * Временем жизни объектов управляет пользователь (например, пул). Объект
+ * должен быть исключен из списка до своего уничтожения.
+ *
+ * Так как по хуку однозначно находится объект и наоборот, то исключение
+ * объекта из списка (erase(T&)), перенос элементов (splice) и получение
+ * итератора на объект (iterator_to) выполняются за O(1).
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+/**
+ * @brief Хук, который встраивается в объект для связывания его в
+ * s21::intrusive_list. У несвязанного хука оба указателя равны nullptr.
+ *
+ * @details При копировании объекта хук не копируется: копия объекта не
+ * состоит ни в одном списке.
+ */
+struct intrusive_list_hook {
+  intrusive_list_hook() noexcept : next_(nullptr), prev_(nullptr) {}
+  intrusive_list_hook(const intrusive_list_hook &) noexcept
+      : intrusive_list_hook() {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  /**
+   * @brief Проверяет, состоит ли объект с этим хуком в каком-либо списке
+   */
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+  intrusive_list_hook *next_;
+  intrusive_list_hook *prev_;
+};
+
+template <typename T, intrusive_list_hook T::*Hook>
+class intrusive_list {
+ private:
+  struct IntrusiveListIterator;
+  struct IntrusiveListConstIterator;
+
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Внутренний класс для итератора
+  using iterator = IntrusiveListIterator;
+  // Внутренний класс для константного итератора
+  using const_iterator = IntrusiveListConstIterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+  // Тип хука
+  using hook_type = intrusive_list_hook;
+
+  /**
+   * @brief Конструктор по умолчанию, создает пустой список
+   */
+  intrusive_list() noexcept : size_(0U) { InitializeSentinel(); }
+
+  /**
+   * @brief Копирование запрещено: объект может состоять только в одном
+   * списке через один хук
+   */
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  /**
+   * @brief Конструктор переноса. Все объекты other переходят в новый список.
+   */
+  intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+    swap(other);
+  }
+
+  /**
+   * @brief Оператор присваивания переносом. Объекты текущего списка
+   * исключаются из него (но не удаляются).
+   */
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Деструктор. Исключает все объекты из списка, сами объекты не
+   * затрагиваются.
+   */
+  ~intrusive_list() { clear(); }
+
+  // Доступ к элементам
+
+  reference front() {
+    CheckNotEmpty();
+    return *begin();
+  }
+
+  const_reference front() const {
+    CheckNotEmpty();
+    return *begin();
+  }
+
+  reference back() {
+    CheckNotEmpty();
+    return *--end();
+  }
+
+  const_reference back() const {
+    CheckNotEmpty();
+    return *--end();
+  }
+
+  // Итераторы
+
+  iterator begin() noexcept { return iterator(sentinel_.next_); }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next_);
+  }
+
+  iterator end() noexcept { return iterator(&sentinel_); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<hook_type *>(&sentinel_));
+  }
+
+  /**
+   * @brief Возвращает итератор на объект value, который состоит в этом
+   * списке. O(1), поиск не выполняется.
+   */
+  iterator iterator_to(reference value) noexcept {
+    return iterator(&(value.*Hook));
+  }
+
+  const_iterator iterator_to(const_reference value) const noexcept {
+    return const_iterator(const_cast<hook_type *>(&(value.*Hook)));
+  }
+
+  // Информация о наполнении
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  // Изменение контейнера
+
+  /**
+   * @brief Исключает все объекты из списка. Хуки объектов сбрасываются.
+   */
+  void clear() noexcept {
+    hook_type *node = sentinel_.next_;
+    while (node != &sentinel_) {
+      hook_type *next = node->next_;
+      node->next_ = nullptr;
+      node->prev_ = nullptr;
+      node = next;
+    }
+    InitializeSentinel();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Встраивает объект value перед pos
+   *
+   * @return iterator Итератор на value
+   */
+  iterator insert(iterator pos, reference value) {
+    hook_type *hook = &(value.*Hook);
+    if (hook->is_linked()) {
+      throw std::invalid_argument("Object is already linked");
+    }
+    LinkBefore(pos.node_, hook);
+    ++size_;
+    return iterator(hook);
+  }
+
+  /**
+   * @brief Исключает из списка объект на позиции pos
+   *
+   * @return iterator Итератор на элемент, следующий за исключенным
+   */
+  iterator erase(iterator pos) {
+    if (pos.node_ == &sentinel_) {
+      throw std::invalid_argument("Erase error");
+    }
+    hook_type *next = pos.node_->next_;
+    Unlink(pos.node_);
+    --size_;
+    return iterator(next);
+  }
+
+  /**
+   * @brief Исключает объект value из списка за O(1)
+   *
+   * @throw std::invalid_argument value не состоит в списке
+   */
+  void erase(reference value) {
+    if (!(value.*Hook).is_linked()) {
+      throw std::invalid_argument("Object is not linked");
+    }
+    erase(iterator_to(value));
+  }
+
+  void push_back(reference value) { insert(end(), value); }
+
+  void push_front(reference value) { insert(begin(), value); }
+
+  void pop_back() {
+    CheckNotEmpty();
+    erase(--end());
+  }
+
+  void pop_front() {
+    CheckNotEmpty();
+    erase(begin());
+  }
+
+  /**
+   * @brief Обменивает содержимое списков
+   */
+  void swap(intrusive_list &other) noexcept {
+    std::swap(sentinel_.next_, other.sentinel_.next_);
+    std::swap(sentinel_.prev_, other.sentinel_.prev_);
+    std::swap(size_, other.size_);
+    FixSentinel();
+    other.FixSentinel();
+  }
+
+  /**
+   * @brief Переносит все объекты other перед pos за O(1)
+   */
+  void splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    hook_type *next = pos.node_;
+    hook_type *prev = next->prev_;
+    prev->next_ = other.sentinel_.next_;
+    other.sentinel_.next_->prev_ = prev;
+    next->prev_ = other.sentinel_.prev_;
+    other.sentinel_.prev_->next_ = next;
+    size_ += other.size_;
+    other.InitializeSentinel();
+    other.size_ = 0;
+  }
+
+  /**
+   * @brief Переносит один объект it из other перед pos за O(1)
+   */
+  void splice(const_iterator pos, intrusive_list &other, iterator it) {
+    if (!it.node_->is_linked()) {
+      throw std::invalid_argument("Object is not linked");
+    }
+    if (pos.node_ == it.node_ || pos.node_ == it.node_->next_) {
+      return;
+    }
+    other.erase(it);
+    LinkBefore(pos.node_, it.node_);
+    ++size_;
+  }
+
+  /**
+   * @brief Объединяет два отсортированных списка, перепривязывая хуки. other
+   * после операции пуст.
+   */
+  void merge(intrusive_list &other) { merge(other, std::less<value_type>()); }
+
+  template <typename Compare>
+  void merge(intrusive_list &other, Compare cmp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    hook_type *first = MergeChains(Detach(), other.Detach(), cmp);
+    size_ += other.size_;
+    other.size_ = 0;
+    Attach(first);
+  }
+
+  /**
+   * @brief Разворачивает список
+   */
+  void reverse() noexcept {
+    hook_type *node = &sentinel_;
+    do {
+      std::swap(node->next_, node->prev_);
+      node = node->prev_;
+    } while (node != &sentinel_);
+  }
+
+  /**
+   * @brief Исключает из списка последовательно повторяющиеся объекты
+   * (объекты остаются живыми, у них сбрасывается хук)
+   */
+  void unique() {
+    if (size_ < 2) {
+      return;
+    }
+    iterator it = begin();
+    iterator next = it;
+    ++next;
+    while (next != end()) {
+      if (*it == *next) {
+        next = erase(next);
+      } else {
+        it = next;
+        ++next;
+      }
+    }
+  }
+
+  /**
+   * @brief Сортирует список слиянием, перепривязывая хуки. Объекты не
+   * копируются и не перемещаются. O(n log n).
+   */
+  void sort() { sort(std::less<value_type>()); }
+
+  template <typename Compare>
+  void sort(Compare cmp) {
+    if (size_ < 2) {
+      return;
+    }
+    Attach(SortChain(Detach(), size_, cmp));
+  }
+
+ private:
+  struct IntrusiveListIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = T *;
+    using reference = T &;
+
+    explicit IntrusiveListIterator(hook_type *node) : node_(node) {}
+
+    reference operator*() const noexcept { return *ToValue(node_); }
+    pointer operator->() const noexcept { return ToValue(node_); }
+
+    iterator &operator++() noexcept {
+      node_ = node_->next_;
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    iterator &operator--() noexcept {
+      node_ = node_->prev_;
+      return *this;
+    }
+
+    iterator operator--(int) noexcept {
+      iterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const iterator &other) const noexcept {
+      return node_ != other.node_;
+    }
+
+    hook_type *node_;
+  };
+
+  struct IntrusiveListConstIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T *;
+    using reference = const T &;
+
+    explicit IntrusiveListConstIterator(hook_type *node) : node_(node) {}
+    IntrusiveListConstIterator(const iterator &it) : node_(it.node_) {}
+
+    reference operator*() const noexcept { return *ToValue(node_); }
+    pointer operator->() const noexcept { return ToValue(node_); }
+
+    const_iterator &operator++() noexcept {
+      node_ = node_->next_;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    const_iterator &operator--() noexcept {
+      node_ = node_->prev_;
+      return *this;
+    }
+
+    const_iterator operator--(int) noexcept {
+      const_iterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    friend bool operator==(const const_iterator &it1,
+                           const const_iterator &it2) noexcept {
+      return it1.node_ == it2.node_;
+    }
+
+    friend bool operator!=(const const_iterator &it1,
+                           const const_iterator &it2) noexcept {
+      return it1.node_ != it2.node_;
+    }
+
+    hook_type *node_;
+  };
+
+  /**
+   * @brief Возвращает смещение хука внутри объекта T
+   *
+   * @details Объекта T под рукой нет, а брать член у памяти без объекта
+   * нельзя. Зато в Itanium C++ ABI (GCC, Clang) указатель на член данных
+   * представлен именно смещением члена в байтах, поэтому смещение читается
+   * из представления Hook. Оно вычисляется один раз при первом вызове.
+   */
+  static std::ptrdiff_t HookOffset() noexcept {
+    using hook_pointer = hook_type T::*;
+    static_assert(sizeof(hook_pointer) == sizeof(std::ptrdiff_t),
+                  "pointer to data member is expected to be an offset");
+    static const std::ptrdiff_t offset = [] {
+      hook_pointer hook = Hook;
+      std::ptrdiff_t bytes = 0;
+      std::memcpy(&bytes, &hook, sizeof(bytes));
+      return bytes;
+    }();
+    return offset;
+  }
+
+  /**
+   * @brief Возвращает объект, в который встроен хук node
+   */
+  static T *ToValue(hook_type *node) noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(node) -
+                                 HookOffset());
+  }
+
+  static void LinkBefore(hook_type *next, hook_type *node) noexcept {
+    node->next_ = next;
+    node->prev_ = next->prev_;
+    next->prev_->next_ = node;
+    next->prev_ = node;
+  }
+
+  static void Unlink(hook_type *node) noexcept {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    node->next_ = nullptr;
+    node->prev_ = nullptr;
+  }
+
+  /**
+   * @brief Отцепляет цепочку объектов от служебного узла и возвращает её
+   * первый узел. Цепочка связана только по next_ и завершается nullptr.
+   * size_ не меняется.
+   */
+  hook_type *Detach() noexcept {
+    hook_type *first = sentinel_.next_;
+    sentinel_.prev_->next_ = nullptr;
+    InitializeSentinel();
+    return first;
+  }
+
+  /**
+   * @brief Подвешивает цепочку, связанную по next_, к служебному узлу и
+   * восстанавливает указатели prev_
+   */
+  void Attach(hook_type *first) noexcept {
+    hook_type *prev = &sentinel_;
+    for (hook_type *node = first; node != nullptr; node = node->next_) {
+      prev->next_ = node;
+      node->prev_ = prev;
+      prev = node;
+    }
+    prev->next_ = &sentinel_;
+    sentinel_.prev_ = prev;
+  }
+
+  template <typename Compare>
+  static hook_type *MergeChains(hook_type *left, hook_type *right,
+                                Compare &cmp) {
+    hook_type head;
+    hook_type *tail = &head;
+    while (left != nullptr && right != nullptr) {
+      // При равенстве берем элемент левой цепочки, чтобы сортировка была
+      // устойчивой
+      if (cmp(*ToValue(right), *ToValue(left))) {
+        tail->next_ = right;
+        right = right->next_;
+      } else {
+        tail->next_ = left;
+        left = left->next_;
+      }
+      tail = tail->next_;
+    }
+    tail->next_ = left != nullptr ? left : right;
+    return head.next_;
+  }
+
+  template <typename Compare>
+  static hook_type *SortChain(hook_type *first, size_type count,
+                              Compare &cmp) {
+    if (count < 2) {
+      if (first != nullptr) {
+        first->next_ = nullptr;
+      }
+      return first;
+    }
+    size_type half = count / 2;
+    hook_type *middle = first;
+    for (size_type i = 0; i < half; ++i) {
+      middle = middle->next_;
+    }
+    hook_type *right = SortChain(middle, count - half, cmp);
+    // Левая половина обрезается внутри рекурсивного вызова (next_ ее
+    // последнего узла обнуляется на глубине count < 2)
+    hook_type *left = SortChain(first, half, cmp);
+    return MergeChains(left, right, cmp);
+  }
+
+  void CheckNotEmpty() const {
+    if (empty()) {
+      throw std::out_of_range("Container is empty");
+    }
+  }
+
+  void InitializeSentinel() noexcept {
+    sentinel_.next_ = &sentinel_;
+    sentinel_.prev_ = &sentinel_;
+  }
+
+  void FixSentinel() noexcept {
+    if (size_ == 0) {
+      InitializeSentinel();
+    } else {
+      sentinel_.next_->prev_ = &sentinel_;
+      sentinel_.prev_->next_ = &sentinel_;
+    }
+  }
+
+  // Служебный узел, через который зациклен список
+  hook_type sentinel_;
+  // Количество объектов в списке
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_INTRUSIVE_LIST_H_
@@ -4,8 +4,10 @@
 #include <cmath>
 #include <exception>
 #include <initializer_list>
+#include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -24,33 +26,41 @@ class list {
   list(const list& l);
   list(list&& l);
   ~list();
-  list operator=(list&& l);
-  list operator=(const list& l);
+  list& operator=(list&& l);
+  list& operator=(const list& l);
 
   // List Element access
-  const_reference front();
-  const_reference back();
+  reference front();
+  reference back();
 
   // List Capacity
   bool empty();
   size_type size();
   size_type max_size();
 
-  struct Node {
+  // Links of a node. The list sentinel (end_) is a bare NodeBase without a
+  // value, so T does not have to be constructible from anything.
+  struct NodeBase {
+    NodeBase* next_;
+    NodeBase* prev_;
+  };
+
+  struct Node : NodeBase {
     value_type value_;
-    Node* next_;
-    Node* prev_;
-    Node(const value_type& value)
-        : value_(value), next_(nullptr), prev_(nullptr){};
+    template <typename... Args>
+    Node(Args&&... args)
+        : NodeBase{nullptr, nullptr}, value_(std::forward<Args>(args)...){};
   };
 
   template <typename value_type>
   class ListIterator {
    public:
-    ListIterator(Node* node) : current_(node){};
+    ListIterator(NodeBase* node, const NodeBase* end)
+        : current_(node), end_(end){};
     reference operator*() {
-      if (current_) {
-        return current_->value_;
+      // The sentinel (end()) has no value
+      if (current_ && current_ != end_) {
+        return static_cast<Node*>(current_)->value_;
       }
       throw std::invalid_argument("Iterator points to nullptr!");
     }
@@ -63,26 +73,28 @@ class list {
       return *this;
     };
     ListIterator operator+(const int n) {
-      Node* tmp = current_;
+      NodeBase* tmp = current_;
       for (int i = 0; i < n; ++i) {
         current_ = current_->next_;
       }
-      ListIterator it(tmp);
+      ListIterator it(tmp, end_);
       return it;
     };
     ListIterator operator-(const int n) {
-      Node* tmp = current_;
+      NodeBase* tmp = current_;
       for (int i = 0; i < n; ++i) {
         current_ = current_->prev_;
       }
-      ListIterator it(tmp);
+      ListIterator it(tmp, end_);
       return it;
     };
     bool operator!=(ListIterator other) { return current_ != other.current_; };
     bool operator==(ListIterator other) { return current_ == other.current_; };
 
    private:
-    Node* current_ = nullptr;
+    NodeBase* current_ = nullptr;
+    // Sentinel of the list the iterator belongs to
+    const NodeBase* end_ = nullptr;
     friend class list<value_type>;  // необходимо френдить, так как в функции
                                     // листа приваты итератора не видно
   };
@@ -106,13 +118,16 @@ class list {
   const_iterator begin() const;
   const_iterator end() const;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
 
   // List Modifiers
   void clear();
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
   void pop_front();
   void swap(list& other);
   void merge(list& other);
@@ -121,6 +136,16 @@ class list {
   void unique();
   void sort();
 
+  // Emplace functions (value is constructed in place inside the node)
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+
   // Help functions
   void print_list();
 
@@ -135,13 +160,15 @@ class list {
   void insert_many_front(Args&&... args);
 
  private:
-  Node* head_;
-  Node* tail_;
-  Node* end_;
+  // Circular sentinel: end_.next_ is the first node, end_.prev_ is the last
+  NodeBase end_;
   size_type size_;
 
   // Help functions
-  void rewrite_end();
+  void init_end();
+  void fix_end();
+  void link_before(NodeBase* pos, NodeBase* node);
+  void unlink(NodeBase* node);
 };
 }  // namespace s21
 
@@ -149,16 +176,14 @@ class list {
 namespace s21 {
 // List Functions
 template <typename value_type>
-list<value_type>::list()
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
-  end_ = new Node(size());
-  rewrite_end();
+list<value_type>::list() : end_{nullptr, nullptr}, size_(0) {
+  init_end();
 };
 
 template <typename value_type>
 list<value_type>::list(size_type n) : list<value_type>::list() {
   for (size_type i = 0; i < n; ++i) {
-    push_back(0);
+    emplace_back();
   }
 }
 
@@ -180,15 +205,14 @@ list<value_type>::list(const list& l) : list<value_type>::list() {
 }
 
 template <typename value_type>
-list<value_type>::list(list&& l)
-    : head_(nullptr), tail_(nullptr), end_(nullptr), size_(0) {
+list<value_type>::list(list&& l) : list<value_type>::list() {
   if (this != &l) {
     this->swap(l);
   }
 }
 
 template <typename value_type>
-s21::list<value_type> s21::list<value_type>::operator=(const list& l) {
+s21::list<value_type>& s21::list<value_type>::operator=(const list& l) {
   if (this != &l) {
     clear();
     for (auto it = l.begin(); it != l.end(); ++it) {
@@ -199,7 +223,7 @@ s21::list<value_type> s21::list<value_type>::operator=(const list& l) {
 }
 
 template <typename value_type>
-s21::list<value_type> s21::list<value_type>::operator=(list&& l) {
+s21::list<value_type>& s21::list<value_type>::operator=(list&& l) {
   if (this != &l) {
     clear();
     this->swap(l);
@@ -210,30 +234,18 @@ s21::list<value_type> s21::list<value_type>::operator=(list&& l) {
 template <typename value_type>
 list<value_type>::~list() {
   clear();
-  if (end_) {
-    delete end_;
-  }
 }
 
 // List Modifiers
 template <typename value_type>
 void list<value_type>::pop_back() {
-  Node* tmp = tail_;
   if (empty()) {
     throw std::out_of_range(
         "Unable to remove the element from empty container");
-  } else if (size() == 1) {
-    tmp = tail_;
-    tail_ = nullptr;
-    head_ = nullptr;
-  } else if (size() > 1) {
-    tmp = tail_;
-    tail_ = tail_->prev_;
-    tail_->next_ = nullptr;
   }
-  delete tmp;
-  --size_;
-  rewrite_end();
+  NodeBase* tmp = end_.prev_;
+  unlink(tmp);
+  delete static_cast<Node*>(tmp);
 }
 
 template <typename value_type>
@@ -242,55 +254,56 @@ void list<value_type>::pop_front() {
     throw std::out_of_range(
         "Unable to remove the element from empty container");
   }
-  Node* tmp = head_;
-  if (size() == 1) {
-    tail_ = nullptr;
-    head_ = nullptr;
-  } else if (size() > 0) {
-    head_ = head_->next_;
-    head_->prev_ = nullptr;
-  }
-  delete tmp;
-  --size_;
-  rewrite_end();
+  NodeBase* tmp = end_.next_;
+  unlink(tmp);
+  delete static_cast<Node*>(tmp);
 }
 
 template <typename value_type>
 void list<value_type>::push_back(const_reference value) {
-  Node* last = new Node(value);
-  if (empty()) {
-    head_ = last;
-    tail_ = last;
-  } else {
-    tail_->next_ = last;
-    last->prev_ = tail_;
-    tail_ = last;
-  }
-  ++size_;
-  rewrite_end();
+  emplace_back(value);
+}
+
+template <typename value_type>
+void list<value_type>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
 }
 
 template <typename value_type>
 void list<value_type>::push_front(const_reference value) {
-  Node* last = new Node(value);
-  if (empty()) {
-    head_ = last;
-    tail_ = last;
-  } else {
-    head_->prev_ = last;
-    last->next_ = head_;
-    head_ = last;
-  }
-  ++size_;
-  rewrite_end();
+  emplace_front(value);
+}
+
+template <typename value_type>
+void list<value_type>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename value_type>
+template <typename... Args>
+typename list<value_type>::reference list<value_type>::emplace_back(
+    Args&&... args) {
+  Node* last = new Node(std::forward<Args>(args)...);
+  link_before(&end_, last);
+  return last->value_;
+}
+
+template <typename value_type>
+template <typename... Args>
+typename list<value_type>::reference list<value_type>::emplace_front(
+    Args&&... args) {
+  Node* first = new Node(std::forward<Args>(args)...);
+  link_before(end_.next_, first);
+  return first->value_;
 }
 
 template <typename value_type>
 void list<value_type>::swap(list& other) {
-  std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
-  std::swap(end_, other.end_);
+  std::swap(end_.next_, other.end_.next_);
+  std::swap(end_.prev_, other.end_.prev_);
   std::swap(size_, other.size_);
+  fix_end();
+  other.fix_end();
 }
 
 template <typename value_type>
@@ -300,7 +313,6 @@ void list<value_type>::merge(list& other) {
       for (iterator it = other.begin(); it != other.end(); ++it) {
         push_back(*it);
       }
-      rewrite_end();
       sort();
     }
   }
@@ -312,7 +324,7 @@ void list<value_type>::unique() {
     iterator it = begin();
     ++it;
     for (; it != end(); ++it) {
-      if (*it == it.current_->prev_->value_) {
+      if (*it == static_cast<Node*>(it.current_->prev_)->value_) {
         iterator deleted = (it - 1);
         erase(deleted);
       }
@@ -322,23 +334,26 @@ void list<value_type>::unique() {
 
 template <typename value_type>
 void list<value_type>::reverse() {
-  if (!empty()) {
-    iterator it = begin();
-    for (size_type el = 0; el < size() + 1; ++el) {
-      std::swap(it.current_->prev_, it.current_->next_);
-      ++it;
-    }
-  }
-  std::swap(head_, tail_);
+  NodeBase* node = &end_;
+  do {
+    std::swap(node->prev_, node->next_);
+    node = node->prev_;
+  } while (node != &end_);
 }
 
 template <typename value_type>
 void list<value_type>::splice(const_iterator pos, list& other) {
-  if (!other.empty()) {
-    for (iterator it = other.begin(); it != other.end(); ++it) {
-      insert(pos, *it);
-    }
-    other.clear();
+  if (this != &other && !other.empty()) {
+    // Relink the whole chain of other in front of pos, no copies
+    NodeBase* next = pos.current_;
+    NodeBase* prev = next->prev_;
+    prev->next_ = other.end_.next_;
+    other.end_.next_->prev_ = prev;
+    next->prev_ = other.end_.prev_;
+    other.end_.prev_->next_ = next;
+    size_ += other.size_;
+    other.size_ = 0;
+    other.init_end();
   }
 }
 
@@ -357,89 +372,66 @@ void list<value_type>::sort() {
 
 // List Element access
 template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::front() {
-  return head_->value_;
+typename list<value_type>::reference list<value_type>::front() {
+  return static_cast<Node*>(end_.next_)->value_;
 };
 
 template <typename value_type>
-typename list<value_type>::const_reference list<value_type>::back() {
-  return tail_->value_;
+typename list<value_type>::reference list<value_type>::back() {
+  return static_cast<Node*>(end_.prev_)->value_;
 };
 
 // List Iterators
 template <typename value_type>
 typename list<value_type>::iterator list<value_type>::begin() {
-  return iterator(head_);
+  return iterator(end_.next_, &end_);
 }
 
 template <typename value_type>
 typename list<value_type>::iterator list<value_type>::end() {
-  return iterator(end_);
+  return iterator(&end_, &end_);
 }
 
 template <typename value_type>
 typename list<value_type>::const_iterator list<value_type>::begin() const {
-  return const_iterator(head_);
+  return const_iterator(iterator(end_.next_, &end_));
 }
 
 template <typename value_type>
 typename list<value_type>::const_iterator list<value_type>::end() const {
-  return const_iterator(end_);
+  NodeBase* sentinel = const_cast<NodeBase*>(&end_);
+  return const_iterator(iterator(sentinel, sentinel));
 }
 
 template <typename value_type>
 typename list<value_type>::iterator list<value_type>::insert(
     iterator pos, const_reference value) {
-  Node* newNode = new Node(value);
-  Node* curNode = pos.current_;
-  if (empty()) {
-    newNode->next_ = end_;
-    newNode->prev_ = end_;
-    head_ = newNode;
-    tail_ = newNode;
-  } else {
-    if (curNode == head_) {
-      head_ = newNode;
-    } else if (curNode == end_) {
-      tail_ = newNode;
-    }
-    newNode->next_ = curNode;
-    newNode->prev_ = curNode->prev_;
-    curNode->prev_->next_ = newNode;
-    curNode->prev_ = newNode;
-  }
-  ++size_;
-  rewrite_end();
-  return iterator(newNode);
+  return emplace(pos, value);
+}
+
+template <typename value_type>
+typename list<value_type>::iterator list<value_type>::insert(
+    iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename value_type>
+template <typename... Args>
+typename list<value_type>::iterator list<value_type>::emplace(
+    const_iterator pos, Args&&... args) {
+  Node* newNode = new Node(std::forward<Args>(args)...);
+  link_before(pos.current_, newNode);
+  return iterator(newNode, &end_);
 }
 
 template <typename value_type>
 void list<value_type>::erase(iterator pos) {
-  Node* curNode = pos.current_;
-  if (empty() || curNode == end_) {
+  NodeBase* curNode = pos.current_;
+  if (empty() || curNode == &end_) {
     throw std::invalid_argument("Erase error");
   }
-  if (curNode == head_) {
-    if (curNode->next_ && curNode->next_ != end_) {
-      head_ = curNode->next_;
-    } else {
-      head_ = end_;
-    }
-
-  } else if (curNode == tail_) {
-    if (curNode->prev_ && curNode->prev_ != end_) {
-      tail_ = curNode->prev_;
-    } else {
-      tail_ = end_;
-    }
-  }
-  curNode->prev_->next_ = curNode->next_;
-  curNode->next_->prev_ = curNode->prev_;
-  --size_;
-  curNode->next_ = nullptr;
-  curNode->prev_ = nullptr;
-  curNode->value_ = 0;
-  delete curNode;
+  unlink(curNode);
+  delete static_cast<Node*>(curNode);
 }
 
 // List Capacity
@@ -463,26 +455,52 @@ typename list<value_type>::size_type list<value_type>::max_size() {
 
 template <typename value_type>
 void list<value_type>::clear() {
-  while (!empty()) {
-    pop_back();
+  NodeBase* node = end_.next_;
+  while (node != &end_) {
+    NodeBase* next = node->next_;
+    delete static_cast<Node*>(node);
+    node = next;
   }
+  size_ = 0;
+  init_end();
 }
 
 template <typename value_type>
-void list<value_type>::rewrite_end() {
-  if (end_) {
-    end_->next_ = head_;
-    end_->prev_ = tail_;
-    end_->value_ = size();
-  }
-  if (head_) {
-    head_->prev_ = end_;
-  }
-  if (tail_) {
-    tail_->next_ = end_;
+void list<value_type>::init_end() {
+  end_.next_ = &end_;
+  end_.prev_ = &end_;
+}
+
+// After the node chains of two lists were exchanged, the outer nodes still
+// point to the sentinel of the other list
+template <typename value_type>
+void list<value_type>::fix_end() {
+  if (empty()) {
+    init_end();
+  } else {
+    end_.next_->prev_ = &end_;
+    end_.prev_->next_ = &end_;
   }
 }
 
+template <typename value_type>
+void list<value_type>::link_before(NodeBase* pos, NodeBase* node) {
+  node->next_ = pos;
+  node->prev_ = pos->prev_;
+  pos->prev_->next_ = node;
+  pos->prev_ = node;
+  ++size_;
+}
+
+template <typename value_type>
+void list<value_type>::unlink(NodeBase* node) {
+  node->prev_->next_ = node->next_;
+  node->next_->prev_ = node->prev_;
+  node->next_ = nullptr;
+  node->prev_ = nullptr;
+  --size_;
+}
+
 template <typename value_type>
 void list<value_type>::print_list() {
   if (size()) {
@@ -502,7 +520,7 @@ template <typename... Args>
 typename list<value_type>::iterator list<value_type>::insert_many(
     const_iterator pos, Args&&... args) {
   iterator it = pos;
-  (insert(it, args), ...);
+  (emplace(it, std::forward<Args>(args)), ...);
 
   return it;
 }
@@ -510,13 +528,13 @@ typename list<value_type>::iterator list<value_type>::insert_many(
 template <typename value_type>
 template <typename... Args>
 void list<value_type>::insert_many_back(Args&&... args) {
-  (push_back(args), ...);
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
 template <typename value_type>
 template <typename... Args>
 void list<value_type>::insert_many_front(Args&&... args) {
-  (push_front(args), ...);
+  (emplace_front(std::forward<Args>(args)), ...);
 }
 }  // namespace s21
 
@@ -12,16 +12,30 @@
  * определяем собственный компаратор MapValueComparator, который меняет
  * стандартные правила сравнения значений для std::pair.
  *
+ * Ключи сравниваются компаратором Compare (по умолчанию std::less<Key>).
+ * Поиск по ключу (find, at, count, lower_bound и т.д.) никогда не создает
+ * пару с mapped_type. С прозрачным компаратором (например, std::less<>)
+ * искать можно по ключу другого типа, например std::string_view для ключей
+ * std::string, без временного Key.
+ *
+ * Если OrderStatistics равен true, дерево хранит размеры поддеревьев, и
+ * select(), rank() и distance() работают за O(log n). По умолчанию (false)
+ * размеры не хранятся и ничего не стоят.
+ *
  */
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_MAP_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_MAP_H_
 
+#include <functional>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key, class Type>
+template <class Key, class Type, class Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class map {
  public:
   // Тип ключа элемента (Key — параметр шаблона)
@@ -35,24 +49,41 @@ class map {
   // Тип константной ссылки на элемент
   using const_reference = const value_type &;
 
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+
   // Компаратор. Для словаря у нас элементы дерева будут считаться равными,
   // если у них равны ключи, значение пары ключ-значение при этом ни на что не
   // влияет.
   struct MapValueComparator {
-    bool operator()(const_reference value1,
-                    const_reference value2) const noexcept {
-      return value1.first < value2.first;
+    bool operator()(const_reference value1, const_reference value2) const {
+      return cmp_(value1.first, value2.first);
+    }
+    // Сравнения элемента с ключом (key_type или, при прозрачном Compare,
+    // другим типом): для поиска по ключу без создания пары
+    template <typename K>
+    bool operator()(const K &key, const_reference value) const {
+      return cmp_(key, value.first);
+    }
+    template <typename K>
+    bool operator()(const_reference value, const K &key) const {
+      return cmp_(value.first, key);
     }
+
+    key_compare cmp_;
   };
 
   // Внутренний класс для дерева
-  using tree_type = RedBlackTree<value_type, MapValueComparator>;
+  using tree_type =
+      RedBlackTree<value_type, MapValueComparator, OrderStatistics>;
   // Внутренний класс для итератора
   using iterator = typename tree_type::iterator;
   // Внутренний класс для константного итератора
   using const_iterator = typename tree_type::const_iterator;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
 
   /**
    * @brief Конструктор по умолчанию, создает пустой словарь
@@ -65,10 +96,23 @@ class map {
    *
    * @param items Список создаваемых элементов
    */
-  map(std::initializer_list<value_type> const &items) : map() {
-    for (auto item : items) {
-      insert(item);
-    }
+  map(std::initializer_list<value_type> const &items)
+      : map(items.begin(), items.end()) {}
+
+  /**
+   * @brief Конструктор диапазона, создает словарь из элементов [first,
+   * last).
+   *
+   * @details Дерево строится сразу сбалансированным за O(n), если диапазон
+   * отсортирован, и за O(n log n) в противном случае (см.
+   * RedBlackTree::Assign()).
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  map(InputIt first, InputIt last) : map() {
+    assign(first, last);
   }
 
   /**
@@ -129,8 +173,7 @@ class map {
    * @return mapped_type&
    */
   mapped_type &at(const key_type &key) {
-    value_type search_pair(key, mapped_type{});
-    iterator it_search = tree_->Find(search_pair);
+    iterator it_search = tree_->Find(key);
 
     if (it_search == end()) {
       throw std::out_of_range(
@@ -147,7 +190,7 @@ class map {
    * @return const mapped_type&
    */
   const mapped_type &at(const key_type &key) const {
-    return const_cast<map<Key, Type> *>(this)->at(key);
+    return const_cast<map *>(this)->at(key);
   }
 
   /**
@@ -156,7 +199,8 @@ class map {
    * value_type(key, mapped_type{}).
    *
    * @details If an exception is thrown by any operation, the insertion has no
-   * effect
+   * effect. Поиск и вставка выполняются за один спуск по дереву (см.
+   * try_emplace()).
    *
    * @param key
    * @return mapped_type& Ссылка на значение нового элемента, если не
@@ -165,15 +209,7 @@ class map {
    * эквивалентен ключу.
    */
   mapped_type &operator[](const key_type &key) {
-    value_type search_pair(key, mapped_type{});
-    iterator it_search = tree_->Find(search_pair);
-
-    if (it_search == end()) {
-      std::pair<iterator, bool> result = tree_->InsertUnique(search_pair);
-      return (*result.first).second;
-    } else {
-      return (*it_search).second;
-    }
+    return (*try_emplace(key).first).second;
   }
 
   /**
@@ -245,6 +281,19 @@ class map {
    */
   void clear() noexcept { tree_->Clear(); }
 
+  /**
+   * @brief Заменяет содержимое контейнера элементами [first, last): из
+   * элементов с эквивалентным ключом остается первый. Диапазон может указывать
+   * на элементы самого контейнера.
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_->Assign(first, last, true);
+  }
+
   /**
    * @brief Вставляет элемент со значением value в контейнер, если контейнер
    * еще не содержит элемент с эквивалентным ключом.
@@ -259,6 +308,40 @@ class map {
     return tree_->InsertUnique(value);
   }
 
+  /**
+   * @brief Вставляет элемент со значением value как можно ближе к позиции
+   * перед hint, если контейнер еще не содержит элемент с эквивалентным
+   * ключом.
+   *
+   * @details С верной подсказкой (hint - элемент, следующий за value, или
+   * элемент, после которого встанет value) вставка выполняется за
+   * амортизированное O(1), без спуска от корня. Детали - в методе
+   * SearchHintParent() реализации дерева.
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param value Значение элемента для вставки
+   * @return iterator Итератор, указывающий на вставленный элемент (или на
+   * элемент, который предотвратил вставку)
+   */
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_->InsertHint(hint, value, true).first;
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его как можно ближе к позиции
+   * перед hint, если контейнер еще не содержит элемент с эквивалентным
+   * ключом. Подсказка работает так же, как в insert(hint, value).
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param args Аргументы конструктора элемента
+   * @return iterator Итератор, указывающий на вставленный элемент (или на
+   * элемент, который предотвратил вставку)
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_->EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
+
   /**
    * @brief Вставляет элемент c ключом key и со значением obj в контейнер,
    * если контейнер еще не содержит элемент с эквивалентным ключом.
@@ -280,26 +363,48 @@ class map {
    * присваивает obj элементу, соответствующему ключу key. Если ключ не
    * существует, вставляет новое значение value_type(key, obj)
    *
-   * @todo Работает медленнее оригинала с -O3 для 200000 элементов:
-   * std: 31.847 ms
-   * s21: 48.19 ms
-   * Вероятно, необходимо избавится от лишнего прохода по дереву (Find -
-   * первый проход, InsertUnique - второй)
+   * @details Поиск и вставка выполняются за один спуск по дереву (см.
+   * RedBlackTree::FindInsertPosition())
+   *
    * @param key
    * @param obj
    * @return std::pair<iterator, bool>
    */
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj) {
-    iterator result = tree_->Find(value_type{key, obj});
-
-    if (result == end()) {
-      return tree_->InsertUnique(value_type{key, obj});
+    auto position = tree_->FindInsertPosition(key);
+    if (position.found_) {
+      iterator result(position.node_);
+      (*result).second = obj;
+      return {result, false};
     }
+    return {tree_->InsertAt(position, key, obj), true};
+  }
 
-    (*result).second = obj;
-
-    return {result, false};
+  /**
+   * @brief Если в контейнере нет элемента с ключом, эквивалентным key,
+   * вставляет элемент с ключом key и значением, созданным из args. Иначе
+   * ничего не делает, в том числе не создает значение из args.
+   *
+   * @details Поиск и вставка выполняются за один спуск по дереву (см.
+   * RedBlackTree::FindInsertPosition()), элемент создается только при
+   * вставке.
+   *
+   * @param key Ключ элемента
+   * @param args Аргументы конструктора значения
+   * @return std::pair<iterator, bool> Итератор на вставленный (или уже
+   * существующий) элемент и признак того, что вставка произошла
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    auto position = tree_->FindInsertPosition(key);
+    if (position.found_) {
+      return {iterator(position.node_), false};
+    }
+    return {tree_->InsertAt(position, std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...)),
+            true};
   }
 
   /**
@@ -311,6 +416,45 @@ class map {
    */
   void erase(iterator pos) noexcept { tree_->Erase(pos); }
 
+  /**
+   * @brief Удаляет элементы [first, last) за O(log n + k): диапазон
+   * вырезается из дерева и освобождается целиком. Итераторы на остальные
+   * элементы (и last) остаются действительными.
+   */
+  void erase(const_iterator first, const_iterator last) noexcept {
+    tree_->EraseRange(first, last);
+  }
+
+  /**
+   * @brief Удаляет элементы с ключами из [lo, hi)
+   *
+   * @return size_type Количество удаленных элементов
+   */
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    return tree_->EraseKeyRange(lo, hi);
+  }
+
+  /**
+   * @brief Вызывает fn(reference) для элементов с ключами из [lo, hi) по
+   * возрастанию, обходя только нужную часть дерева (без повторных переходов
+   * к следующему элементу). Значения (но не ключи) можно менять.
+   */
+  template <typename Function>
+  void for_each_in_range(const key_type &lo, const key_type &hi,
+                         Function &&fn) {
+    tree_->ForEachInRange(lo, hi, fn);
+  }
+
+  /**
+   * @brief Версия for_each_in_range() для const-объектов: fn получает
+   * const_reference
+   */
+  template <typename Function>
+  void for_each_in_range(const key_type &lo, const key_type &hi,
+                         Function &&fn) const {
+    static_cast<const tree_type *>(tree_)->ForEachInRange(lo, hi, fn);
+  }
+
   /**
    * @brief Обменяет содержимое контейнера на содержимое other
    *
@@ -327,7 +471,41 @@ class map {
    *
    * @param other
    */
-  void merge(map &other) noexcept { tree_->MergeUnique(*other.tree_); }
+  void merge(map &other) { tree_->MergeUnique(*other.tree_); }
+
+  /**
+   * @brief Параллельная версия merge(): половины рекурсии split/join
+   * выполняются задачами scheduler (например, s21::ws_scheduler)
+   */
+  template <typename Scheduler>
+  void merge(map &other, Scheduler &scheduler) {
+    tree_->MergeUnique(*other.tree_, scheduler);
+  }
+
+  /**
+   * @brief Оставляет только элементы, ключи которых есть в other. Значения
+   * other не сравниваются.
+   * @details Детали реализации описаны в методе Intersect() реализации
+   * дерева.
+   */
+  void intersect(const map &other) { tree_->Intersect(*other.tree_); }
+
+  template <typename Scheduler>
+  void intersect(const map &other, Scheduler &scheduler) {
+    tree_->Intersect(*other.tree_, scheduler);
+  }
+
+  /**
+   * @brief Удаляет элементы, ключи которых есть в other.
+   * @details Детали реализации описаны в методе Subtract() реализации
+   * дерева.
+   */
+  void subtract(const map &other) { tree_->Subtract(*other.tree_); }
+
+  template <typename Scheduler>
+  void subtract(const map &other, Scheduler &scheduler) {
+    tree_->Subtract(*other.tree_, scheduler);
+  }
 
   /**
    * @brief Проверяет, есть ли в контейнере элемент с ключом, эквивалентным
@@ -337,10 +515,165 @@ class map {
    * @return true Есть
    * @return false Нет
    */
-  bool contains(const key_type &key) const noexcept {
-    value_type search_pair(key, mapped_type{});
-    iterator it_search = tree_->Find(search_pair);
-    return !(it_search == end());
+  bool contains(const key_type &key) const {
+    return tree_->Find(key) != tree_->End();
+  }
+
+  /**
+   * @brief Находит элемент с ключом, эквивалентным key.
+   *
+   * @param key Искомый ключ
+   * @return iterator Итератор найденного элемента. Если такой элемент не
+   * найден, возвращается end().
+   */
+  iterator find(const key_type &key) { return tree_->Find(key); }
+
+  /**
+   * @brief Версия find() для константного объекта
+   */
+  const_iterator find(const key_type &key) const { return tree_->Find(key); }
+
+  /**
+   * @brief Возвращает количество элементов с ключом, эквивалентным key (0
+   * или 1, т.к. ключи уникальны).
+   */
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * @brief Возвращает итератор на первый элемент, ключ которого не меньше
+   * key, или end().
+   */
+  iterator lower_bound(const key_type &key) { return tree_->LowerBound(key); }
+
+  /**
+   * @brief Версия lower_bound() для const-объектов.
+   */
+  const_iterator lower_bound(const key_type &key) const {
+    return tree_->LowerBound(key);
+  }
+
+  /**
+   * @brief Возвращает итератор на первый элемент, ключ которого больше key,
+   * или end().
+   */
+  iterator upper_bound(const key_type &key) { return tree_->UpperBound(key); }
+
+  /**
+   * @brief Версия upper_bound() для const-объектов.
+   */
+  const_iterator upper_bound(const key_type &key) const {
+    return tree_->UpperBound(key);
+  }
+
+  /**
+   * @brief Возвращает диапазон [lower_bound(key), upper_bound(key)) за один
+   * спуск по дереву (см. RedBlackTree::EqualRange()).
+   */
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return tree_->EqualRange(key);
+  }
+
+  /**
+   * @brief Версия equal_range() для const-объектов.
+   */
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return tree_->EqualRange(key);
+  }
+
+  /**
+   * @brief Возвращает итератор на элемент с индексом index в порядке
+   * сортировки (0 - самый маленький) или end(), если index >= size(). За
+   * O(log n), доступно только при OrderStatistics.
+   */
+  iterator select(size_type index) { return tree_->Select(index); }
+
+  /**
+   * @brief Версия select() для const-объектов.
+   */
+  const_iterator select(size_type index) const { return tree_->Select(index); }
+
+  /**
+   * @brief Возвращает количество элементов с ключом меньше key, т.е. индекс,
+   * который занимает (или занял бы) key. За O(log n), доступно только при
+   * OrderStatistics.
+   */
+  size_type rank(const key_type &key) const { return tree_->Rank(key); }
+
+  /**
+   * @brief Возвращает расстояние от first до last: за O(log n) при
+   * OrderStatistics, иначе за O(n), как std::distance().
+   */
+  difference_type distance(const_iterator first, const_iterator last) const {
+    return tree_->Distance(first, last);
+  }
+
+  /**
+   * @brief Версии поиска для ключа типа K, сравнимого с key_type (например,
+   * std::string_view для ключей std::string). Доступны, только если
+   * компаратор прозрачный (объявляет is_transparent, как std::less<>), и не
+   * создают временный key_type.
+   *
+   * @param key Искомый ключ
+   */
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return tree_->Find(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return tree_->Find(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return tree_->Find(key) != tree_->End();
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) {
+    return tree_->LowerBound(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const {
+    return tree_->LowerBound(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) {
+    return tree_->UpperBound(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const {
+    return tree_->UpperBound(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    return tree_->EqualRange(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const {
+    return tree_->EqualRange(key);
   }
 
   /**
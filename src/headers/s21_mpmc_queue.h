@@ -0,0 +1,209 @@
+/**
+ * @file s21_mpmc_queue.h
+ * @brief s21::mpmc_queue - ограниченная очередь без блокировок для любого
+ * числа производителей и потребителей (алгоритм Д. Вьюкова).
+ *
+ * @details Буфер - кольцо ячеек, у каждой ячейки свой счетчик sequence_:
+ * 1) sequence_ == pos: ячейка свободна для вставки с номером pos.
+ * Производитель захватывает номер CAS-ом на enqueue_pos_, пишет элемент и
+ * публикует его записью sequence_ = pos + 1.
+ * 2) sequence_ == pos + 1: в ячейке готовый элемент для извлечения с номером
+ * pos. Потребитель захватывает номер CAS-ом на dequeue_pos_, забирает
+ * элемент и освобождает ячейку для следующего круга: sequence_ = pos +
+ * capacity.
+ *
+ * Производители и потребители соревнуются только между собой (каждые за
+ * свой индекс), а синхронизация между ними идет через счетчики ячеек, без
+ * общего мьютекса. enqueue_pos_ и dequeue_pos_ лежат в разных строках кэша.
+ *
+ * Очередь не блокирующая: try_push на заполненной и try_pop на пустой
+ * очереди сразу возвращают false.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+template <typename T>
+class mpmc_queue {
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пустую очередь
+   *
+   * @param capacity Максимальное количество элементов, степень двойки не
+   * меньше 2
+   * @throw std::invalid_argument capacity не подходит
+   */
+  explicit mpmc_queue(size_type capacity)
+      : mask_(capacity - 1U),
+        cells_(nullptr),
+        enqueue_pos_(0U),
+        dequeue_pos_(0U) {
+    if (capacity < 2U || (capacity & (capacity - 1U)) != 0U) {
+      throw std::invalid_argument(
+          "mpmc_queue capacity must be a power of two >= 2");
+    }
+    cells_ = new Cell[capacity];
+    for (size_type i = 0; i < capacity; ++i) {
+      cells_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() {
+    size_type enqueue = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+         pos != enqueue; ++pos) {
+      Cell &cell = cells_[pos & mask_];
+      if (cell.engaged_) {
+        cell.Value()->~value_type();
+      }
+    }
+    delete[] cells_;
+  }
+
+  /**
+   * @brief Добавляет элемент, если есть свободное место
+   *
+   * @return false очередь заполнена, элемент не добавлен (rvalue не
+   * забирается)
+   */
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  /**
+   * @brief Создает элемент из args прямо в ячейке, если есть свободное место
+   *
+   * @return false очередь заполнена
+   */
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(sequence) -
+                  static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        // Ячейка свободна: пытаемся захватить номер pos
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Ячейку еще не освободили с прошлого круга: очередь заполнена
+        return false;
+      } else {
+        // Номер уже занял другой производитель
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    try {
+      new (cell->Value()) value_type(std::forward<Args>(args)...);
+      cell->engaged_ = true;
+    } catch (...) {
+      // Номер уже захвачен: публикуем пустую ячейку, чтобы не остановить
+      // потребителей, они ее пропустят
+      cell->engaged_ = false;
+      cell->sequence_.store(pos + 1U, std::memory_order_release);
+      throw;
+    }
+    cell->sequence_.store(pos + 1U, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Извлекает первый элемент, если он есть
+   *
+   * @param value Сюда переносится извлеченный элемент
+   * @return false очередь пуста
+   */
+  bool try_pop(reference value) {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell *cell = &cells_[pos & mask_];
+      size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(sequence) -
+                  static_cast<std::intptr_t>(pos + 1U);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1U,
+                                               std::memory_order_relaxed)) {
+          bool engaged = cell->engaged_;
+          if (engaged) {
+            value_type *slot = cell->Value();
+            value = std::move(*slot);
+            slot->~value_type();
+          }
+          cell->sequence_.store(pos + mask_ + 1U, std::memory_order_release);
+          if (engaged) {
+            return true;
+          }
+          // Пустая ячейка после исключения в конструкторе: берем следующую
+          pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+      } else if (diff < 0) {
+        // Элемент с номером pos еще не опубликован: очередь пуста
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Примерное количество элементов: при параллельной работе значение
+   * может устареть сразу после чтения
+   */
+  size_type size_approx() const noexcept {
+    size_type dequeue = dequeue_pos_.load(std::memory_order_relaxed);
+    size_type enqueue = enqueue_pos_.load(std::memory_order_relaxed);
+    return enqueue > dequeue ? enqueue - dequeue : 0U;
+  }
+
+  bool empty() const noexcept { return size_approx() == 0U; }
+
+  size_type capacity() const noexcept { return mask_ + 1U; }
+
+ private:
+  struct Cell {
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage_));
+    }
+
+    std::atomic<size_type> sequence_;
+    // false, если конструктор элемента выбросил исключение
+    bool engaged_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+  };
+
+  // Неизменяемые после создания поля
+  size_type mask_;
+  Cell *cells_;
+  // Индексы производителей и потребителей в разных строках кэша
+  alignas(64) std::atomic<size_type> enqueue_pos_;
+  // alignas также выравнивает размер объекта до строки кэша, поэтому
+  // соседние объекты не делят строку с dequeue_pos_
+  alignas(64) std::atomic<size_type> dequeue_pos_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_MPMC_QUEUE_H_
@@ -8,15 +8,22 @@
  *
  * Набор реализован в виде красно-черного дерева.
  *
+ * Если OrderStatistics равен true, дерево хранит размеры поддеревьев, и
+ * select(), rank(), count() и distance() работают за O(log n). По умолчанию
+ * (false) размеры не хранятся и ничего не стоят.
+ *
  */
 
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_MULTISET_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_MULTISET_H_
 
+#include <functional>
+
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key>
+template <class Key, class Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class multiset {
  public:
   // Тип ключа элемента (Key — параметр шаблона)
@@ -27,14 +34,18 @@ class multiset {
   using reference = value_type &;
   // Тип константной ссылки на элемент
   using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
   // Внутренний класс для дерева
-  using tree_type = RedBlackTree<value_type>;
+  using tree_type = RedBlackTree<value_type, key_compare, OrderStatistics>;
   // Внутренний класс для итератора
   using iterator = typename tree_type::iterator;
   // Внутренний класс для константного итератора
   using const_iterator = typename tree_type::const_iterator;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
 
   /**
    * @brief Конструктор по умолчанию, создает пустое мультимножество
@@ -47,10 +58,23 @@ class multiset {
    *
    * @param items Список создаваемых элементов
    */
-  multiset(std::initializer_list<value_type> const &items) : multiset() {
-    for (auto item : items) {
-      insert(item);
-    }
+  multiset(std::initializer_list<value_type> const &items)
+      : multiset(items.begin(), items.end()) {}
+
+  /**
+   * @brief Конструктор диапазона, создает мультимножество из элементов [first,
+   * last).
+   *
+   * @details Дерево строится сразу сбалансированным за O(n), если диапазон
+   * отсортирован, и за O(n log n) в противном случае (см.
+   * RedBlackTree::Assign()).
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last) : multiset() {
+    assign(first, last);
   }
 
   /**
@@ -171,6 +195,19 @@ class multiset {
    */
   void clear() noexcept { tree_->Clear(); }
 
+  /**
+   * @brief Заменяет содержимое контейнера элементами [first, last):
+   * эквивалентные элементы сохраняют порядок диапазона. Диапазон может
+   * указывать на элементы самого контейнера.
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_->Assign(first, last, false);
+  }
+
   /**
    * @brief Вставляет элемент со значением value в контейнер. Если в
    * контейнере есть элементы с эквивалентным ключом, вставка выполняется по
@@ -181,6 +218,36 @@ class multiset {
    */
   iterator insert(const value_type &value) { return tree_->Insert(value); }
 
+  /**
+   * @brief Вставляет элемент со значением value как можно ближе к позиции
+   * перед hint.
+   *
+   * @details С верной подсказкой (hint - элемент, следующий за value, или
+   * элемент, после которого встанет value) вставка выполняется за
+   * амортизированное O(1), без спуска от корня. Детали - в методе
+   * SearchHintParent() реализации дерева.
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param value Значение элемента для вставки
+   * @return iterator Итератор, указывающий на вставленный элемент
+   */
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_->InsertHint(hint, value, false).first;
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его как можно ближе к позиции
+   * перед hint. Подсказка работает так же, как в insert(hint, value).
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param args Аргументы конструктора элемента
+   * @return iterator Итератор, указывающий на вставленный элемент
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_->EmplaceHint(hint, false, std::forward<Args>(args)...).first;
+  }
+
   /**
    * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
    * элементы становятся недействительными. Другие ссылки и итераторы не
@@ -190,6 +257,35 @@ class multiset {
    */
   void erase(iterator pos) noexcept { tree_->Erase(pos); }
 
+  /**
+   * @brief Удаляет элементы [first, last) за O(log n + k): диапазон
+   * вырезается из дерева и освобождается целиком. Итераторы на остальные
+   * элементы (и last) остаются действительными.
+   */
+  void erase(const_iterator first, const_iterator last) noexcept {
+    tree_->EraseRange(first, last);
+  }
+
+  /**
+   * @brief Удаляет элементы с ключами из [lo, hi)
+   *
+   * @return size_type Количество удаленных элементов
+   */
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    return tree_->EraseKeyRange(lo, hi);
+  }
+
+  /**
+   * @brief Вызывает fn(const_reference) для элементов с ключами из [lo, hi)
+   * по возрастанию, обходя только нужную часть дерева (без повторных
+   * переходов к следующему элементу)
+   */
+  template <typename Function>
+  void for_each_in_range(const key_type &lo, const key_type &hi,
+                         Function &&fn) const {
+    static_cast<const tree_type *>(tree_)->ForEachInRange(lo, hi, fn);
+  }
+
   /**
    * @brief Обменяет содержимое контейнера на содержимое other
    *
@@ -203,35 +299,52 @@ class multiset {
    *
    * @param other
    */
-  void merge(multiset &other) noexcept { tree_->Merge(*other.tree_); }
+  void merge(multiset &other) { tree_->Merge(*other.tree_); }
 
   /**
-   * @brief Возвращает количество элементов с ключом, эквивалентным key.
+   * @brief Параллельная версия merge(): половины рекурсии split/join
+   * выполняются задачами scheduler (например, s21::ws_scheduler)
+   */
+  template <typename Scheduler>
+  void merge(multiset &other, Scheduler &scheduler) {
+    tree_->Merge(*other.tree_, scheduler);
+  }
+
+  /**
+   * @brief Возвращает количество элементов с ключом, эквивалентным key: за
+   * O(log n) при OrderStatistics, иначе за O(log n + count) (см.
+   * RedBlackTree::Count()).
    *
    * @param key
    * @return size_type
    */
-  size_type count(const key_type &key) const {
-    // Находим первый элемент, который не меньше key
-    auto lower_iterator = lower_bound(key);
-    if (*lower_iterator != key) {
-      // Если этот элемент не равен key, значит количество таких элементов
-      // 0
-      return 0;
-    }
-
-    // Если этот элемент равен key, то двигаем итератор до тех пор, пока не
-    // встретим элемент больше key и на каждом шаге увеличиваем счетчик
-    // result_count
-    auto end_iterator = end();
-    size_type result_count = 0;
-    while (lower_iterator != end_iterator && *lower_iterator == key) {
-      ++result_count;
-      ++lower_iterator;
-    }
-
-    // возвращаем посчитанное в result_count количество
-    return result_count;
+  size_type count(const key_type &key) const { return tree_->Count(key); }
+
+  /**
+   * @brief Возвращает итератор на элемент с индексом index в порядке
+   * сортировки (0 - самый маленький) или end(), если index >= size(). За
+   * O(log n), доступно только при OrderStatistics.
+   */
+  iterator select(size_type index) { return tree_->Select(index); }
+
+  /**
+   * @brief Версия select() для const-объектов.
+   */
+  const_iterator select(size_type index) const { return tree_->Select(index); }
+
+  /**
+   * @brief Возвращает количество элементов меньше key, т.е. индекс, который
+   * занимает (или занял бы) key. За O(log n), доступно только при
+   * OrderStatistics.
+   */
+  size_type rank(const key_type &key) const { return tree_->Rank(key); }
+
+  /**
+   * @brief Возвращает расстояние от first до last: за O(log n) при
+   * OrderStatistics, иначе за O(n), как std::distance().
+   */
+  difference_type distance(const_iterator first, const_iterator last) const {
+    return tree_->Distance(first, last);
   }
 
   /**
@@ -273,12 +386,8 @@ class multiset {
    * элемент больше, чем ключ.
    *
    * Эквивалентно тому, что первый итератор может быть получен с помощью
-   * функции lower_bound(), а второй — с помощью функции upper_bound().
-   *
-   * @todo вызов lower_bound() и upper_bound() внутри функции очень просто, но
-   * не очень эффективно, т.к. делается 2 прохода по дереву. Эффективнее один
-   * раз вызвать lower_bound(), а затем уже посчитать второй итератор от
-   * результата lower_bound().
+   * функции lower_bound(), а второй — с помощью функции upper_bound(), но
+   * оба ищутся за один спуск по дереву (см. RedBlackTree::EqualRange()).
    *
    * @param key ключевое значение, с которым сравниваются элементы
    * @return std::pair<iterator, iterator> Пара итераторов, определяющих
@@ -286,10 +395,7 @@ class multiset {
    * ключа, а второй указывает на первый элемент больше, чем ключ.
    */
   std::pair<iterator, iterator> equal_range(const key_type &key) noexcept {
-    iterator first = lower_bound(key);
-    iterator second = upper_bound(key);
-
-    return std::pair<iterator, iterator>{first, second};
+    return tree_->EqualRange(key);
   }
 
   /**
@@ -300,10 +406,7 @@ class multiset {
    */
   std::pair<const_iterator, const_iterator> equal_range(
       const key_type &key) const noexcept {
-    const_iterator first = lower_bound(key);
-    const_iterator second = upper_bound(key);
-
-    return std::pair<const_iterator, const_iterator>{first, second};
+    return tree_->EqualRange(key);
   }
 
   /**
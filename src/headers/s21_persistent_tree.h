@@ -0,0 +1,882 @@
+/**
+ * @file s21_persistent_tree.h
+ * @brief Персистентное красно-черное дерево PersistentRedBlackTree и
+ * построенные на нем s21::persistent_set и s21::persistent_map со снимками
+ * (snapshot()) за O(1).
+ *
+ * @details Копия s21::map стоит O(n): копируется каждый узел. Здесь узлы
+ * разделяются между версиями дерева и считают ссылки на себя (из родителей
+ * во всех версиях и из корней деревьев), поэтому копия дерева - это еще одна
+ * ссылка на корень.
+ *
+ * Запись копирует путь (path copying): спускаясь от корня, дерево заменяет
+ * копией каждый узел, на который ссылается кто-то еще, а узлы с
+ * единственной ссылкой меняет на месте. Узел с одной ссылкой, все предки
+ * которого тоже принадлежат только этой версии, больше ниоткуда не виден,
+ * поэтому без снимков запись ничего не копирует, а после снимка копирует
+ * O(log n) узлов: путь от корня и соседей пути, которые перекрашиваются или
+ * поворачиваются.
+ *
+ * Балансировка - левостороннее красно-черное дерево (LLRB, Sedgewick):
+ * красными бывают только левые ссылки, а вставка и удаление - рекурсивные
+ * спуски с восстановлением свойств на обратном пути. У узлов нет указателя
+ * на родителя (у разделяемого узла их может быть много), поэтому итератор
+ * хранит путь от корня.
+ *
+ * Потокобезопасность:
+ * 1) Разные объекты дерева можно читать и менять из разных потоков без
+ * блокировок, даже если они разделяют узлы: общий узел никогда не
+ * меняется, а счетчик ссылок атомарный. Например, писатель меняет словарь,
+ * а читатели обходят свои снимки.
+ * 2) Один объект, как и у остальных контейнеров, нельзя менять
+ * одновременно с другими обращениями к нему (в том числе с snapshot()).
+ *
+ * Узлы выделяются через new, а не из пула (RedBlackTreeNodePool): последнюю
+ * ссылку на узел может освободить любой поток.
+ *
+ * @warning Итераторы, ссылки и указатели на элементы - только константные и
+ * становятся недействительными после любой записи в дерево: изменяемые узлы
+ * копируются или удаляются. Итераторы снимка действительны, пока жив снимок.
+ * Если конструктор копирования элемента выбросит исключение во время
+ * записи, дерево останется корректно освобождаемым, но его состояние не
+ * определено. Снимки это не затрагивает.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief Персистентное дерево элементов Value, упорядоченных по ключу
+ * KeyOfValue()(value) компаратором Compare. Ключи уникальны.
+ */
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Compare = std::less<Key>>
+class PersistentRedBlackTree {
+ private:
+  struct Node;
+
+ public:
+  // Тип ключа
+  using key_type = Key;
+  // Тип элемента
+  using value_type = Value;
+  // Компаратор ключей
+  using key_compare = Compare;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
+  using tree_type = PersistentRedBlackTree<Key, Value, KeyOfValue, Compare>;
+
+  // Максимальная высота дерева: в LLRB она не больше удвоенной черной
+  // высоты, а черная высота не больше log2(n + 1)
+  static constexpr size_type kMaxHeight =
+      2 * std::numeric_limits<size_type>::digits;
+
+  /**
+   * @brief Константный двунаправленный итератор. Хранит путь от корня до
+   * текущего узла, т.к. у узлов нет указателя на родителя.
+   */
+  class const_iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename tree_type::value_type;
+    using difference_type = typename tree_type::difference_type;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() noexcept : root_(nullptr), depth_(0) {}
+
+    // Копируется только занятая часть пути
+    const_iterator(const const_iterator &other) noexcept
+        : root_(other.root_), depth_(other.depth_) {
+      std::copy(other.path_, other.path_ + depth_, path_);
+    }
+
+    const_iterator &operator=(const const_iterator &other) noexcept {
+      root_ = other.root_;
+      depth_ = other.depth_;
+      std::copy(other.path_, other.path_ + depth_, path_);
+      return *this;
+    }
+
+    reference operator*() const noexcept { return Current()->value_; }
+    pointer operator->() const noexcept { return &Current()->value_; }
+
+    const_iterator &operator++() noexcept {
+      const Node *node = Current();
+      if (node->right_ != nullptr) {
+        PushLeftmost(node->right_);
+      } else {
+        // Поднимаемся, пока приходим из правого поддерева
+        --depth_;
+        while (depth_ > 0 && path_[depth_ - 1]->right_ == node) {
+          node = path_[--depth_];
+        }
+      }
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator copy(*this);
+      ++*this;
+      return copy;
+    }
+
+    /**
+     * @brief Переход к предыдущему элементу. --end() - последний элемент.
+     */
+    const_iterator &operator--() noexcept {
+      const Node *node = Current();
+      if (node == nullptr) {
+        PushRightmost(root_);
+      } else if (node->left_ != nullptr) {
+        PushRightmost(node->left_);
+      } else {
+        --depth_;
+        while (depth_ > 0 && path_[depth_ - 1]->left_ == node) {
+          node = path_[--depth_];
+        }
+      }
+      return *this;
+    }
+
+    const_iterator operator--(int) noexcept {
+      const_iterator copy(*this);
+      --*this;
+      return copy;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept {
+      return Current() == other.Current();
+    }
+    bool operator!=(const const_iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class PersistentRedBlackTree;
+
+    explicit const_iterator(const Node *root) noexcept
+        : root_(root), depth_(0) {}
+
+    const Node *Current() const noexcept {
+      return depth_ == 0 ? nullptr : path_[depth_ - 1];
+    }
+
+    void Push(const Node *node) noexcept { path_[depth_++] = node; }
+
+    void PushLeftmost(const Node *node) noexcept {
+      for (; node != nullptr; node = node->left_) Push(node);
+    }
+
+    void PushRightmost(const Node *node) noexcept {
+      for (; node != nullptr; node = node->right_) Push(node);
+    }
+
+    const Node *root_;
+    size_type depth_;
+    const Node *path_[kMaxHeight];
+  };
+
+  using iterator = const_iterator;
+
+  PersistentRedBlackTree() noexcept : root_(nullptr), size_(0) {}
+
+  /**
+   * @brief Копия разделяет все узлы с other: O(1)
+   */
+  PersistentRedBlackTree(const tree_type &other) noexcept
+      : root_(Acquire(other.root_)),
+        size_(other.size_),
+        cmp_(other.cmp_),
+        key_of_(other.key_of_) {}
+
+  PersistentRedBlackTree(tree_type &&other) noexcept
+      : PersistentRedBlackTree() {
+    Swap(other);
+  }
+
+  tree_type &operator=(const tree_type &other) noexcept {
+    tree_type copy(other);
+    Swap(copy);
+    return *this;
+  }
+
+  tree_type &operator=(tree_type &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  ~PersistentRedBlackTree() { Clear(); }
+
+  const_iterator Begin() const noexcept {
+    const_iterator it(root_);
+    it.PushLeftmost(root_);
+    return it;
+  }
+
+  const_iterator End() const noexcept { return const_iterator(root_); }
+
+  bool Empty() const noexcept { return size_ == 0; }
+  size_type Size() const noexcept { return size_; }
+
+  size_type MaxSize() const noexcept {
+    return (std::numeric_limits<size_type>::max() / 2) / sizeof(Node);
+  }
+
+  /**
+   * @brief Отпускает ссылку на корень. Узлы, разделяемые с другими
+   * версиями, остаются жить.
+   */
+  void Clear() noexcept {
+    Release(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  void Swap(tree_type &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(cmp_, other.cmp_);
+    std::swap(key_of_, other.key_of_);
+  }
+
+  /**
+   * @brief Заменяет содержимое элементами [first, last): из эквивалентных
+   * остается первый
+   */
+  template <typename InputIt>
+  void Assign(InputIt first, InputIt last) {
+    tree_type result;
+    for (; first != last; ++first) result.Emplace(*first);
+    Swap(result);
+  }
+
+  /**
+   * @brief Вставляет элемент, созданный из args, если его ключа еще нет
+   *
+   * @return std::pair<const_iterator, bool> Элемент с этим ключом и признак
+   * вставки
+   */
+  template <typename... Args>
+  std::pair<const_iterator, bool> Emplace(Args &&...args) {
+    std::unique_ptr<Node> node(
+        new Node(std::in_place, std::forward<Args>(args)...));
+    const_iterator it = Find(key_of_(node->value_));
+    if (it != End()) return {it, false};
+    const key_type &key = key_of_(node->value_);
+    InsertNode(node);
+    return {Find(key), true};
+  }
+
+  /**
+   * @brief Вставляет элемент, созданный из args, если ключа key нет. Если
+   * есть, элемент не создается.
+   */
+  template <typename... Args>
+  std::pair<const_iterator, bool> TryEmplace(const key_type &key,
+                                             Args &&...args) {
+    const_iterator it = Find(key);
+    if (it != End()) return {it, false};
+    std::unique_ptr<Node> node(
+        new Node(std::in_place, std::forward<Args>(args)...));
+    InsertNode(node);
+    return {Find(key), true};
+  }
+
+  /**
+   * @brief Применяет update к элементу с ключом key. Путь до элемента
+   * копируется, если он разделяется с другими версиями.
+   *
+   * @param update Функция от value_type&, не меняющая ключ
+   * @return const_iterator Измененный элемент или End(), если его нет
+   */
+  template <typename K, typename F>
+  const_iterator Update(const K &key, F &&update) {
+    const Node *target = FindNode(key);
+    if (target == nullptr) return End();
+    const_iterator it;
+    UpdateAt(root_, target, key, update, it);
+    it.root_ = root_;
+    return it;
+  }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  template <typename K>
+  size_type EraseKey(const K &key) {
+    if (!Contains(key)) return 0;
+    Node *root = Own(root_);
+    if (!IsRed(root->left_) && !IsRed(root->right_)) root->red_ = true;
+    EraseAt(root_, key);
+    if (root_ != nullptr) root_->red_ = false;
+    --size_;
+    return 1;
+  }
+
+  template <typename K>
+  const_iterator Find(const K &key) const {
+    const_iterator it = LowerBound(key);
+    if (it != End() && cmp_(key, key_of_(*it))) return End();
+    return it;
+  }
+
+  template <typename K>
+  bool Contains(const K &key) const {
+    return FindNode(key) != nullptr;
+  }
+
+  /**
+   * @brief Первый элемент с ключом не меньше key
+   */
+  template <typename K>
+  const_iterator LowerBound(const K &key) const {
+    return Bound(
+        [this, &key](const Node *node) {
+          return !cmp_(key_of_(node->value_), key);
+        });
+  }
+
+  /**
+   * @brief Первый элемент с ключом больше key
+   */
+  template <typename K>
+  const_iterator UpperBound(const K &key) const {
+    return Bound(
+        [this, &key](const Node *node) {
+          return cmp_(key, key_of_(node->value_));
+        });
+  }
+
+  /**
+   * @brief Проверяет свойства LLRB, порядок ключей, размер и счетчики
+   * ссылок (для тестов)
+   */
+  bool CheckTree() const {
+    size_type count = 0;
+    const Node *previous = nullptr;
+    return !IsRed(root_) && CheckNode(root_, previous, count) >= 0 &&
+           count == size_;
+  }
+
+ private:
+  struct Node {
+    // std::in_place отличает создание элемента из args от копии узла
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args &&...args)
+        : value_(std::forward<Args>(args)...) {}
+
+    // Копия узла ссылается на тех же потомков
+    Node(const Node &other)
+        : value_(other.value_),
+          left_(Acquire(other.left_)),
+          right_(Acquire(other.right_)),
+          red_(other.red_) {}
+
+    value_type value_;
+    Node *left_ = nullptr;
+    Node *right_ = nullptr;
+    // Ссылки на узел: из родителей во всех версиях и из корней деревьев
+    std::atomic<size_type> refs_{1};
+    bool red_ = true;
+  };
+
+  static Node *Acquire(Node *node) noexcept {
+    if (node != nullptr) node->refs_.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+
+  /**
+   * @brief Отпускает ссылку на node и удаляет узлы, на которые больше никто
+   * не ссылается. Рекурсия только по левым потомкам, т.е. не глубже высоты
+   * дерева.
+   */
+  static void Release(Node *node) noexcept {
+    while (node != nullptr &&
+           node->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Release(node->left_);
+      Node *right = node->right_;
+      delete node;
+      node = right;
+    }
+  }
+
+  /**
+   * @brief Делает узел slot собственным для этой версии: если на него
+   * ссылается кто-то еще, заменяет его в slot копией.
+   *
+   * @details Вызывается только сверху вниз, когда все предки slot уже
+   * собственные. Тогда единственная ссылка - это ссылка из slot, и больше
+   * ни один поток узел не увидит. Если копирование выбросит исключение,
+   * slot не меняется.
+   */
+  static Node *Own(Node *&slot) {
+    if (slot->refs_.load(std::memory_order_acquire) != 1) {
+      Node *copy = new Node(*slot);
+      Release(slot);
+      slot = copy;
+    }
+    return slot;
+  }
+
+  static bool IsRed(const Node *node) noexcept {
+    return node != nullptr && node->red_;
+  }
+
+  // Повороты и перекраска меняют h и его потомков, поэтому сначала делают
+  // их собственными
+  static void RotateLeft(Node *&h) {
+    Node *x = Own(h->right_);
+    h->right_ = x->left_;
+    x->left_ = h;
+    x->red_ = h->red_;
+    h->red_ = true;
+    h = x;
+  }
+
+  static void RotateRight(Node *&h) {
+    Node *x = Own(h->left_);
+    h->left_ = x->right_;
+    x->right_ = h;
+    x->red_ = h->red_;
+    h->red_ = true;
+    h = x;
+  }
+
+  static void FlipColors(Node *h) {
+    Own(h->left_);
+    Own(h->right_);
+    h->red_ = !h->red_;
+    h->left_->red_ = !h->left_->red_;
+    h->right_->red_ = !h->right_->red_;
+  }
+
+  // Восстанавливает свойства LLRB в h на обратном пути рекурсии
+  static void Balance(Node *&h) {
+    if (IsRed(h->right_) && !IsRed(h->left_)) RotateLeft(h);
+    if (IsRed(h->left_) && IsRed(h->left_->left_)) RotateRight(h);
+    if (IsRed(h->left_) && IsRed(h->right_)) FlipColors(h);
+  }
+
+  // Делает красным h->left_ или его левого потомка перед спуском влево
+  static void MoveRedLeft(Node *&h) {
+    FlipColors(h);
+    if (IsRed(h->right_->left_)) {
+      RotateRight(h->right_);
+      RotateLeft(h);
+      FlipColors(h);
+    }
+  }
+
+  // Делает красным h->right_ или его левого потомка перед спуском вправо
+  static void MoveRedRight(Node *&h) {
+    FlipColors(h);
+    if (IsRed(h->left_->left_)) {
+      RotateRight(h);
+      FlipColors(h);
+    }
+  }
+
+  // Узел переходит во владение дерева, когда встает на свое место: если
+  // копирование пути выбросит исключение раньше, его удалит node
+  void InsertNode(std::unique_ptr<Node> &node) {
+    InsertAt(root_, node);
+    root_->red_ = false;
+    ++size_;
+  }
+
+  // Ключа node в поддереве h нет (проверено заранее)
+  void InsertAt(Node *&h, std::unique_ptr<Node> &node) {
+    if (h == nullptr) {
+      h = node.release();
+      return;
+    }
+    Own(h);
+    if (cmp_(key_of_(node->value_), key_of_(h->value_))) {
+      InsertAt(h->left_, node);
+    } else {
+      InsertAt(h->right_, node);
+    }
+    Balance(h);
+  }
+
+  // Узел target с ключом key лежит в поддереве h. Путь до него не
+  // перестраивается, поэтому сразу записывается в it
+  template <typename K, typename F>
+  void UpdateAt(Node *&h, const Node *target, const K &key, F &update,
+                const_iterator &it) {
+    // Сравнение указателей до Own(): копия узла - это уже другой адрес
+    bool found = h == target;
+    it.Push(Own(h));
+    if (found) {
+      update(h->value_);
+    } else if (cmp_(key, key_of_(h->value_))) {
+      UpdateAt(h->left_, target, key, update, it);
+    } else {
+      UpdateAt(h->right_, target, key, update, it);
+    }
+  }
+
+  // Ключ key есть в поддереве h (проверено заранее)
+  template <typename K>
+  void EraseAt(Node *&h, const K &key) {
+    Own(h);
+    if (cmp_(key, key_of_(h->value_))) {
+      if (!IsRed(h->left_) && !IsRed(h->left_->left_)) MoveRedLeft(h);
+      EraseAt(h->left_, key);
+    } else {
+      if (IsRed(h->left_)) RotateRight(h);
+      if (h->right_ == nullptr && !cmp_(key_of_(h->value_), key)) {
+        // Лист: в LLRB у узла без правого потомка нет и левого
+        Release(h);
+        h = nullptr;
+        return;
+      }
+      if (!IsRed(h->right_) && !IsRed(h->right_->left_)) MoveRedRight(h);
+      if (!cmp_(key_of_(h->value_), key)) {
+        // Элемент не копируется: на место h встает узел минимума правого
+        // поддерева
+        Node *min = nullptr;
+        EraseMin(h->right_, min);
+        min->left_ = h->left_;
+        min->right_ = h->right_;
+        min->red_ = h->red_;
+        h->left_ = nullptr;
+        h->right_ = nullptr;
+        Release(h);
+        h = min;
+      } else {
+        EraseAt(h->right_, key);
+      }
+    }
+    Balance(h);
+  }
+
+  // Отцепляет минимум поддерева h в min (вместе со ссылкой на него)
+  static void EraseMin(Node *&h, Node *&min) {
+    Own(h);
+    if (h->left_ == nullptr) {
+      min = h;
+      h = nullptr;
+      return;
+    }
+    if (!IsRed(h->left_) && !IsRed(h->left_->left_)) MoveRedLeft(h);
+    EraseMin(h->left_, min);
+    Balance(h);
+  }
+
+  // Узел с ключом key или nullptr. Одно сравнение на уровень, а потомок
+  // выбирается индексом в массиве, без ветвления: направление спуска по
+  // случайным ключам не предсказывается (с if и ?: GCC ставит переход, и
+  // поиск в 2-3 раза медленнее)
+  template <typename K>
+  const Node *FindNode(const K &key) const {
+    const Node *candidate = nullptr;
+    for (const Node *node = root_; node != nullptr;) {
+      const Node *children[2] = {node->right_, node->left_};
+      const Node *candidates[2] = {candidate, node};
+      bool goes_left = !cmp_(key_of_(node->value_), key);
+      candidate = candidates[goes_left];
+      node = children[goes_left];
+    }
+    if (candidate == nullptr || cmp_(key, key_of_(candidate->value_))) {
+      return nullptr;
+    }
+    return candidate;
+  }
+
+  // Путь к первому узлу, для которого выполняется goes_left (для всех
+  // следующих он тоже выполняется)
+  template <typename Predicate>
+  const_iterator Bound(Predicate goes_left) const {
+    const_iterator it(root_);
+    size_type found = 0;
+    for (const Node *node = root_; node != nullptr;) {
+      it.Push(node);
+      if (goes_left(node)) {
+        found = it.depth_;
+        node = node->left_;
+      } else {
+        node = node->right_;
+      }
+    }
+    it.depth_ = found;
+    return it;
+  }
+
+  // Возвращает черную высоту поддерева или -1, если свойства нарушены
+  int CheckNode(const Node *node, const Node *&previous,
+                size_type &count) const {
+    if (node == nullptr) return 0;
+    if (node->refs_.load(std::memory_order_relaxed) == 0) return -1;
+    if (IsRed(node->right_)) return -1;
+    if (node->red_ && IsRed(node->left_)) return -1;
+    int left = CheckNode(node->left_, previous, count);
+    if (previous != nullptr &&
+        !cmp_(key_of_(previous->value_), key_of_(node->value_))) {
+      return -1;
+    }
+    previous = node;
+    ++count;
+    int right = CheckNode(node->right_, previous, count);
+    if (left < 0 || left != right) return -1;
+    return left + (node->red_ ? 0 : 1);
+  }
+
+  Node *root_;
+  size_type size_;
+  key_compare cmp_;
+  KeyOfValue key_of_;
+};
+
+/**
+ * @brief Упорядоченное множество уникальных ключей на персистентном дереве.
+ * Копия и snapshot() стоят O(1) (см. описание в начале файла).
+ */
+template <class Key, class Compare = std::less<Key>>
+class persistent_set {
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const Key &value) const noexcept { return value; }
+  };
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (само значение является ключом)
+  using value_type = key_type;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Внутренний класс для дерева
+  using tree_type =
+      PersistentRedBlackTree<key_type, value_type, KeyOfValue, key_compare>;
+  // Итераторы константные: элементы разделяются со снимками
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  persistent_set() = default;
+
+  persistent_set(std::initializer_list<value_type> const &items)
+      : persistent_set(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  persistent_set(InputIt first, InputIt last) {
+    tree_.Assign(first, last);
+  }
+
+  /**
+   * @brief Снимок текущего содержимого за O(1). Дальнейшие изменения this
+   * его не затрагивают, и читать его можно из других потоков без
+   * блокировок.
+   */
+  persistent_set snapshot() const noexcept { return *this; }
+
+  iterator begin() const noexcept { return tree_.Begin(); }
+  iterator end() const noexcept { return tree_.End(); }
+  bool empty() const noexcept { return tree_.Empty(); }
+  size_type size() const noexcept { return tree_.Size(); }
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+  void clear() noexcept { tree_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.Emplace(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.Emplace(std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return tree_.Emplace(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) { return tree_.EraseKey(key); }
+
+  void swap(persistent_set &other) noexcept { tree_.Swap(other.tree_); }
+
+  iterator find(const key_type &key) const { return tree_.Find(key); }
+  bool contains(const key_type &key) const { return tree_.Contains(key); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) const {
+    return tree_.LowerBound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree_.UpperBound(key);
+  }
+
+ private:
+  tree_type tree_;
+};
+
+/**
+ * @brief Словарь с уникальными ключами на персистентном дереве. Копия и
+ * snapshot() стоят O(1) (см. описание в начале файла).
+ *
+ * @details Доступ к элементам только константный: элемент может
+ * разделяться со снимками. Значение меняется через insert_or_assign(),
+ * который копирует путь до элемента.
+ */
+template <class Key, class Type, class Compare = std::less<Key>>
+class persistent_map {
+ private:
+  struct KeyOfValue {
+    const Key &operator()(const std::pair<const Key, Type> &value) const
+        noexcept {
+      return value.first;
+    }
+  };
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (Type — параметр шаблона)
+  using mapped_type = Type;
+  // Тип данных для пары ключ-значение
+  using value_type = std::pair<const key_type, mapped_type>;
+  // Тип ссылки на элемент
+  using reference = value_type &;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Внутренний класс для дерева
+  using tree_type =
+      PersistentRedBlackTree<key_type, value_type, KeyOfValue, key_compare>;
+  // Итераторы константные: элементы разделяются со снимками
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  persistent_map() = default;
+
+  persistent_map(std::initializer_list<value_type> const &items)
+      : persistent_map(items.begin(), items.end()) {}
+
+  template <typename InputIt>
+  persistent_map(InputIt first, InputIt last) {
+    tree_.Assign(first, last);
+  }
+
+  /**
+   * @brief Снимок текущего содержимого за O(1). Дальнейшие изменения this
+   * его не затрагивают, и читать его можно из других потоков без
+   * блокировок.
+   */
+  persistent_map snapshot() const noexcept { return *this; }
+
+  /**
+   * @brief Возвращает значение с ключом key
+   *
+   * @throw std::out_of_range элемента с ключом key нет
+   */
+  const mapped_type &at(const key_type &key) const {
+    const_iterator it = tree_.Find(key);
+    if (it == end()) {
+      throw std::out_of_range(
+          "s21::persistent_map::at: No element exists with key equivalent "
+          "to key");
+    }
+    return it->second;
+  }
+
+  iterator begin() const noexcept { return tree_.Begin(); }
+  iterator end() const noexcept { return tree_.End(); }
+  bool empty() const noexcept { return tree_.Empty(); }
+  size_type size() const noexcept { return tree_.Size(); }
+  size_type max_size() const noexcept { return tree_.MaxSize(); }
+  void clear() noexcept { tree_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.Emplace(value);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return try_emplace(key, obj);
+  }
+
+  /**
+   * @brief Вставляет пару (key, obj) или присваивает obj значению
+   * существующего ключа
+   */
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    iterator it =
+        tree_.Update(key, [&obj](value_type &value) { value.second = obj; });
+    if (it != end()) return {it, false};
+    return try_emplace(key, obj);
+  }
+
+  /**
+   * @brief Вставляет элемент с ключом key и значением из args, если ключа
+   * нет. Если есть, args не используются.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.TryEmplace(key, std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) { return tree_.EraseKey(key); }
+
+  void swap(persistent_map &other) noexcept { tree_.Swap(other.tree_); }
+
+  iterator find(const key_type &key) const { return tree_.Find(key); }
+  bool contains(const key_type &key) const { return tree_.Contains(key); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) const {
+    return tree_.LowerBound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree_.UpperBound(key);
+  }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_PERSISTENT_TREE_H_
@@ -0,0 +1,515 @@
+#ifndef SRC_HEADERS_S21_PRIORITY_QUEUE_H_
+#define SRC_HEADERS_S21_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// d-ary heap on top of a random access container. With Compare = std::less
+// top() is the largest element, as in std::priority_queue. A 4-ary heap is
+// half as deep as a binary one and the children of a node share a cache
+// line, which makes pop() cheaper on large heaps.
+// Container must provide operator[], back(), push_back(), pop_back(),
+// empty(), size() and swap(): s21::vector, std::vector, std::deque, ...
+template <typename T, typename Container = s21::vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "priority_queue arity must be at least 2");
+
+ public:
+  // Priority queue Member type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  // Priority queue Member functions
+  priority_queue();
+  explicit priority_queue(const Compare &compare);
+  priority_queue(std::initializer_list<value_type> const &items);
+  priority_queue(const Compare &compare, const Container &container);
+  priority_queue(const Compare &compare, Container &&container);
+  priority_queue(const priority_queue &pq) = default;
+  priority_queue(priority_queue &&pq) = default;
+  ~priority_queue() = default;
+  priority_queue &operator=(const priority_queue &pq) = default;
+  priority_queue &operator=(priority_queue &&pq) = default;
+
+  // Priority queue Element access
+  const_reference top() const;
+
+  // Priority queue Capacity
+  bool empty() const;
+  size_type size() const;
+
+  // Priority queue Modifiers
+  void push(const_reference value);
+  void push(value_type &&value);
+  void pop();
+  void swap(priority_queue &other);
+
+  template <typename... Args>
+  void emplace(Args &&...args);
+
+  // Bonus part
+  template <typename... Args>
+  void insert_many(Args &&...args);
+
+ private:
+  container_type container_;
+  Compare compare_;
+
+  // Help functions
+  void make_heap();
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+};
+
+// d-ary heap with handles. push() returns a handle that stays valid until
+// the element leaves the queue, so the priority of a queued element can be
+// changed (update, decrease_key) or the element removed (erase) in
+// O(d log_d n). Handles of removed elements are reused.
+//
+// decrease_key follows the textbook min-heap naming: it moves an element
+// towards top(). With Compare = std::greater (min-heap, as in Dijkstra)
+// that means a smaller key.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class indexed_priority_queue {
+  static_assert(Arity >= 2, "indexed_priority_queue arity must be at least 2");
+
+ public:
+  // Indexed priority queue Member type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using handle_type = size_t;
+  using value_compare = Compare;
+
+  // Indexed priority queue Member functions
+  indexed_priority_queue();
+  explicit indexed_priority_queue(const Compare &compare);
+  indexed_priority_queue(const indexed_priority_queue &pq) = default;
+  indexed_priority_queue(indexed_priority_queue &&pq) = default;
+  ~indexed_priority_queue() = default;
+  indexed_priority_queue &operator=(const indexed_priority_queue &pq) =
+      default;
+  indexed_priority_queue &operator=(indexed_priority_queue &&pq) = default;
+
+  // Indexed priority queue Element access
+  const_reference top() const;
+  handle_type top_handle() const;
+  const_reference value(handle_type handle) const;
+  bool contains(handle_type handle) const;
+
+  // Indexed priority queue Capacity
+  bool empty() const;
+  size_type size() const;
+
+  // Indexed priority queue Modifiers
+  handle_type push(const_reference value);
+  handle_type push(value_type &&value);
+  void pop();
+  void update(handle_type handle, const_reference value);
+  void decrease_key(handle_type handle, const_reference value);
+  void erase(handle_type handle);
+  void clear();
+  void swap(indexed_priority_queue &other);
+
+ private:
+  static constexpr size_type kNotInHeap = std::numeric_limits<size_type>::max();
+
+  // Heap of handles
+  s21::vector<handle_type> heap_;
+  // Heap index of each handle (kNotInHeap for free handles)
+  s21::vector<size_type> position_;
+  // Value of each handle
+  s21::vector<value_type> values_;
+  // Handles of removed elements
+  s21::vector<handle_type> free_;
+  Compare compare_;
+
+  // Help functions
+  handle_type acquire_handle();
+  void check_handle(handle_type handle) const;
+  void remove_at(size_type pos);
+  void place(size_type pos, handle_type handle);
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+};
+}  // namespace s21
+
+namespace s21 {
+// priority_queue
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue()
+    : container_(), compare_() {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare)
+    : container_(), compare_(compare) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items)
+    : container_(), compare_() {
+  for (const auto &item : items) {
+    container_.push_back(item);
+  }
+  make_heap();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare, const Container &container)
+    : container_(container), compare_(compare) {
+  make_heap();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare, Container &&container)
+    : container_(std::move(container)), compare_(compare) {
+  make_heap();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::const_reference
+priority_queue<T, Container, Compare, Arity>::top() const {
+  if (empty()) {
+    throw std::out_of_range("Priority queue is empty");
+  }
+  return container_[0];
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+bool priority_queue<T, Container, Compare, Arity>::empty() const {
+  return container_.empty();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::size_type
+priority_queue<T, Container, Compare, Arity>::size() const {
+  return container_.size();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(
+    const_reference value) {
+  container_.push_back(value);
+  sift_up(container_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+  sift_up(container_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
+  push(value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+  if (empty()) {
+    throw std::out_of_range(
+        "Unable to remove the element from empty container");
+  }
+  if (container_.size() > 1) {
+    container_[0] = std::move(container_.back());
+  }
+  container_.pop_back();
+  if (!container_.empty()) {
+    sift_down(0);
+  }
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(
+    priority_queue &other) {
+  container_.swap(other.container_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::insert_many(
+    Args &&...args) {
+  (push(std::forward<Args>(args)), ...);
+}
+
+// Floyd's bottom-up heap construction, O(n)
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::make_heap() {
+  size_type n = container_.size();
+  if (n > 1) {
+    for (size_type pos = (n - 2) / Arity + 1; pos-- > 0;) {
+      sift_down(pos);
+    }
+  }
+}
+
+// The element is moved out once and written back once; the elements on
+// the way are shifted into the hole instead of being swapped
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_up(size_type pos) {
+  value_type value = std::move(container_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!compare_(container_[parent], value)) {
+      break;
+    }
+    container_[pos] = std::move(container_[parent]);
+    pos = parent;
+  }
+  container_[pos] = std::move(value);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_down(size_type pos) {
+  size_type n = container_.size();
+  value_type value = std::move(container_[pos]);
+  while (true) {
+    size_type first = pos * Arity + 1;
+    if (first >= n) {
+      break;
+    }
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (compare_(container_[best], container_[child])) {
+        best = child;
+      }
+    }
+    if (!compare_(value, container_[best])) {
+      break;
+    }
+    container_[pos] = std::move(container_[best]);
+    pos = best;
+  }
+  container_[pos] = std::move(value);
+}
+
+// indexed_priority_queue
+template <typename T, typename Compare, size_t Arity>
+indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue()
+    : compare_() {}
+
+template <typename T, typename Compare, size_t Arity>
+indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue(
+    const Compare &compare)
+    : compare_(compare) {}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::top() const {
+  return values_[top_handle()];
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::top_handle() const {
+  if (empty()) {
+    throw std::out_of_range("Priority queue is empty");
+  }
+  return heap_[0];
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::value(handle_type handle) const {
+  check_handle(handle);
+  return values_[handle];
+}
+
+template <typename T, typename Compare, size_t Arity>
+bool indexed_priority_queue<T, Compare, Arity>::contains(
+    handle_type handle) const {
+  return handle < position_.size() && position_[handle] != kNotInHeap;
+}
+
+template <typename T, typename Compare, size_t Arity>
+bool indexed_priority_queue<T, Compare, Arity>::empty() const {
+  return heap_.empty();
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::size_type
+indexed_priority_queue<T, Compare, Arity>::size() const {
+  return heap_.size();
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::push(const_reference value) {
+  return push(value_type(value));
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::push(value_type &&value) {
+  handle_type handle = acquire_handle();
+  values_[handle] = std::move(value);
+  heap_.push_back(handle);
+  position_[handle] = heap_.size() - 1;
+  sift_up(heap_.size() - 1);
+  return handle;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::pop() {
+  if (empty()) {
+    throw std::out_of_range(
+        "Unable to remove the element from empty container");
+  }
+  remove_at(0);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::update(
+    handle_type handle, const_reference value) {
+  check_handle(handle);
+  bool raise = compare_(values_[handle], value);
+  values_[handle] = value;
+  if (raise) {
+    sift_up(position_[handle]);
+  } else {
+    sift_down(position_[handle]);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::decrease_key(
+    handle_type handle, const_reference value) {
+  check_handle(handle);
+  if (compare_(value, values_[handle])) {
+    throw std::invalid_argument("decrease_key would move the element down");
+  }
+  values_[handle] = value;
+  sift_up(position_[handle]);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::erase(handle_type handle) {
+  check_handle(handle);
+  remove_at(position_[handle]);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::clear() {
+  heap_.clear();
+  position_.clear();
+  values_.clear();
+  free_.clear();
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::swap(
+    indexed_priority_queue &other) {
+  heap_.swap(other.heap_);
+  position_.swap(other.position_);
+  values_.swap(other.values_);
+  free_.swap(other.free_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::acquire_handle() {
+  if (!free_.empty()) {
+    handle_type handle = free_.back();
+    free_.pop_back();
+    return handle;
+  }
+  position_.push_back(kNotInHeap);
+  values_.emplace_back();
+  return values_.size() - 1;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::check_handle(
+    handle_type handle) const {
+  if (!contains(handle)) {
+    throw std::out_of_range("Handle does not refer to a queued element");
+  }
+}
+
+// The last heap entry fills the hole and is sifted in whichever direction
+// it has to go
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::remove_at(size_type pos) {
+  handle_type removed = heap_[pos];
+  handle_type last = heap_.back();
+  heap_.pop_back();
+  position_[removed] = kNotInHeap;
+  values_[removed] = value_type();
+  free_.push_back(removed);
+  if (pos < heap_.size()) {
+    place(pos, last);
+    if (pos > 0 && compare_(values_[heap_[(pos - 1) / Arity]], values_[last])) {
+      sift_up(pos);
+    } else {
+      sift_down(pos);
+    }
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::place(size_type pos,
+                                                       handle_type handle) {
+  heap_[pos] = handle;
+  position_[handle] = pos;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_up(size_type pos) {
+  handle_type handle = heap_[pos];
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!compare_(values_[heap_[parent]], values_[handle])) {
+      break;
+    }
+    place(pos, heap_[parent]);
+    pos = parent;
+  }
+  place(pos, handle);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_down(size_type pos) {
+  size_type n = heap_.size();
+  handle_type handle = heap_[pos];
+  while (true) {
+    size_type first = pos * Arity + 1;
+    if (first >= n) {
+      break;
+    }
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (compare_(values_[heap_[best]], values_[heap_[child]])) {
+        best = child;
+      }
+    }
+    if (!compare_(values_[handle], values_[heap_[best]])) {
+      break;
+    }
+    place(pos, heap_[best]);
+    pos = best;
+  }
+  place(pos, handle);
+}
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_PRIORITY_QUEUE_H_
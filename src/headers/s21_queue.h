@@ -2,11 +2,14 @@
 #define SRC_HEADERS_S21_QUEUE_H_
 
 #include <exception>
+#include <utility>
 
 #include "s21_list.h"
 
 namespace s21 {
-template <typename T>
+// Container must provide front(), back(), push_back(), emplace_back(),
+// pop_front(), empty(), size() and swap(): s21::list, std::deque, ...
+template <typename T, typename Container = s21::list<T>>
 class queue {
  public:
   // Queue Member type
@@ -14,6 +17,7 @@ class queue {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using container_type = Container;
 
   // Queue Member functions
   queue();
@@ -21,11 +25,12 @@ class queue {
   queue(const queue &q);
   queue(queue &&q);
   ~queue();
-  queue operator=(queue &&q);
+  queue &operator=(const queue &q);
+  queue &operator=(queue &&q);
 
   // Queue Element access
-  const_reference front();
-  const_reference back();
+  reference front();
+  reference back();
 
   // Queue Capacity
   bool empty();
@@ -33,94 +38,120 @@ class queue {
 
   // Queue Modifiers
   void push(const_reference value);
+  void push(value_type &&value);
   void pop();
   void swap(queue &other);
 
+  template <typename... Args>
+  reference emplace(Args &&...args);
+
   // Bonus part
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
  private:
-  s21::list<value_type> container_;
+  container_type container_;
 };
 
 }  // namespace s21
 
 namespace s21 {
-template <typename value_type>
-queue<value_type>::queue() {
-  container_.clear();
-}
+template <typename value_type, typename Container>
+queue<value_type, Container>::queue() : container_() {}
 
-template <typename value_type>
-queue<value_type>::queue(std::initializer_list<value_type> const &items) {
-  container_.clear();
+template <typename value_type, typename Container>
+queue<value_type, Container>::queue(
+    std::initializer_list<value_type> const &items)
+    : container_() {
   for (const auto &item : items) {
     push(item);
   }
 }
 
-template <typename value_type>
-queue<value_type>::queue(const queue &s) {
-  container_ = s.container_;
-}
+template <typename value_type, typename Container>
+queue<value_type, Container>::queue(const queue &s)
+    : container_(s.container_) {}
 
-template <typename value_type>
-queue<value_type>::queue(queue &&s) {
-  container_ = std::move(s.container_);
-}
+template <typename value_type, typename Container>
+queue<value_type, Container>::queue(queue &&s)
+    : container_(std::move(s.container_)) {}
 
-template <typename value_type>
-queue<value_type> queue<value_type>::operator=(queue &&s) {
-  container_ = std::move(s.container_);
+template <typename value_type, typename Container>
+queue<value_type, Container> &queue<value_type, Container>::operator=(
+    const queue &s) {
+  if (this != &s) {
+    container_ = s.container_;
+  }
   return *this;
 }
 
-template <typename value_type>
-queue<value_type>::~queue() {
-  container_.clear();
+template <typename value_type, typename Container>
+queue<value_type, Container> &queue<value_type, Container>::operator=(
+    queue &&s) {
+  if (this != &s) {
+    container_ = std::move(s.container_);
+  }
+  return *this;
 }
 
-template <typename value_type>
-typename queue<value_type>::size_type queue<value_type>::size() {
+template <typename value_type, typename Container>
+queue<value_type, Container>::~queue() {}
+
+template <typename value_type, typename Container>
+typename queue<value_type, Container>::size_type
+queue<value_type, Container>::size() {
   return container_.size();
 }
 
-template <typename value_type>
-bool queue<value_type>::empty() {
+template <typename value_type, typename Container>
+bool queue<value_type, Container>::empty() {
   return container_.empty();
 }
 
-template <typename value_type>
-void queue<value_type>::push(const_reference value) {
+template <typename value_type, typename Container>
+void queue<value_type, Container>::push(const_reference value) {
   container_.push_back(value);
 }
 
-template <typename value_type>
-void queue<value_type>::pop() {
+template <typename value_type, typename Container>
+void queue<value_type, Container>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+}
+
+template <typename value_type, typename Container>
+void queue<value_type, Container>::pop() {
   container_.pop_front();
 }
 
-template <typename value_type>
-void queue<value_type>::swap(queue &other) {
+template <typename value_type, typename Container>
+void queue<value_type, Container>::swap(queue &other) {
   container_.swap(other.container_);
 }
 
-template <typename value_type>
-typename queue<value_type>::const_reference queue<value_type>::front() {
+template <typename value_type, typename Container>
+typename queue<value_type, Container>::reference
+queue<value_type, Container>::front() {
   return container_.front();
 }
 
-template <typename value_type>
-typename queue<value_type>::const_reference queue<value_type>::back() {
+template <typename value_type, typename Container>
+typename queue<value_type, Container>::reference
+queue<value_type, Container>::back() {
   return container_.back();
 }
 
-template <typename value_type>
+template <typename value_type, typename Container>
+template <typename... Args>
+typename queue<value_type, Container>::reference
+queue<value_type, Container>::emplace(Args &&...args) {
+  return container_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename value_type, typename Container>
 template <typename... Args>
-void queue<value_type>::insert_many_back(Args &&...args) {
-  container_.insert_many_back(args...);
+void queue<value_type, Container>::insert_many_back(Args &&...args) {
+  (container_.push_back(std::forward<Args>(args)), ...);
 }
 }  // namespace s21
 
-#endif  // SRC_HEADERS_S21_QUEUE_H_
\ No newline at end of file
+#endif  // SRC_HEADERS_S21_QUEUE_H_
@@ -5,18 +5,27 @@
  * с помощью функции сравнения ключей. Операции поиска, удаления и вставки имеют
  * логарифмическую сложность. Набор реализован в виде красно-черного дерева.
  *
+ * Ключи сравниваются компаратором Compare (по умолчанию std::less<Key>). С
+ * прозрачным компаратором (например, std::less<>) поиск возможен по ключу
+ * другого типа без создания временного Key.
+ *
+ * Если OrderStatistics равен true, дерево хранит размеры поддеревьев, и
+ * select(), rank(), count() и distance() работают за O(log n). По умолчанию
+ * (false) размеры не хранятся и ничего не стоят.
  *
  */
 
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SET_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_SET_H_
 
+#include <functional>
 #include <vector>
 
 #include "s21_tree.h"
 
 namespace s21 {
-template <class Key>
+template <class Key, class Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class set {
  public:
   // Тип ключа элемента (Key — параметр шаблона)
@@ -27,14 +36,18 @@ class set {
   using reference = value_type &;
   // Тип константной ссылки на элемент
   using const_reference = const value_type &;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
   // Внутренний класс для дерева
-  using tree_type = RedBlackTree<value_type>;
+  using tree_type = RedBlackTree<value_type, key_compare, OrderStatistics>;
   // Внутренний класс для итератора
   using iterator = typename tree_type::iterator;
   // Внутренний класс для константного итератора
   using const_iterator = typename tree_type::const_iterator;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
 
   /**
    * @brief Конструктор по умолчанию, создает пустое множество
@@ -47,10 +60,23 @@ class set {
    *
    * @param items Список создаваемых элементов
    */
-  set(std::initializer_list<value_type> const &items) : set() {
-    for (auto item : items) {
-      insert(item);
-    }
+  set(std::initializer_list<value_type> const &items)
+      : set(items.begin(), items.end()) {}
+
+  /**
+   * @brief Конструктор диапазона, создает множество из элементов [first,
+   * last).
+   *
+   * @details Дерево строится сразу сбалансированным за O(n), если диапазон
+   * отсортирован, и за O(n log n) в противном случае (см.
+   * RedBlackTree::Assign()).
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  set(InputIt first, InputIt last) : set() {
+    assign(first, last);
   }
 
   /**
@@ -170,6 +196,19 @@ class set {
    */
   void clear() noexcept { tree_->Clear(); }
 
+  /**
+   * @brief Заменяет содержимое контейнера элементами [first, last): из
+   * элементов с эквивалентным ключом остается первый. Диапазон может указывать
+   * на элементы самого контейнера.
+   *
+   * @param first Начало диапазона
+   * @param last Конец диапазона
+   */
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last) {
+    tree_->Assign(first, last, true);
+  }
+
   /**
    * @brief Вставляет элемент со значением value в контейнер, если контейнер
    * еще не содержит элемент с эквивалентным ключом.
@@ -184,6 +223,40 @@ class set {
     return tree_->InsertUnique(value);
   }
 
+  /**
+   * @brief Вставляет элемент со значением value как можно ближе к позиции
+   * перед hint, если контейнер еще не содержит элемент с эквивалентным
+   * ключом.
+   *
+   * @details С верной подсказкой (hint - элемент, следующий за value, или
+   * элемент, после которого встанет value) вставка выполняется за
+   * амортизированное O(1), без спуска от корня. Детали - в методе
+   * SearchHintParent() реализации дерева.
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param value Значение элемента для вставки
+   * @return iterator Итератор, указывающий на вставленный элемент (или на
+   * элемент, который предотвратил вставку)
+   */
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree_->InsertHint(hint, value, true).first;
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его как можно ближе к позиции
+   * перед hint, если контейнер еще не содержит элемент с эквивалентным
+   * ключом. Подсказка работает так же, как в insert(hint, value).
+   *
+   * @param hint Подсказка позиции для вставки
+   * @param args Аргументы конструктора элемента
+   * @return iterator Итератор, указывающий на вставленный элемент (или на
+   * элемент, который предотвратил вставку)
+   */
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return tree_->EmplaceHint(hint, true, std::forward<Args>(args)...).first;
+  }
+
   /**
    * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
    * элементы становятся недействительными. Другие ссылки и итераторы не
@@ -193,6 +266,35 @@ class set {
    */
   void erase(iterator pos) noexcept { tree_->Erase(pos); }
 
+  /**
+   * @brief Удаляет элементы [first, last) за O(log n + k): диапазон
+   * вырезается из дерева и освобождается целиком. Итераторы на остальные
+   * элементы (и last) остаются действительными.
+   */
+  void erase(const_iterator first, const_iterator last) noexcept {
+    tree_->EraseRange(first, last);
+  }
+
+  /**
+   * @brief Удаляет элементы с ключами из [lo, hi)
+   *
+   * @return size_type Количество удаленных элементов
+   */
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    return tree_->EraseKeyRange(lo, hi);
+  }
+
+  /**
+   * @brief Вызывает fn(const_reference) для элементов с ключами из [lo, hi)
+   * по возрастанию, обходя только нужную часть дерева (без повторных
+   * переходов к следующему элементу)
+   */
+  template <typename Function>
+  void for_each_in_range(const key_type &lo, const key_type &hi,
+                         Function &&fn) const {
+    static_cast<const tree_type *>(tree_)->ForEachInRange(lo, hi, fn);
+  }
+
   /**
    * @brief Обменяет содержимое контейнера на содержимое other
    *
@@ -209,7 +311,40 @@ class set {
    *
    * @param other
    */
-  void merge(set &other) noexcept { tree_->MergeUnique(*other.tree_); }
+  void merge(set &other) { tree_->MergeUnique(*other.tree_); }
+
+  /**
+   * @brief Параллельная версия merge(): половины рекурсии split/join
+   * выполняются задачами scheduler (например, s21::ws_scheduler)
+   */
+  template <typename Scheduler>
+  void merge(set &other, Scheduler &scheduler) {
+    tree_->MergeUnique(*other.tree_, scheduler);
+  }
+
+  /**
+   * @brief Оставляет только элементы, которые есть и в other (пересечение).
+   * @details Детали реализации описаны в методе Intersect() реализации
+   * дерева.
+   */
+  void intersect(const set &other) { tree_->Intersect(*other.tree_); }
+
+  template <typename Scheduler>
+  void intersect(const set &other, Scheduler &scheduler) {
+    tree_->Intersect(*other.tree_, scheduler);
+  }
+
+  /**
+   * @brief Удаляет элементы, которые есть в other (разность).
+   * @details Детали реализации описаны в методе Subtract() реализации
+   * дерева.
+   */
+  void subtract(const set &other) { tree_->Subtract(*other.tree_); }
+
+  template <typename Scheduler>
+  void subtract(const set &other, Scheduler &scheduler) {
+    tree_->Subtract(*other.tree_, scheduler);
+  }
 
   /**
    * @brief Находит элемент с ключом, эквивалентным key.
@@ -243,6 +378,65 @@ class set {
     return tree_->Find(key) != tree_->End();
   }
 
+  /**
+   * @brief Версии find() и contains() для ключа типа K, сравнимого с
+   * key_type (например, std::string_view для множества std::string).
+   * Доступны, только если компаратор прозрачный (объявляет is_transparent,
+   * как std::less<>), и не создают временный key_type.
+   *
+   * @param key Искомый ключ
+   */
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) {
+    return tree_->Find(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const K &key) const {
+    return tree_->Find(key);
+  }
+
+  template <typename K, typename C = key_compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const {
+    return tree_->Find(key) != tree_->End();
+  }
+
+  /**
+   * @brief Возвращает количество элементов с ключом, эквивалентным key (0
+   * или 1, т.к. ключи уникальны).
+   */
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * @brief Возвращает итератор на элемент с индексом index в порядке
+   * сортировки (0 - самый маленький) или end(), если index >= size(). За
+   * O(log n), доступно только при OrderStatistics.
+   */
+  iterator select(size_type index) { return tree_->Select(index); }
+
+  /**
+   * @brief Версия select() для const-объектов.
+   */
+  const_iterator select(size_type index) const { return tree_->Select(index); }
+
+  /**
+   * @brief Возвращает количество элементов меньше key, т.е. индекс, который
+   * занимает (или занял бы) key. За O(log n), доступно только при
+   * OrderStatistics.
+   */
+  size_type rank(const key_type &key) const { return tree_->Rank(key); }
+
+  /**
+   * @brief Возвращает расстояние от first до last: за O(log n) при
+   * OrderStatistics, иначе за O(n), как std::distance().
+   */
+  difference_type distance(const_iterator first, const_iterator last) const {
+    return tree_->Distance(first, last);
+  }
+
   /**
    * BONUS
    * @brief Размещает новые элементы args в контейнер, если контейнер ещё не
@@ -269,6 +463,41 @@ class set {
   tree_type *tree_;
 };
 
+/**
+ * @brief Объединение множеств. Узлы rhs переходят в результат без
+ * копирования, поэтому выгодно передавать временные множества через
+ * std::move.
+ */
+template <class Key, class Compare, bool OrderStatistics>
+set<Key, Compare, OrderStatistics> set_union(
+    set<Key, Compare, OrderStatistics> lhs,
+    set<Key, Compare, OrderStatistics> rhs) {
+  lhs.merge(rhs);
+  return lhs;
+}
+
+/**
+ * @brief Пересечение множеств: элементы lhs, которые есть в rhs
+ */
+template <class Key, class Compare, bool OrderStatistics>
+set<Key, Compare, OrderStatistics> set_intersection(
+    set<Key, Compare, OrderStatistics> lhs,
+    const set<Key, Compare, OrderStatistics> &rhs) {
+  lhs.intersect(rhs);
+  return lhs;
+}
+
+/**
+ * @brief Разность множеств: элементы lhs, которых нет в rhs
+ */
+template <class Key, class Compare, bool OrderStatistics>
+set<Key, Compare, OrderStatistics> set_difference(
+    set<Key, Compare, OrderStatistics> lhs,
+    const set<Key, Compare, OrderStatistics> &rhs) {
+  lhs.subtract(rhs);
+  return lhs;
+}
+
 }  // namespace s21
 
 #endif  // S21_CONTAINERS_S21_CONTAINERS_S21_SET_H_
\ No newline at end of file
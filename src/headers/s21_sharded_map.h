@@ -0,0 +1,282 @@
+/**
+ * @file s21_sharded_map.h
+ * @brief s21::sharded_map - потокобезопасный словарь, разделенный по хешу
+ * ключа на Shards независимых s21::map, каждый под своей блокировкой
+ * чтения-записи.
+ *
+ * @details Один s21::map под глобальным мьютексом выполняет все операции по
+ * очереди. Здесь ключ по хешу попадает в один из Shards сегментов (shard),
+ * и операции с разными сегментами не мешают друг другу. Внутри сегмента
+ * std::shared_mutex пускает поиски параллельно, а запись - монопольно.
+ *
+ * Сегменты выровнены по строке кэша, чтобы блокировки соседних сегментов
+ * не делили одну строку (false sharing).
+ *
+ * Ключи разных сегментов не упорядочены между собой. Упорядоченный обход
+ * всего словаря (for_each_ordered()) сливает сегменты k-путевым слиянием
+ * через s21::priority_queue за O(n log Shards).
+ *
+ * Итераторы наружу не выдаются: они были бы действительны только под
+ * блокировкой сегмента. Поэтому find() и at() возвращают копию значения,
+ * а обход выполняется посетителем (for_each_shard(), for_each_ordered())
+ * под блокировками.
+ *
+ * @warning Посетитель вызывается под блокировкой: он не должен обращаться к
+ * этому же словарю, иначе возможна взаимная блокировка.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SHARDED_MAP_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_SHARDED_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_map.h"
+#include "s21_priority_queue.h"
+
+namespace s21 {
+template <class Key, class Type, std::size_t Shards = 16,
+          class Hash = std::hash<Key>, class Compare = std::less<Key>>
+class sharded_map {
+  static_assert(Shards > 0, "sharded_map needs at least one shard");
+
+ public:
+  // Тип ключа элемента (Key — параметр шаблона)
+  using key_type = Key;
+  // Тип значения элемента (Type — параметр шаблона)
+  using mapped_type = Type;
+  // Тип данных для пары ключ-значение
+  using value_type = std::pair<const key_type, mapped_type>;
+  // Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+  // Хеш ключей (Hash — параметр шаблона)
+  using hasher = Hash;
+  // Компаратор ключей (Compare — параметр шаблона)
+  using key_compare = Compare;
+  // Словарь одного сегмента
+  using shard_type = s21::map<key_type, mapped_type, key_compare>;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Количество сегментов
+  static constexpr size_type kShards = Shards;
+
+  sharded_map() = default;
+
+  sharded_map(std::initializer_list<value_type> const &items) {
+    for (const value_type &item : items) insert(item.first, item.second);
+  }
+
+  sharded_map(const sharded_map &) = delete;
+  sharded_map &operator=(const sharded_map &) = delete;
+
+  /**
+   * @brief Копирует значение с ключом key в value
+   *
+   * @return false элемента с ключом key нет, value не меняется
+   */
+  bool find(const key_type &key, mapped_type &value) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+    auto it = shard.map_.find(key);
+    if (it == shard.map_.end()) return false;
+    value = (*it).second;
+    return true;
+  }
+
+  /**
+   * @brief Возвращает копию значения с ключом key
+   *
+   * @throw std::out_of_range элемента с ключом key нет
+   */
+  mapped_type at(const key_type &key) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+    auto it = shard.map_.find(key);
+    if (it == shard.map_.end()) {
+      throw std::out_of_range(
+          "s21::sharded_map::at: No element exists with key equivalent to "
+          "key");
+    }
+    return (*it).second;
+  }
+
+  bool contains(const key_type &key) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+    return shard.map_.contains(key);
+  }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * @brief Вставляет пару (key, obj), если ключа key нет
+   *
+   * @return bool Произошла ли вставка
+   */
+  bool insert(const key_type &key, const mapped_type &obj) {
+    Shard &shard = ShardOf(key);
+    std::lock_guard<std::shared_mutex> lock(shard.mutex_);
+    return shard.map_.try_emplace(key, obj).second;
+  }
+
+  /**
+   * @brief Вставляет пару (key, obj) или присваивает obj значению
+   * существующего ключа
+   *
+   * @return bool true - элемент вставлен, false - значение присвоено
+   */
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    Shard &shard = ShardOf(key);
+    std::lock_guard<std::shared_mutex> lock(shard.mutex_);
+    return shard.map_.insert_or_assign(key, obj).second;
+  }
+
+  /**
+   * @brief Удаляет элемент с ключом key
+   *
+   * @return size_type Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) {
+    Shard &shard = ShardOf(key);
+    std::lock_guard<std::shared_mutex> lock(shard.mutex_);
+    auto it = shard.map_.find(key);
+    if (it == shard.map_.end()) return 0;
+    shard.map_.erase(it);
+    return 1;
+  }
+
+  void clear() {
+    for (Shard &shard : shards_) {
+      std::lock_guard<std::shared_mutex> lock(shard.mutex_);
+      shard.map_.clear();
+    }
+  }
+
+  /**
+   * @brief Сумма размеров сегментов. Сегменты блокируются по очереди, так
+   * что при параллельной записи это размер не на один момент времени.
+   */
+  size_type size() const {
+    size_type total = 0;
+    for (const Shard &shard : shards_) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+      total += shard.map_.size();
+    }
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Вызывает visit(const shard_type &) для каждого сегмента по
+   * очереди, каждый раз под блокировкой чтения этого сегмента
+   */
+  template <typename Visitor>
+  void for_each_shard(Visitor &&visit) const {
+    for (const Shard &shard : shards_) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+      visit(shard.map_);
+    }
+  }
+
+  /**
+   * @brief Параллельная версия: сегменты обходятся задачами планировщика с
+   * task_group (например, s21::ws_scheduler), поэтому visit может
+   * вызываться одновременно из разных потоков
+   */
+  template <typename Visitor, typename Scheduler>
+  void for_each_shard(Visitor &&visit, Scheduler &scheduler) const {
+    typename Scheduler::task_group group(scheduler);
+    for (const Shard &shard : shards_) {
+      group.run([&shard, &visit] {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+        visit(shard.map_);
+      });
+    }
+    group.wait();
+  }
+
+  /**
+   * @brief Вызывает visit(const_reference) для всех элементов в порядке
+   * возрастания ключей
+   *
+   * @details Блокировки чтения всех сегментов берутся разом (в порядке
+   * номеров сегментов), поэтому обход видит согласованное состояние
+   * словаря, но на время обхода останавливает запись. Сегменты сливаются
+   * через кучу из Shards курсоров: O(n log Shards).
+   */
+  template <typename Visitor>
+  void for_each_ordered(Visitor &&visit) const {
+    std::shared_lock<std::shared_mutex> locks[Shards];
+    for (size_type i = 0; i < Shards; ++i) {
+      locks[i] = std::shared_lock<std::shared_mutex>(shards_[i].mutex_);
+    }
+    // Итераторы s21::map не конструируются по умолчанию, поэтому куча
+    // лежит в std::vector, а не в s21::vector
+    s21::priority_queue<Cursor, std::vector<Cursor>, CursorCompare> heap(
+        CursorCompare{key_compare{}});
+    for (const Shard &shard : shards_) {
+      if (!shard.map_.empty()) {
+        heap.push(Cursor{shard.map_.begin(), shard.map_.end()});
+      }
+    }
+    while (!heap.empty()) {
+      Cursor cursor = heap.top();
+      heap.pop();
+      visit(*cursor.current_);
+      if (++cursor.current_ != cursor.end_) heap.push(cursor);
+    }
+  }
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex_;
+    shard_type map_;
+  };
+
+  // Позиция слияния в одном сегменте
+  struct Cursor {
+    typename shard_type::const_iterator current_;
+    typename shard_type::const_iterator end_;
+  };
+
+  // На вершине кучи - курсор с наименьшим ключом
+  struct CursorCompare {
+    bool operator()(const Cursor &a, const Cursor &b) const {
+      return cmp_((*b.current_).first, (*a.current_).first);
+    }
+
+    key_compare cmp_;
+  };
+
+  /**
+   * @brief Номер сегмента ключа. std::hash для целых - тождественная
+   * функция, поэтому хеш перемешивается (финализатор MurmurHash3), чтобы
+   * ключи с общим шагом не попадали в один сегмент.
+   */
+  size_type ShardIndex(const key_type &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h % Shards);
+  }
+
+  Shard &ShardOf(const key_type &key) { return shards_[ShardIndex(key)]; }
+  const Shard &ShardOf(const key_type &key) const {
+    return shards_[ShardIndex(key)];
+  }
+
+  Shard shards_[Shards];
+  hasher hash_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_SHARDED_MAP_H_
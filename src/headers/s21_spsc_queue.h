@@ -0,0 +1,237 @@
+/**
+ * @file s21_spsc_queue.h
+ * @brief s21::spsc_queue - ограниченная очередь без блокировок для одного
+ * производителя и одного потребителя (кольцевой буфер).
+ *
+ * @details Каждая операция выполняется за конечное число шагов без CAS и
+ * мьютексов (wait-free):
+ * 1) Производитель пишет элемент в ячейку tail_ и публикует его записью
+ * tail_ + 1 (release). Потребитель читает tail_ (acquire) и видит элемент.
+ * 2) Потребитель забирает элемент из ячейки head_ и освобождает ее записью
+ * head_ + 1 (release).
+ *
+ * head_ и tail_ лежат в разных строках кэша, чтобы потоки не мешали друг
+ * другу (false sharing). Кроме того, каждая сторона хранит в своей строке
+ * кэша копию чужого индекса и перечитывает настоящий индекс, только когда по
+ * копии не хватает элементов (места). Так обращения к чужой строке кэша
+ * происходят раз в несколько операций, а не на каждой.
+ *
+ * Пакетные try_push_bulk/try_pop_bulk публикуют сразу несколько элементов
+ * одной записью индекса.
+ *
+ * Вызывать try_push* можно только из одного потока, try_pop* - только из
+ * одного (другого) потока.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+template <typename T>
+class spsc_queue {
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пустую очередь
+   *
+   * @param capacity Максимальное количество элементов
+   * @throw std::invalid_argument capacity равна нулю
+   */
+  explicit spsc_queue(size_type capacity)
+      : head_(0U),
+        cached_tail_(0U),
+        tail_(0U),
+        cached_head_(0U),
+        capacity_(capacity),
+        mask_(0U),
+        slots_(nullptr) {
+    if (capacity_ == 0U) {
+      throw std::invalid_argument("spsc_queue capacity must be positive");
+    }
+    // Размер буфера - степень двойки, чтобы позиция считалась маской
+    size_type slots = 1U;
+    while (slots < capacity_) {
+      slots <<= 1U;
+    }
+    mask_ = slots - 1U;
+    slots_ = allocator_.allocate(slots);
+  }
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      Slot(i)->~value_type();
+    }
+    allocator_.deallocate(slots_, mask_ + 1U);
+  }
+
+  /**
+   * @brief Добавляет элемент, если есть свободное место. Вызывает только
+   * производитель.
+   *
+   * @return false очередь заполнена, элемент не добавлен (rvalue не
+   * забирается)
+   */
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  /**
+   * @brief Создает элемент из args прямо в буфере, если есть свободное место
+   *
+   * @return false очередь заполнена
+   */
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (Free(tail) == 0U) {
+      return false;
+    }
+    new (Slot(tail)) value_type(std::forward<Args>(args)...);
+    tail_.store(tail + 1U, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Добавляет до count элементов начиная с first, сколько поместится,
+   * и публикует их одной операцией
+   *
+   * @return Количество добавленных элементов
+   */
+  template <typename InputIt>
+  size_type try_push_bulk(InputIt first, size_type count) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type free = Free(tail, count);
+    if (count > free) {
+      count = free;
+    }
+    for (size_type i = 0; i < count; ++i, ++first) {
+      try {
+        new (Slot(tail + i)) value_type(*first);
+      } catch (...) {
+        // Уже созданные элементы остаются в очереди
+        tail_.store(tail + i, std::memory_order_release);
+        throw;
+      }
+    }
+    if (count > 0U) {
+      tail_.store(tail + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Извлекает первый элемент, если он есть. Вызывает только
+   * потребитель.
+   *
+   * @param value Сюда переносится извлеченный элемент
+   * @return false очередь пуста
+   */
+  bool try_pop(reference value) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (Available(head) == 0U) {
+      return false;
+    }
+    value_type *slot = Slot(head);
+    value = std::move(*slot);
+    slot->~value_type();
+    head_.store(head + 1U, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Извлекает до max элементов в out и освобождает их ячейки одной
+   * операцией
+   *
+   * @return Количество извлеченных элементов
+   */
+  template <typename OutputIt>
+  size_type try_pop_bulk(OutputIt out, size_type max) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type count = Available(head, max);
+    if (count > max) {
+      count = max;
+    }
+    for (size_type i = 0; i < count; ++i, ++out) {
+      value_type *slot = Slot(head + i);
+      *out = std::move(*slot);
+      slot->~value_type();
+    }
+    if (count > 0U) {
+      head_.store(head + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Примерное количество элементов: при параллельной работе значение
+   * может устареть сразу после чтения
+   */
+  size_type size_approx() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  bool empty() const noexcept { return size_approx() == 0U; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  value_type *Slot(size_type index) const noexcept {
+    return slots_ + (index & mask_);
+  }
+
+  // Свободное место с точки зрения производителя. Настоящий head_
+  // перечитывается, только если по копии места меньше, чем нужно.
+  size_type Free(size_type tail, size_type wanted = 1U) noexcept {
+    size_type free = capacity_ - (tail - cached_head_);
+    if (free < wanted) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      free = capacity_ - (tail - cached_head_);
+    }
+    return free;
+  }
+
+  // Готовые элементы с точки зрения потребителя
+  size_type Available(size_type head, size_type wanted = 1U) noexcept {
+    size_type available = cached_tail_ - head;
+    if (available < wanted) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      available = cached_tail_ - head;
+    }
+    return available;
+  }
+
+  // Строка кэша потребителя: его индекс и копия индекса производителя
+  alignas(64) std::atomic<size_type> head_;
+  size_type cached_tail_;
+  // Строка кэша производителя
+  alignas(64) std::atomic<size_type> tail_;
+  size_type cached_head_;
+  // Неизменяемые после создания поля
+  alignas(64) size_type capacity_;
+  size_type mask_;
+  value_type *slots_;
+  std::allocator<value_type> allocator_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_SPSC_QUEUE_H_
@@ -2,11 +2,14 @@
 #define SRC_HEADERS_S21_STACK_H_
 
 #include <exception>
+#include <utility>
 
 #include "s21_list.h"
 
 namespace s21 {
-template <typename T>
+// Container must provide back(), push_back(), emplace_back(), pop_back(),
+// empty(), size() and swap(): s21::list, s21::vector, std::deque, ...
+template <typename T, typename Container = s21::list<T>>
 class stack {
  public:
   // Stack Member type
@@ -14,6 +17,7 @@ class stack {
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using container_type = Container;
 
   // Stack Member functions
   stack();
@@ -21,7 +25,8 @@ class stack {
   stack(const stack &s);
   stack(stack &&s);
   ~stack();
-  stack operator=(stack &&s);
+  stack &operator=(const stack &s);
+  stack &operator=(stack &&s);
 
   // Stack Element access
   const_reference top();
@@ -32,88 +37,113 @@ class stack {
 
   // Stack Modifiers
   void push(const_reference value);
+  void push(value_type &&value);
   void pop();
   void swap(stack &other);
 
+  template <typename... Args>
+  reference emplace(Args &&...args);
+
   // Bonus part
   template <typename... Args>
   void insert_many_front(Args &&...args);
 
  private:
-  s21::list<value_type> container_;
+  container_type container_;
 };
 }  // namespace s21
 
 namespace s21 {
-template <typename value_type>
-stack<value_type>::stack() {
-  container_.clear();
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack() : container_() {}
 
-template <typename value_type>
-stack<value_type>::stack(std::initializer_list<value_type> const &items) {
-  container_.clear();
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(
+    std::initializer_list<value_type> const &items)
+    : container_() {
   for (const auto &item : items) {
     push(item);
   }
 }
 
-template <typename value_type>
-stack<value_type>::stack(const stack &s) {
-  container_ = s.container_;
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(const stack &s)
+    : container_(s.container_) {}
 
-template <typename value_type>
-stack<value_type>::stack(stack &&s) {
-  container_ = std::move(s.container_);
-}
+template <typename value_type, typename Container>
+stack<value_type, Container>::stack(stack &&s)
+    : container_(std::move(s.container_)) {}
 
-template <typename value_type>
-stack<value_type> stack<value_type>::operator=(stack &&s) {
-  container_ = std::move(s.container_);
+template <typename value_type, typename Container>
+stack<value_type, Container> &stack<value_type, Container>::operator=(
+    const stack &s) {
+  if (this != &s) {
+    container_ = s.container_;
+  }
   return *this;
 }
 
-template <typename value_type>
-stack<value_type>::~stack() {
-  container_.clear();
+template <typename value_type, typename Container>
+stack<value_type, Container> &stack<value_type, Container>::operator=(
+    stack &&s) {
+  if (this != &s) {
+    container_ = std::move(s.container_);
+  }
+  return *this;
 }
 
-template <typename value_type>
-typename stack<value_type>::size_type stack<value_type>::size() {
+template <typename value_type, typename Container>
+stack<value_type, Container>::~stack() {}
+
+template <typename value_type, typename Container>
+typename stack<value_type, Container>::size_type
+stack<value_type, Container>::size() {
   return container_.size();
 }
 
-template <typename value_type>
-bool stack<value_type>::empty() {
+template <typename value_type, typename Container>
+bool stack<value_type, Container>::empty() {
   return container_.empty();
 }
 
-template <typename value_type>
-void stack<value_type>::push(const_reference value) {
-  container_.push_front(value);
+template <typename value_type, typename Container>
+void stack<value_type, Container>::push(const_reference value) {
+  container_.push_back(value);
+}
+
+template <typename value_type, typename Container>
+void stack<value_type, Container>::push(value_type &&value) {
+  container_.push_back(std::move(value));
 }
 
-template <typename value_type>
-void stack<value_type>::pop() {
-  container_.pop_front();
+template <typename value_type, typename Container>
+void stack<value_type, Container>::pop() {
+  container_.pop_back();
 }
 
-template <typename value_type>
-void stack<value_type>::swap(stack &other) {
+template <typename value_type, typename Container>
+void stack<value_type, Container>::swap(stack &other) {
   container_.swap(other.container_);
 }
 
-template <typename value_type>
-typename stack<value_type>::const_reference stack<value_type>::top() {
-  return container_.front();
+template <typename value_type, typename Container>
+typename stack<value_type, Container>::const_reference
+stack<value_type, Container>::top() {
+  return container_.back();
+}
+
+template <typename value_type, typename Container>
+template <typename... Args>
+typename stack<value_type, Container>::reference
+stack<value_type, Container>::emplace(Args &&...args) {
+  return container_.emplace_back(std::forward<Args>(args)...);
 }
 
-template <typename value_type>
+template <typename value_type, typename Container>
 template <typename... Args>
-void stack<value_type>::insert_many_front(Args &&...args) {
-  container_.insert_many_front(args...);
+void stack<value_type, Container>::insert_many_front(Args &&...args) {
+  (container_.push_back(std::forward<Args>(args)), ...);
 }
 }  // namespace s21
 
-#endif  // SRC_HEADERS_S21_STACK_H_
\ No newline at end of file
+#endif  // SRC_HEADERS_S21_STACK_H_
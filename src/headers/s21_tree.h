@@ -18,23 +18,48 @@
  * Подробное описание организации обхода дерева и структуры (включая служебный
  * узел) - см. описание класса итератора.
  *
+ * Узлы (кроме головы) выделяются из пула дерева (RedBlackTreeNodePool)
+ * блоками, а не по одному. Подробнее - см. описание пула.
+ *
+ * Если параметр шаблона OrderStatistics равен true, каждый узел хранит размер
+ * своего поддерева (count_). Размеры обновляются при вставке, удалении и
+ * поворотах, и дерево умеет за O(log n) находить k-й элемент (Select()),
+ * позицию ключа (Rank()), количество эквивалентных элементов (Count()) и
+ * расстояние между итераторами (Distance()). При false поле отсутствует и
+ * не обновляется, т.е. ничего не стоит.
+ *
+ * Merge(), MergeUnique(), Intersect() и Subtract() работают через split/join:
+ * дерево разрезается по корню другого дерева, половины обрабатываются
+ * рекурсивно (при желании - параллельно на планировщике задач) и склеиваются
+ * обратно, что дает O(m log(n/m + 1)) сравнений вместо O(m log n). Так же
+ * EraseRange() вырезает диапазон двумя разрезами и освобождает его целиком
+ * за O(log n + k).
+ *
  */
 
 #ifndef S21_CONTAINERS_S21_CONTAINERS_S21_TREE_H_
 #define S21_CONTAINERS_S21_CONTAINERS_S21_TREE_H_
-
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace s21 {
 // Цвета для узлов дерева
 enum RedBlackTreeColor { kBlack, kRed };
 
-template <typename Key, typename Comparator = std::less<Key>>
+template <typename Key, typename Comparator = std::less<Key>,
+          bool OrderStatistics = false>
 class RedBlackTree {
  private:
   struct RedBlackTreeNode;
+  struct RedBlackTreeNodePool;
   struct RedBlackTreeIterator;
   struct RedBlackTreeIteratorConst;
 #if defined(S21_CONTAINERS_TREE_TEST_HELPER)
@@ -54,14 +79,31 @@ class RedBlackTree {
   using const_iterator = RedBlackTreeIteratorConst;
   // Тип для размера контейнера
   using size_type = std::size_t;
+  // Тип для расстояния между итераторами
+  using difference_type = std::ptrdiff_t;
 
   // Внутренний класс для дерева
   using tree_type = RedBlackTree;
   // Внутренний класс узла дерева
   using tree_node = RedBlackTreeNode;
+  // Внутренний класс пула узлов дерева
+  using node_pool = RedBlackTreeNodePool;
   // Внутренний тип для цвета дерева
   using tree_color = RedBlackTreeColor;
 
+  /**
+   * @brief Результат FindInsertPosition()
+   */
+  struct InsertPosition {
+    // Найденный элемент, если found_, иначе будущий родитель нового элемента
+    // (nullptr для пустого дерева)
+    tree_node *node_;
+    // Найден ли элемент с эквивалентным ключом
+    bool found_;
+    // Станет ли новый элемент левым потомком node_
+    bool as_left_;
+  };
+
   /**
    * @brief Конструктор по умолчанию, создает пустое дерево
    */
@@ -134,7 +176,17 @@ class RedBlackTree {
    * остается консистентным.
    */
   void Clear() noexcept {
-    Destroy(Root());
+    if (pool_.Exclusive()) {
+      // Блоки пула не разделены с другими деревьями: вызываем деструкторы
+      // значений (если они нужны) и освобождаем блоки разом, не возвращая
+      // узлы по одному
+      if (!std::is_trivially_destructible<key_type>::value) {
+        DestroyKeys(Root());
+      }
+      pool_.Reset();
+    } else {
+      Destroy(Root());
+    }
     InitializeHead();
     // Размер пустого дерева всегда 0
     size_ = 0;
@@ -236,59 +288,27 @@ class RedBlackTree {
    * указатели и ссылки на переданные элементы остаются действительными, но
    * теперь ссылаются на *this, а не на other.
    *
-   * В данной функции мы переносим все элементы, даже если такие уже есть в
-   * текущем дереве. Поэтому мы не используем функцию ExtractNode(), т.к. она
-   * вызывает перебалансировку дерева other после изъятия узла, что лишняя
-   * ненужная операция, т.к. все равно будут перенесены все без исключения
-   * элементы other. Поэтому мы проходимся по порядку по всем элементам other,
-   * изымаем их и вставляем в текущее дерево.
-   *
-   * Т.к. мы не создаем копии узлов, то это экономит много времени.
+   * Деревья объединяются через split/join (см. Union()), поэтому слияние
+   * деревьев из n и m элементов (m <= n) стоит O(m log(n/m + 1)), а деревья
+   * с непересекающимися диапазонами ключей сливаются за O(log n). Если other
+   * меньше дерева в kInsertMergeRatio раз и больше, его узлы вставляются по
+   * одному (см. InsertNodesOf()). Элементы other, эквивалентные элементам
+   * this, встают после них, как при вставке по одному.
    *
    * @param other
    */
-  void Merge(tree_type &other) {
-    if (this != &other) {
-      iterator other_begin = other.Begin();
-
-      // Пока элементы есть в other, извлекаем их
-      while (other.size_ > 0) {
-        tree_node *moving_node = other_begin.node_;
-        ++other_begin;
-
-        // Отцепляем узел от других узлов в other
+  void Merge(tree_type &other) { MergeTrees(other, false, SequentialFork{}); }
 
-        if (moving_node->left_ != nullptr) {
-          // Т.к. у нас обход слева направо, то left_ всегда будет
-          // nullptr Однако оставим эту проверку на случай
-          // изменения/доработки алгоритма
-          moving_node->left_->parent_ = moving_node->parent_;
-        }
-
-        if (moving_node->right_ != nullptr) {
-          moving_node->right_->parent_ = moving_node->parent_;
-        }
-
-        if (moving_node->parent_->left_ == moving_node) {
-          moving_node->parent_->left_ = nullptr;
-        }
-
-        if (moving_node->parent_->right_ == moving_node) {
-          moving_node->parent_->right_ = nullptr;
-        }
-
-        // Приводим узел к виду по умолчанию
-        moving_node->ToDefault();
-
-        --other.size_;
-
-        Insert(Root(), moving_node, false);
-      }
-
-      // Приводим head дерева other в корректное состояние для пустого
-      // контейнера, чтобы other остался консистентным.
-      other.InitializeHead();
-    }
+  /**
+   * @brief Параллельная версия Merge(): независимые половины рекурсии
+   * выполняются задачами scheduler (например, s21::ws_scheduler)
+   *
+   * @tparam Scheduler Планировщик с вложенным классом task_group (методы
+   * run() и wait())
+   */
+  template <typename Scheduler>
+  void Merge(tree_type &other, Scheduler &scheduler) {
+    MergeTrees(other, false, ParallelFork<Scheduler>{scheduler});
   }
 
   /**
@@ -301,30 +321,127 @@ class RedBlackTree {
    * указатели и ссылки на переданные элементы остаются действительными, но
    * теперь ссылаются на *this, а не на other.
    *
-   * Т.к. other может остаться непустым после операции, то для извлечения
-   * узлов из other мы используем ExtractNode(), т.к. она вызывает
-   * перебалансировку, а мы должны сохранить other корректным красно-чёрным
-   * деревом.
+   * Как и Merge(), работает через split/join за O(m log(n/m + 1)) или
+   * вставкой узлов по одному, если other намного меньше.
+   * Оставшиеся в other элементы (дубликаты) собираются из уже существующих
+   * узлов в сбалансированное дерево за O(число дубликатов).
    *
    * @param other
    */
   void MergeUnique(tree_type &other) {
-    if (this != &other) {
-      iterator other_begin = other.Begin();
-      iterator other_end = other.End();
-
-      while (other_begin != other_end) {
-        iterator result_it = Find(other_begin.node_->key_);
-        if (result_it == End()) {
-          iterator tmp = other_begin;
-          ++other_begin;
-          tree_node *moving_node = other.ExtractNode(tmp);
-          Insert(Root(), moving_node, false);
-        } else {
-          ++other_begin;
-        }
+    MergeTrees(other, true, SequentialFork{});
+  }
+
+  /**
+   * @brief Параллельная версия MergeUnique() (см. Merge(other, scheduler))
+   */
+  template <typename Scheduler>
+  void MergeUnique(tree_type &other, Scheduler &scheduler) {
+    MergeTrees(other, true, ParallelFork<Scheduler>{scheduler});
+  }
+
+  /**
+   * @brief Оставляет в дереве только элементы, для которых в other есть
+   * элемент с эквивалентным ключом (пересечение множеств). Только для
+   * деревьев без повторяющихся ключей.
+   *
+   * @details other не меняется. Оставшиеся узлы не копируются, ссылки на них
+   * остаются действительными. Стоит O(m log(n/m + 1)) плюс удаление
+   * выброшенных элементов.
+   */
+  void Intersect(const tree_type &other) {
+    IntersectTrees(other, SequentialFork{});
+  }
+
+  /**
+   * @brief Параллельная версия Intersect() (см. Merge(other, scheduler))
+   */
+  template <typename Scheduler>
+  void Intersect(const tree_type &other, Scheduler &scheduler) {
+    IntersectTrees(other, ParallelFork<Scheduler>{scheduler});
+  }
+
+  /**
+   * @brief Удаляет из дерева элементы, для которых в other есть элемент с
+   * эквивалентным ключом (разность множеств). Только для деревьев без
+   * повторяющихся ключей.
+   *
+   * @details other не меняется. Оставшиеся узлы не копируются, ссылки на них
+   * остаются действительными. Стоит O(m log(n/m + 1)) плюс удаление
+   * выброшенных элементов.
+   */
+  void Subtract(const tree_type &other) {
+    SubtractTrees(other, SequentialFork{});
+  }
+
+  /**
+   * @brief Параллельная версия Subtract() (см. Merge(other, scheduler))
+   */
+  template <typename Scheduler>
+  void Subtract(const tree_type &other, Scheduler &scheduler) {
+    SubtractTrees(other, ParallelFork<Scheduler>{scheduler});
+  }
+
+  /**
+   * @brief Заменяет содержимое дерева элементами диапазона [first, last).
+   *
+   * @details Вместо вставки по одному элементу (спуск, балансировка и
+   * копия на каждый элемент) дерево строится снизу вверх за O(n) без
+   * поворотов (см. BuildSubtree()). Если диапазон не отсортирован, элементы
+   * сначала копируются в буфер и сортируются устойчивой сортировкой, поэтому
+   * общая сложность O(n log n). Для уже отсортированного диапазона прямого
+   * доступа к элементам нужного типа буфер не создается.
+   *
+   * Результат совпадает с поэлементной вставкой: при unique_only из
+   * эквивалентных элементов остается первый, иначе эквивалентные элементы
+   * сохраняют порядок диапазона.
+   *
+   * Новое дерево строится до очистки текущего, поэтому диапазон может
+   * указывать на элементы самого дерева, а при исключении содержимое дерева
+   * не меняется.
+   *
+   * @param unique_only Режим вставки (см. Insert())
+   */
+  template <typename InputIt>
+  void Assign(InputIt first, InputIt last, bool unique_only) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    using item_type = typename std::iterator_traits<InputIt>::value_type;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value &&
+                  std::is_same<item_type, key_type>::value) {
+      if (IsSortedRange(first, last, unique_only)) {
+        size_type count = std::distance(first, last);
+        BuildFromSorted([&first]() -> const key_type & { return *first++; },
+                        count);
+        return;
       }
     }
+
+    // Сортируются указатели: элементы (например, std::pair<const Key, T> у
+    // map) могут быть неприсваиваемыми, а указатели еще и дешевле переставлять
+    std::vector<key_type> keys(first, last);
+    std::vector<key_type *> order;
+    order.reserve(keys.size());
+    for (key_type &key : keys) {
+      order.push_back(&key);
+    }
+    auto less = [this](const key_type *a, const key_type *b) {
+      return cmp_(*a, *b);
+    };
+    if (!std::is_sorted(order.begin(), order.end(), less)) {
+      std::stable_sort(order.begin(), order.end(), less);
+    }
+    if (unique_only) {
+      // В отсортированном диапазоне a и следующий за ним b эквивалентны,
+      // если !(a < b)
+      order.erase(std::unique(order.begin(), order.end(),
+                              [&less](const key_type *a, const key_type *b) {
+                                return !less(a, b);
+                              }),
+                  order.end());
+    }
+    auto it = order.begin();
+    BuildFromSorted([&it]() -> key_type && { return std::move(**it++); },
+                    order.size());
   }
 
   /**
@@ -336,10 +453,96 @@ class RedBlackTree {
    * @return iterator Итератор, указывающий на вставленный элемент
    */
   iterator Insert(const key_type &key) {
-    tree_node *new_node = new tree_node{key};
+    tree_node *new_node = pool_.Create(key);
     return Insert(Root(), new_node, false).first;
   }
 
+  /**
+   * @brief Ищет за один спуск элемент с ключом, эквивалентным key, или
+   * место, куда такой элемент встанет (режим уникальных ключей).
+   *
+   * @details Вместе с InsertAt() позволяет сделать "найти или вставить"
+   * (operator[], try_emplace, insert_or_assign) за один проход по дереву и
+   * создавать элемент только при его отсутствии.
+   *
+   * @tparam K Тип ключа: key_type или тип, который компаратор умеет
+   * сравнивать с key_type
+   * @return InsertPosition Найденный элемент (found_) или позиция вставки
+   */
+  template <typename K>
+  InsertPosition FindInsertPosition(const K &key) {
+    InsertPosition position{nullptr, false, false};
+    position.node_ = SearchInsertParent(key, true, position.found_);
+    position.as_left_ = !position.found_ && position.node_ != nullptr &&
+                        cmp_(key, position.node_->key_);
+    return position;
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его в позицию, найденную
+   * FindInsertPosition(). Между поиском и вставкой дерево не должно
+   * меняться, а элемента по позиции не должно быть найдено (!found_).
+   *
+   * @return iterator Итератор на вставленный элемент
+   */
+  template <typename... Args>
+  iterator InsertAt(const InsertPosition &position, Args &&...args) {
+    return LinkNode(position.node_,
+                    pool_.Create(std::in_place, std::forward<Args>(args)...),
+                    position.as_left_);
+  }
+
+  /**
+   * @brief Вставляет элемент со значением key как можно ближе к позиции
+   * перед hint
+   *
+   * @param unique_only Режим вставки (см. Insert())
+   * @return std::pair<iterator, bool> Формат как у InsertUnique()
+   */
+  std::pair<iterator, bool> InsertHint(const_iterator hint,
+                                       const key_type &key, bool unique_only) {
+    bool found = false;
+    bool as_left = false;
+    tree_node *parent =
+        SearchHintParent(hint, key, unique_only, found, as_left);
+    if (found) {
+      return {iterator(parent), false};
+    }
+    return {LinkNode(parent, pool_.Create(key), as_left), true};
+  }
+
+  /**
+   * @brief Создает элемент из args и вставляет его как можно ближе к
+   * позиции перед hint
+   *
+   * @details Значение ключа неизвестно до создания элемента, поэтому узел
+   * создается сразу. Если вставка не произошла, узел возвращается в пул.
+   *
+   * @param unique_only Режим вставки (см. Insert())
+   * @return std::pair<iterator, bool> Формат как у InsertUnique()
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> EmplaceHint(const_iterator hint, bool unique_only,
+                                        Args &&...args) {
+    tree_node *new_node =
+        pool_.Create(std::in_place, std::forward<Args>(args)...);
+    bool found = false;
+    bool as_left = false;
+    tree_node *parent = nullptr;
+    try {
+      parent =
+          SearchHintParent(hint, new_node->key_, unique_only, found, as_left);
+    } catch (...) {
+      pool_.Destroy(new_node);
+      throw;
+    }
+    if (found) {
+      pool_.Destroy(new_node);
+      return {iterator(parent), false};
+    }
+    return {LinkNode(parent, new_node, as_left), true};
+  }
+
   /**
    * @brief Вставляет элемент со значением key в контейнер, если контейнер еще
    * не содержит элемент с эквивалентным ключом.
@@ -351,14 +554,14 @@ class RedBlackTree {
    * (false, если вставка не произошла
    */
   std::pair<iterator, bool> InsertUnique(const key_type &key) {
-    tree_node *new_node = new tree_node{key};
-    std::pair<iterator, bool> result = Insert(Root(), new_node, true);
-    if (result.second == false) {
-      // Если вставка не произошла, то удаляем созданный узел
-      delete new_node;
+    // Сначала ищем место, и только если эквивалентного элемента нет, создаем
+    // узел: неудачная вставка ничего не выделяет
+    bool found = false;
+    tree_node *parent = SearchInsertParent(key, true, found);
+    if (found) {
+      return {iterator(parent), false};
     }
-
-    return result;
+    return {LinkNode(parent, pool_.Create(key)), true};
   }
 
   /**
@@ -396,7 +599,7 @@ class RedBlackTree {
     // копирований в item
     for (auto item : {std::forward<Args>(args)...}) {
       // И используем std::move, чтобы опять избежать лишних копирований
-      tree_node *new_node = new tree_node(std::move(item));
+      tree_node *new_node = pool_.Create(std::move(item));
       std::pair<iterator, bool> result_insert = Insert(Root(), new_node, false);
       result.push_back(result_insert);
     }
@@ -423,12 +626,16 @@ class RedBlackTree {
     result.reserve(sizeof...(args));
 
     for (auto item : {std::forward<Args>(args)...}) {
-      tree_node *new_node = new tree_node(std::move(item));
-      std::pair<iterator, bool> result_insert = Insert(Root(), new_node, true);
-      if (result_insert.second == false) {
-        delete new_node;
+      bool found = false;
+      // item может быть другого типа, чем key_type (тип выводится из args),
+      // поэтому сравнение идет с key_type, как при вставке
+      tree_node *parent = SearchInsertParent<key_type>(item, true, found);
+      if (found) {
+        result.push_back({iterator(parent), false});
+      } else {
+        result.push_back(
+            {LinkNode(parent, pool_.Create(std::move(item))), true});
       }
-      result.push_back(result_insert);
     }
     return result;
   }
@@ -438,14 +645,20 @@ class RedBlackTree {
    * регулирует, какой именно элемент будет найден, если их несколько, но в
    * gcc находится элемент из lower_bound(), поэтому делаем аналогично
    *
+   * @details Здесь и в LowerBound(), UpperBound(), EqualRange() тип ключа K
+   * может отличаться от key_type, если компаратор умеет сравнивать K с
+   * key_type (прозрачный компаратор или компаратор словаря): так поиск не
+   * создает временный key_type.
+   *
    * @param key Искомый ключ
    * @return iterator Итератор найденного элемента. Если такой элемент не
    * найден, возвращается end().
    */
-  iterator Find(const_reference key) {
+  template <typename K>
+  iterator Find(const K &key) {
     iterator result = LowerBound(key);
 
-    if (result == End() || cmp_(key, *result)) {
+    if (result == End() || cmp_(key, result.node_->key_)) {
       // Если LowerBound() ничего не нашел или нашел элемент > key
       return End();
     }
@@ -498,7 +711,8 @@ class RedBlackTree {
    * @return iterator Итератор, указывающий на первый элемент, который не
    * меньше key. Если такой элемент не найден, возвращается итератор End().
    */
-  iterator LowerBound(const_reference key) {
+  template <typename K>
+  iterator LowerBound(const K &key) {
     // Начинаем от корня
     tree_node *start = Root();
     // Результат по умолчанию End(), он и будет использован, если в ходе
@@ -530,175 +744,1199 @@ class RedBlackTree {
   }
 
   /**
-   * @brief Возвращает итератор, указывающий на первый элемент, который больше
-   * key.
-   *
-   * @details Алгоритм в целом аналогичен LowerBound, но типа наоборот (см.
-   * отличия в комментариях по ходу функции).
+   * @brief Возвращает итератор, указывающий на первый элемент, который больше
+   * key.
+   *
+   * @details Алгоритм в целом аналогичен LowerBound, но типа наоборот (см.
+   * отличия в комментариях по ходу функции).
+   *
+   * @param key ключевое значение, с которым сравниваются элементы
+   * @return iterator Итератор, указывающий на первый элемент, который больше
+   * key. Если такой элемент не найден, возвращается итератор End().
+   */
+  template <typename K>
+  iterator UpperBound(const K &key) {
+    tree_node *start = Root();
+    tree_node *result = End().node_;
+
+    while (start != nullptr) {
+      if (cmp_(key, start->key_)) {
+        // Если искомое значение меньше значения узла, то запоминаем
+        // текущий узел, т.к. он больше искомого
+        result = start;
+        // Продолжаем поиски в левой ветви, т.к. там могут быть значения
+        // меньше текущего узла, а нам надо найти самый маленький (т.е.
+        // ближайший к key) узел
+        start = start->left_;
+      } else
+        // В противном случае ищем узлы в правой ветви
+        start = start->right_;
+    }
+
+    return iterator(result);
+  }
+
+  /**
+   * @brief Возвращает диапазон элементов, эквивалентных key: пару
+   * [LowerBound(key), UpperBound(key)).
+   *
+   * @details Общая часть двух спусков проходится один раз: до первого
+   * узла, эквивалентного key, пути LowerBound и UpperBound совпадают, а
+   * после него нижняя граница ищется в левом поддереве узла, а верхняя - в
+   * правом.
+   */
+  template <typename K>
+  std::pair<iterator, iterator> EqualRange(const K &key) {
+    tree_node *node = Root();
+    tree_node *upper = End().node_;
+
+    while (node != nullptr) {
+      if (cmp_(key, node->key_)) {
+        upper = node;
+        node = node->left_;
+      } else if (cmp_(node->key_, key)) {
+        node = node->right_;
+      } else {
+        tree_node *lower = node;
+        for (tree_node *left = node->left_; left != nullptr;) {
+          if (!cmp_(left->key_, key)) {
+            lower = left;
+            left = left->left_;
+          } else {
+            left = left->right_;
+          }
+        }
+        for (tree_node *right = node->right_; right != nullptr;) {
+          if (cmp_(key, right->key_)) {
+            upper = right;
+            right = right->left_;
+          } else {
+            right = right->right_;
+          }
+        }
+        return {iterator(lower), iterator(upper)};
+      }
+    }
+
+    return {iterator(upper), iterator(upper)};
+  }
+
+  /**
+   * @brief Возвращает количество элементов, эквивалентных key: за O(log n)
+   * при OrderStatistics, иначе за O(log n + k), где k - количество
+   * найденных элементов.
+   */
+  template <typename K>
+  size_type Count(const K &key) {
+    if constexpr (OrderStatistics) {
+      return RankUpper(key) - Rank(key);
+    } else {
+      std::pair<iterator, iterator> range = EqualRange(key);
+      return static_cast<size_type>(std::distance(range.first, range.second));
+    }
+  }
+
+  /**
+   * @brief Возвращает итератор на элемент с индексом index (0 - самый
+   * маленький) или End(), если index >= Size(). Только для OrderStatistics.
+   */
+  iterator Select(size_type index) {
+    static_assert(OrderStatistics,
+                  "Select() requires RedBlackTree<..., OrderStatistics=true>");
+    if (index >= size_) return End();
+    tree_node *node = Root();
+    for (;;) {
+      size_type left = SubtreeCount(node->left_);
+      if (index < left) {
+        node = node->left_;
+      } else if (index == left) {
+        return iterator(node);
+      } else {
+        index -= left + 1;
+        node = node->right_;
+      }
+    }
+  }
+
+  /**
+   * @brief Возвращает количество элементов меньше key (т.е. индекс
+   * LowerBound(key)). Только для OrderStatistics.
+   */
+  template <typename K>
+  size_type Rank(const K &key) const {
+    static_assert(OrderStatistics,
+                  "Rank() requires RedBlackTree<..., OrderStatistics=true>");
+    size_type rank = 0;
+    for (const tree_node *node = Root(); node != nullptr;) {
+      if (cmp_(node->key_, key)) {
+        rank += SubtreeCount(node->left_) + 1;
+        node = node->right_;
+      } else {
+        node = node->left_;
+      }
+    }
+    return rank;
+  }
+
+  /**
+   * @brief Возвращает количество элементов не больше key (т.е. индекс
+   * UpperBound(key)). Только для OrderStatistics.
+   */
+  template <typename K>
+  size_type RankUpper(const K &key) const {
+    static_assert(
+        OrderStatistics,
+        "RankUpper() requires RedBlackTree<..., OrderStatistics=true>");
+    size_type rank = 0;
+    for (const tree_node *node = Root(); node != nullptr;) {
+      if (!cmp_(key, node->key_)) {
+        rank += SubtreeCount(node->left_) + 1;
+        node = node->right_;
+      } else {
+        node = node->left_;
+      }
+    }
+    return rank;
+  }
+
+  /**
+   * @brief Возвращает индекс элемента pos (Size() для End()) подъемом от
+   * узла к корню. Только для OrderStatistics.
+   */
+  size_type Index(const_iterator pos) const {
+    static_assert(OrderStatistics,
+                  "Index() requires RedBlackTree<..., OrderStatistics=true>");
+    const tree_node *node = pos.node_;
+    if (node == head_) return size_;
+    size_type index = SubtreeCount(node->left_);
+    for (; node->parent_ != head_; node = node->parent_) {
+      if (node == node->parent_->right_) {
+        index += SubtreeCount(node->parent_->left_) + 1;
+      }
+    }
+    return index;
+  }
+
+  /**
+   * @brief Возвращает расстояние от first до last: за O(log n) при
+   * OrderStatistics, иначе перебором, как std::distance()
+   */
+  difference_type Distance(const_iterator first, const_iterator last) const {
+    if constexpr (OrderStatistics) {
+      return static_cast<difference_type>(Index(last)) -
+             static_cast<difference_type>(Index(first));
+    } else {
+      return std::distance(first, last);
+    }
+  }
+
+  /**
+   * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
+   * элементы становятся недействительными. Другие ссылки и итераторы не
+   * затрагиваются.
+   *
+   * @param pos
+   */
+  void Erase(iterator pos) noexcept {
+    tree_node *result = ExtractNode(pos);
+    if (result != nullptr) {
+      pool_.Destroy(result);
+    }
+  }
+
+  /**
+   * @brief Удаляет элементы [first, last) и возвращает их количество.
+   * Итераторы на остальные элементы (и last) остаются действительными.
+   *
+   * @details Дерево разрезается (Split) перед first и перед last, средняя
+   * часть разбирается целиком, а крайние соединяются (Join()). В отличие от
+   * k вызовов Erase() нет балансировки после каждого узла: O(log n + k).
+   */
+  size_type EraseRange(const_iterator first, const_iterator last) noexcept {
+    if (first == last) return 0;
+    size_type size = size_;
+    if (first.node_ == MostLeft() && last.node_ == head_) {
+      Clear();
+      return size;
+    }
+    SplitResult low = SplitBefore(DetachRoot(), first.node_);
+    Subtree middle = Join(Subtree{nullptr, 0}, low.found_, low.right_);
+    Subtree right{nullptr, 0};
+    if (last.node_ != head_) {
+      SplitResult high = SplitBefore(middle, last.node_);
+      middle = high.left_;
+      right = Join(Subtree{nullptr, 0}, high.found_, high.right_);
+    }
+    NodeChain dropped;
+    dropped.Append(middle.root_);
+    size_type count = DestroyChain(dropped);
+    AttachRoot(Join(low.left_, right).root_, size - count);
+    return count;
+  }
+
+  /**
+   * @brief Удаляет элементы с ключами из [lo, hi) и возвращает их
+   * количество. При !(lo < hi) ничего не удаляет.
+   */
+  template <typename K>
+  size_type EraseKeyRange(const K &lo, const K &hi) {
+    iterator first = LowerBound(lo);
+    iterator last = LowerBound(hi);
+    // Ключи сравниваются только с элементами (у словаря компаратор не
+    // сравнивает ключи между собой), поэтому hi < lo узнается по границам
+    if (first == End() ||
+        (last != End() && cmp_(last.node_->key_, first.node_->key_))) {
+      return 0;
+    }
+    return EraseRange(first, last);
+  }
+
+  /**
+   * @brief Вызывает visit(key_type &) для элементов с ключами из [lo, hi)
+   * по возрастанию
+   *
+   * @details Обход in-order с отсечением: поддеревья целиком левее lo или
+   * правее hi не посещаются, а внутри поддерева, которое целиком лежит в
+   * диапазоне, ключи больше не сравниваются. Вместо k вызовов NextNode()
+   * (каждый - подъем или спуск по дереву) каждый узел проходится один раз:
+   * O(log n + k).
+   */
+  template <typename K, typename Visitor>
+  void ForEachInRange(const K &lo, const K &hi, Visitor &&visit) {
+    VisitRange(Root(), lo, hi, visit, false, false);
+  }
+
+  /**
+   * @brief Версия ForEachInRange() для const-объектов: visit получает
+   * const key_type &
+   */
+  template <typename K, typename Visitor>
+  void ForEachInRange(const K &lo, const K &hi, Visitor &&visit) const {
+    const_cast<tree_type *>(this)->ForEachInRange(
+        lo, hi, [&visit](const key_type &key) { visit(key); });
+  }
+
+  /**
+   * @brief Обменяет содержимое контейнера на содержимое other
+   * @details Не вызывает никаких операций перемещения, копирования или замены
+   * отдельных элементов. Все итераторы и ссылки остаются действительными.
+   * Итератор End() становится недействительным.
+   *
+   * Проверка на самосвап бессмысленна, т.к. дерево это переживает, а лишняя
+   * проверка будет всегда вызываться, а реально будет редко нужна.
+   *
+   * @param other
+   */
+  void Swap(tree_type &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(cmp_, other.cmp_);
+    pool_.Swap(other.pool_);
+  }
+
+  /**
+   * @brief Метод для тестирования красно-черного дерева на корректность.
+   * @details Проверяет все правила, которые должны соблюдаться для дерева
+   * (см. описание в начале файла). Пояснения написаны по ходу метода.
+   *
+   * @return true Дерево корректно
+   * @return false Дерево некорректно
+   */
+  bool CheckTree() const noexcept {
+    // head дерева должен быть красный.
+    if (head_->color_ == kBlack) {
+      return false;
+    }
+
+    // Пустое дерево корректно всегда
+    if (Root() == nullptr) {
+      return true;
+    }
+
+    // Корень дерева должен быть чёрный.
+    if (Root()->color_ == kRed) {
+      return false;
+    }
+
+    // Оба потомка каждого красного узла — чёрные.
+    if (checkRedNodes(Root()) == false) {
+      return false;
+    }
+
+    // Любой простой путь от узла-предка до листового узла-потомка содержит
+    // одинаковое число чёрных узлов.
+    if (ComputeBlackHeight(Root()) == -1) {
+      return false;
+    }
+
+    // Если всё ок, то возвращаем true
+    return true;
+  }
+
+ private:
+  /**
+   * @brief Приватный метод для копирования дерева other в this.
+   *
+   * @param other Копируемое дерево
+   */
+  void CopyTreeFromOther(const tree_type &other) {
+    // Копия строится в отдельном пуле, т.к. Clear() ниже может освободить
+    // блоки текущего пула целиком
+    node_pool copy_pool;
+    pool_.Swap(copy_pool);
+    tree_node *other_copy_root = nullptr;
+    try {
+      other_copy_root = CopyTree(other.Root(), nullptr);
+    } catch (...) {
+      pool_.Swap(copy_pool);
+      throw;
+    }
+    pool_.Swap(copy_pool);
+    // Важно, что мы сначала создаем полную копию, а только потом вызываем
+    // очистку текущего дерева. Это необходимо для того, чтобы текущее
+    // дерево не было уничтожено, если при копировании вылетит исключение
+    // (см. тесты "CopyLeaks").
+    Clear();
+    pool_.Swap(copy_pool);
+    Root() = other_copy_root;
+    Root()->parent_ = head_;
+    MostLeft() = SearchMinimum(Root());
+    MostRight() = SearchMaximum(Root());
+    size_ = other.size_;
+    cmp_ = other.cmp_;
+  }
+
+  /**
+   * @brief Приватный метод для создания копий узлов поддерева node и связей
+   * между ними
+   *
+   * @details Обход идет без рекурсии и без стека: из узла спускаемся в
+   * первого еще не скопированного потомка, а если таких нет - поднимаемся к
+   * родителю одновременно в исходном дереве и в копии. Скопирован ли потомок,
+   * видно по указателю у копии, поэтому память кроме самой копии не нужна и
+   * глубина дерева не ограничена размером стека.
+   *
+   * @param node копируемый узел.
+   * @param parent копия родителя копируемого узла.
+   * @return tree_node* указатель на созданную копию узла.
+   */
+  [[nodiscard]] tree_node *CopyTree(const tree_node *node, tree_node *parent) {
+    // Если вылетит исключение при создании самого первого узла, то ничего
+    // страшного, ничего создано не будет
+    tree_node *root = CopyNode(node, parent);
+    const tree_node *source = node;
+    tree_node *copy = root;
+    // Остальные узлы создаются в try/catch, чтобы в случае исключения
+    // удалить все уже скопированные узлы (иначе будет утечка)
+    try {
+      for (;;) {
+        if (source->left_ != nullptr && copy->left_ == nullptr) {
+          copy->left_ = CopyNode(source->left_, copy);
+          source = source->left_;
+          copy = copy->left_;
+        } else if (source->right_ != nullptr && copy->right_ == nullptr) {
+          copy->right_ = CopyNode(source->right_, copy);
+          source = source->right_;
+          copy = copy->right_;
+        } else if (source != node) {
+          source = source->parent_;
+          copy = copy->parent_;
+        } else {
+          break;
+        }
+      }
+    } catch (...) {
+      Destroy(root);
+      throw;
+    }
+    return root;
+  }
+
+  /**
+   * @brief Создает копию одного узла без потомков
+   */
+  tree_node *CopyNode(const tree_node *node, tree_node *parent) {
+    tree_node *copy = pool_.Create(node->key_, node->color_);
+    copy->parent_ = parent;
+    if constexpr (OrderStatistics) {
+      copy->count_ = node->count_;
+    }
+    return copy;
+  }
+
+  /**
+   * @brief Отсортирован ли диапазон по cmp_ (при unique_only - строго, без
+   * эквивалентных соседей)
+   */
+  template <typename ForwardIt>
+  bool IsSortedRange(ForwardIt first, ForwardIt last, bool unique_only) const {
+    if (first == last) return true;
+    for (ForwardIt next = std::next(first); next != last; ++first, ++next) {
+      if (unique_only ? !cmp_(*first, *next) : cmp_(*next, *first)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Заменяет содержимое дерева деревом из count отсортированных
+   * элементов, которые по порядку возвращает next()
+   */
+  template <typename Source>
+  void BuildFromSorted(Source next, size_type count) {
+    // Как и в CopyTreeFromOther(), новое дерево строится в отдельном пуле
+    node_pool build_pool;
+    pool_.Swap(build_pool);
+    tree_node *root = nullptr;
+    try {
+      root = BuildBalanced(next, count);
+    } catch (...) {
+      pool_.Swap(build_pool);
+      throw;
+    }
+    pool_.Swap(build_pool);
+    Clear();
+    pool_.Swap(build_pool);
+    if (root == nullptr) return;
+    Root() = root;
+    Root()->parent_ = head_;
+    MostLeft() = SearchMinimum(Root());
+    MostRight() = SearchMaximum(Root());
+    size_ = count;
+  }
+
+  /**
+   * @brief Строит из count отсортированных элементов идеально
+   * сбалансированное дерево, не связанное с головой
+   */
+  template <typename Source>
+  tree_node *BuildBalanced(Source &next, size_type count) {
+    // Уровни 0..red_depth-1 заполняются полностью, узлы последнего неполного
+    // уровня red_depth красятся в красный: так у всех путей одинаковая черная
+    // высота, а у красных узлов нет потомков
+    size_type red_depth = 0;
+    while ((size_type{2} << red_depth) - 1 <= count) {
+      ++red_depth;
+    }
+    return BuildSubtree(next, count, 0, red_depth);
+  }
+
+  /**
+   * @brief Рекурсивно строит идеально сбалансированное поддерево из count
+   * элементов, забирая их из next() по порядку
+   *
+   * @details Левое поддерево получает (count - 1) / 2 элементов, правое -
+   * остальные, поэтому размеры поддеревьев отличаются не больше чем на 1, и
+   * все уровни, кроме последнего, заполнены.
+   *
+   * @param depth Глубина строящегося корня поддерева
+   * @param red_depth Глубина, узлы на которой красные
+   * @return tree_node* Корень построенного поддерева
+   */
+  template <typename Source>
+  tree_node *BuildSubtree(Source &next, size_type count, size_type depth,
+                          size_type red_depth) {
+    if (count == 0) return nullptr;
+    size_type left_count = (count - 1) / 2;
+    tree_node *left = BuildSubtree(next, left_count, depth + 1, red_depth);
+    tree_node *node = nullptr;
+    try {
+      node = MakeNode(next());
+      node->color_ = depth == red_depth ? kRed : kBlack;
+      if constexpr (OrderStatistics) {
+        node->count_ = count;
+      }
+      node->left_ = left;
+      if (left != nullptr) left->parent_ = node;
+      node->right_ =
+          BuildSubtree(next, count - left_count - 1, depth + 1, red_depth);
+      if (node->right_ != nullptr) node->right_->parent_ = node;
+    } catch (...) {
+      // Destroy(node) удалит и левое поддерево, а правое при исключении
+      // удалено рекурсивным вызовом
+      if (node != nullptr) {
+        Destroy(node);
+      } else {
+        Destroy(left);
+      }
+      throw;
+    }
+    return node;
+  }
+
+  /**
+   * @brief Узел для BuildSubtree(): новый узел из значения или уже
+   * существующий узел (при сборке дерева из отцепленных узлов)
+   */
+  template <typename K>
+  tree_node *MakeNode(K &&key) {
+    return pool_.Create(std::forward<K>(key));
+  }
+
+  static tree_node *MakeNode(tree_node *node) noexcept {
+    node->ToDefault();
+    return node;
+  }
+
+  /**
+   * @brief Удаляет все узлы поддерева node и возвращает их в пул.
+   * Используется, когда пул разделен с другими деревьями и его блоки нельзя
+   * освободить целиком (см. Clear()).
+   *
+   * @param node
+   */
+  void Destroy(tree_node *node) noexcept {
+    TearDown(node, [this](tree_node *dead) { pool_.Destroy(dead); });
+  }
+
+  /**
+   * @brief Вызывает деструкторы узлов поддерева node, не освобождая память:
+   * ее потом освобождает node_pool::Reset() целиком.
+   *
+   * @param node
+   */
+  void DestroyKeys(tree_node *node) noexcept {
+    TearDown(node, [](tree_node *dead) { dead->~tree_node(); });
+  }
+
+  /**
+   * @brief Разбирает поддерево node за O(n) времени и O(1) памяти, отдавая
+   * каждый узел в release
+   *
+   * @details Обратный (post-order) обход по указателям на родителей: узел
+   * отдается в release после обоих потомков. Перед этим из него читаются
+   * только родитель и сторона, с которой мы пришли, поэтому release может
+   * сразу переиспользовать память узла. Указатель на родителя самого node не
+   * читается: у частично построенных копий он может быть не задан.
+   */
+  template <typename Release>
+  static void TearDown(tree_node *node, Release release) noexcept {
+    if (node == nullptr) return;
+    tree_node *const root = node;
+    for (;;) {
+      // Спускаемся к первому узлу обратного обхода - листу
+      for (;;) {
+        if (node->left_ != nullptr) {
+          node = node->left_;
+        } else if (node->right_ != nullptr) {
+          node = node->right_;
+        } else {
+          break;
+        }
+      }
+      // Поднимаемся, удаляя узлы, пока не найдем необойденное правое
+      // поддерево
+      for (;;) {
+        if (node == root) {
+          release(node);
+          return;
+        }
+        tree_node *parent = node->parent_;
+        bool from_left = node == parent->left_;
+        release(node);
+        if (from_left && parent->right_ != nullptr) {
+          node = parent->right_;
+          break;
+        }
+        node = parent;
+      }
+    }
+  }
+
+  /**
+   * @brief Поддерево, не связанное с головой: корень и черная высота (число
+   * черных узлов на пути от корня до NIL, включая корень)
+   */
+  struct Subtree {
+    tree_node *root_;
+    int black_height_;
+  };
+
+  /**
+   * @brief Результат Split(): элементы меньше ключа, узел с эквивалентным
+   * ключом (или nullptr) и элементы больше ключа
+   */
+  struct SplitResult {
+    Subtree left_;
+    tree_node *found_;
+    Subtree right_;
+  };
+
+  /**
+   * @brief Цепочка отцепленных поддеревьев в порядке обхода. Корни связаны
+   * через parent_, поэтому цепочке не нужна своя память.
+   */
+  struct NodeChain {
+    void Append(tree_node *root) noexcept {
+      root->parent_ = nullptr;
+      if (first_ == nullptr) {
+        first_ = root;
+      } else {
+        last_->parent_ = root;
+      }
+      last_ = root;
+      ++size_;
+    }
+
+    void Append(const NodeChain &other) noexcept {
+      if (other.first_ == nullptr) return;
+      if (first_ == nullptr) {
+        first_ = other.first_;
+      } else {
+        last_->parent_ = other.first_;
+      }
+      last_ = other.last_;
+      size_ += other.size_;
+    }
+
+    tree_node *first_ = nullptr;
+    tree_node *last_ = nullptr;
+    // Количество поддеревьев в цепочке
+    size_type size_ = 0;
+  };
+
+  /**
+   * @brief Выполняет обе половины рекурсии по очереди
+   */
+  struct SequentialFork {
+    template <typename First, typename Second>
+    void operator()(int, First &&first, Second &&second) const {
+      first();
+      second();
+    }
+  };
+
+  /**
+   * @brief Выполняет первую половину рекурсии задачей планировщика, а вторую
+   * - в текущем потоке. Половины работают с непересекающимися узлами и не
+   * трогают пул, поэтому синхронизация не нужна.
+   */
+  template <typename Scheduler>
+  struct ParallelFork {
+    template <typename First, typename Second>
+    void operator()(int black_height, First &&first, Second &&second) const {
+      // Мелкие поддеревья дешевле обработать, чем создать для них задачу
+      if (black_height < kParallelBlackHeight) {
+        first();
+        second();
+        return;
+      }
+      typename Scheduler::task_group group(scheduler_);
+      group.run(first);
+      second();
+      group.wait();
+    }
+
+    Scheduler &scheduler_;
+  };
+
+  // Черная высота, начиная с которой ParallelFork запускает задачи: в
+  // поддереве с такой высотой не меньше 2^10 - 1 узлов
+  static constexpr int kParallelBlackHeight = 10;
+  // Если other меньше дерева хотя бы во столько раз, merge вставляет его
+  // узлы по одному: для случайных ключей при m << n это быстрее, чем резать
+  // большое дерево (см. benchmarks/bench_set_algebra.cc)
+  static constexpr size_type kInsertMergeRatio = 8U;
+
+  /**
+   * @brief Общая часть Merge() и MergeUnique(): объединяет деревья через
+   * Union() или InsertNodesOf(), а дубликаты (при unique_only) возвращает в
+   * other
+   */
+  template <typename Fork>
+  void MergeTrees(tree_type &other, bool unique_only, const Fork &fork) {
+    if (this == &other || other.size_ == 0) return;
+    // Узлы остаются в блоках пула other, поэтому наш пул тоже ссылается на
+    // эти блоки
+    pool_.Adopt(other.pool_);
+    NodeChain duplicates;
+    if (other.size_ * kInsertMergeRatio <= size_) {
+      InsertNodesOf(other, unique_only, duplicates);
+    } else {
+      size_type total = size_ + other.size_;
+      Subtree other_tree = other.DetachRoot();
+      Subtree result =
+          Union(DetachRoot(), other_tree, unique_only, duplicates, fork);
+      AttachRoot(result.root_, total - duplicates.size_);
+    }
+    // Дубликаты уже в порядке обхода, остается связать их в дерево
+    tree_node *next_duplicate = duplicates.first_;
+    auto next = [&next_duplicate]() noexcept {
+      tree_node *node = next_duplicate;
+      next_duplicate = node->parent_;
+      return node;
+    };
+    other.AttachRoot(other.BuildBalanced(next, duplicates.size_),
+                     duplicates.size_);
+  }
+
+  /**
+   * @brief Переносит узлы other в дерево по одному, вставкой от корня.
+   * Узлы, для которых при unique_only нашелся эквивалентный, попадают в
+   * duplicates.
+   *
+   * @details Узлы other обходятся по порядку, поэтому левое поддерево
+   * текущего узла уже пусто, и узел отцепляется без балансировки other:
+   * его правое поддерево подвешивается к родителю. Обход продолжается по
+   * указателям на родителей, которые ведут только к еще не перенесенным
+   * узлам.
+   */
+  void InsertNodesOf(tree_type &other, bool unique_only,
+                     NodeChain &duplicates) {
+    iterator other_begin = other.Begin();
+    while (other.size_ > 0) {
+      tree_node *moving_node = other_begin.node_;
+      ++other_begin;
+      if (moving_node->right_ != nullptr) {
+        moving_node->right_->parent_ = moving_node->parent_;
+      }
+      if (moving_node->parent_->left_ == moving_node) {
+        moving_node->parent_->left_ = nullptr;
+      }
+      if (moving_node->parent_->right_ == moving_node) {
+        moving_node->parent_->right_ = nullptr;
+      }
+      moving_node->ToDefault();
+      --other.size_;
+      if (!Insert(Root(), moving_node, unique_only).second) {
+        duplicates.Append(moving_node);
+      }
+    }
+    other.InitializeHead();
+  }
+
+  template <typename Fork>
+  void IntersectTrees(const tree_type &other, const Fork &fork) {
+    if (this == &other) return;
+    size_type size = size_;
+    NodeChain dropped;
+    Subtree result = Intersect(DetachRoot(), other.Root(),
+                               BlackHeight(other.Root()), dropped, fork);
+    AttachRoot(result.root_, size - DestroyChain(dropped));
+  }
+
+  template <typename Fork>
+  void SubtractTrees(const tree_type &other, const Fork &fork) {
+    if (this == &other) {
+      Clear();
+      return;
+    }
+    size_type size = size_;
+    NodeChain dropped;
+    Subtree result = Subtract(DetachRoot(), other.Root(),
+                              BlackHeight(other.Root()), dropped, fork);
+    AttachRoot(result.root_, size - DestroyChain(dropped));
+  }
+
+  /**
+   * @brief Объединяет поддеревья tree и other (алгоритм Блеллоха и др.,
+   * "Just Join for Parallel Ordered Sets").
+   *
+   * @details Корень other делит tree на две части (Split()), части
+   * рекурсивно объединяются с левым и правым поддеревьями other, а
+   * результаты соединяются через корень other (Join()). Половины рекурсии
+   * независимы, поэтому fork может выполнить их параллельно. Для деревьев из
+   * n и m элементов это стоит O(m log(n/m + 1)): маленькое дерево почти не
+   * режет большое.
+   *
+   * При unique_only элемент other, эквивалентный элементу tree, не входит в
+   * результат и попадает в duplicates. Иначе Split() отдает влево элементы
+   * tree, не большие ключа, поэтому эквивалентные элементы other встают
+   * после эквивалентных элементов tree.
+   */
+  template <typename Fork>
+  Subtree Union(Subtree tree, Subtree other, bool unique_only,
+                NodeChain &duplicates, const Fork &fork) {
+    if (other.root_ == nullptr) return tree;
+    if (tree.root_ == nullptr) return other;
+    tree_node *node = other.root_;
+    int child_height = ChildBlackHeight(other);
+    Subtree other_left{node->left_, child_height};
+    Subtree other_right{node->right_, child_height};
+    SplitResult parts = Split(tree, node->key_, unique_only);
+    Subtree left{nullptr, 0};
+    Subtree right{nullptr, 0};
+    NodeChain right_duplicates;
+    fork(
+        std::min(tree.black_height_, other.black_height_),
+        [&] {
+          left = Union(parts.left_, other_left, unique_only, duplicates, fork);
+        },
+        [&] {
+          right = Union(parts.right_, other_right, unique_only,
+                        right_duplicates, fork);
+        });
+    Subtree result{nullptr, 0};
+    if (parts.found_ != nullptr) {
+      result = Join(left, parts.found_, right);
+      duplicates.Append(node);
+    } else {
+      result = Join(left, node, right);
+    }
+    duplicates.Append(right_duplicates);
+    return result;
+  }
+
+  /**
+   * @brief Оставляет в tree элементы, эквивалентные элементам поддерева
+   * other (other не меняется). Выброшенные поддеревья tree попадают в
+   * dropped. Устроено так же, как Union().
+   */
+  template <typename Fork>
+  Subtree Intersect(Subtree tree, const tree_node *other, int other_height,
+                    NodeChain &dropped, const Fork &fork) {
+    if (tree.root_ == nullptr) return tree;
+    if (other == nullptr) {
+      dropped.Append(tree.root_);
+      return Subtree{nullptr, 0};
+    }
+    int child_height = other_height - (other->color_ == kBlack ? 1 : 0);
+    SplitResult parts = Split(tree, other->key_, true);
+    Subtree left{nullptr, 0};
+    Subtree right{nullptr, 0};
+    NodeChain right_dropped;
+    fork(
+        std::min(tree.black_height_, other_height),
+        [&] {
+          left = Intersect(parts.left_, other->left_, child_height, dropped,
+                           fork);
+        },
+        [&] {
+          right = Intersect(parts.right_, other->right_, child_height,
+                            right_dropped, fork);
+        });
+    dropped.Append(right_dropped);
+    if (parts.found_ != nullptr) {
+      return Join(left, parts.found_, right);
+    }
+    return Join(left, right);
+  }
+
+  /**
+   * @brief Удаляет из tree элементы, эквивалентные элементам поддерева other
+   * (other не меняется). Удаленные узлы попадают в dropped. Устроено так же,
+   * как Union().
+   */
+  template <typename Fork>
+  Subtree Subtract(Subtree tree, const tree_node *other, int other_height,
+                   NodeChain &dropped, const Fork &fork) {
+    if (tree.root_ == nullptr || other == nullptr) return tree;
+    int child_height = other_height - (other->color_ == kBlack ? 1 : 0);
+    SplitResult parts = Split(tree, other->key_, true);
+    if (parts.found_ != nullptr) {
+      // Потомки найденного узла уже разнесены по частям split
+      parts.found_->left_ = nullptr;
+      parts.found_->right_ = nullptr;
+      dropped.Append(parts.found_);
+    }
+    Subtree left{nullptr, 0};
+    Subtree right{nullptr, 0};
+    NodeChain right_dropped;
+    fork(
+        std::min(tree.black_height_, other_height),
+        [&] {
+          left = Subtract(parts.left_, other->left_, child_height, dropped,
+                          fork);
+        },
+        [&] {
+          right = Subtract(parts.right_, other->right_, child_height,
+                           right_dropped, fork);
+        });
+    dropped.Append(right_dropped);
+    return Join(left, right);
+  }
+
+  /**
+   * @brief Делит tree по key на элементы меньше key и больше key. Узел с
+   * эквивалентным ключом возвращается отдельно. Если unique_only равен
+   * false, такие узлы не ищутся, а уходят в левую часть.
+   *
+   * @details Спуск от корня к key: каждый пройденный узел вместе со своим
+   * поддеревьем с другой стороны от пути присоединяется (Join()) к
+   * соответствующей части. Стоимость соединений телескопически
+   * складывается в O(log n).
+   */
+  SplitResult Split(Subtree tree, const key_type &key, bool unique_only) {
+    tree_node *node = tree.root_;
+    if (node == nullptr) return SplitResult{tree, nullptr, tree};
+    int child_height = ChildBlackHeight(tree);
+    Subtree left{node->left_, child_height};
+    Subtree right{node->right_, child_height};
+    if (cmp_(key, node->key_)) {
+      SplitResult result = Split(left, key, unique_only);
+      result.right_ = Join(result.right_, node, right);
+      return result;
+    }
+    if (!unique_only || cmp_(node->key_, key)) {
+      SplitResult result = Split(right, key, unique_only);
+      result.left_ = Join(left, node, result.left_);
+      return result;
+    }
+    return SplitResult{left, node, right};
+  }
+
+  // Верхняя граница высоты красно-черного дерева: 2 * log2(n + 1)
+  static constexpr int kMaxHeight = 2 * std::numeric_limits<size_type>::digits;
+
+  /**
+   * @brief Делит tree на элементы до узла target, сам target (found_) и
+   * элементы после него
    *
-   * @param key ключевое значение, с которым сравниваются элементы
-   * @return iterator Итератор, указывающий на первый элемент, который больше
-   * key. Если такой элемент не найден, возвращается итератор End().
+   * @details Как Split(), но путь спуска задается не ключом, а положением
+   * target: он заранее записывается подъемом по parent_ от target до корня
+   * tree. Поэтому разрез проходит ровно перед target и внутри серии
+   * эквивалентных ключей multiset.
    */
-  iterator UpperBound(const_reference key) {
-    tree_node *start = Root();
-    tree_node *result = End().node_;
+  static SplitResult SplitBefore(Subtree tree,
+                                 const tree_node *target) noexcept {
+    // go_right[d] - направление спуска на глубине depth - 1 - d
+    bool go_right[kMaxHeight];
+    int depth = 0;
+    for (const tree_node *node = target; node != tree.root_;
+         node = node->parent_) {
+      go_right[depth++] = node == node->parent_->right_;
+    }
+    return SplitAlong(tree, go_right, depth);
+  }
 
-    while (start != nullptr) {
-      if (cmp_(key, start->key_)) {
-        // Если искомое значение меньше значения узла, то запоминаем
-        // текущий узел, т.к. он больше искомого
-        result = start;
-        // Продолжаем поиски в левой ветви, т.к. там могут быть значения
-        // меньше текущего узла, а нам надо найти самый маленький (т.е.
-        // ближайший к key) узел
-        start = start->left_;
-      } else
-        // В противном случае ищем узлы в правой ветви
-        start = start->right_;
+  static SplitResult SplitAlong(Subtree tree, const bool *go_right,
+                                int depth) noexcept {
+    tree_node *node = tree.root_;
+    int child_height = ChildBlackHeight(tree);
+    Subtree left{node->left_, child_height};
+    Subtree right{node->right_, child_height};
+    if (depth == 0) return SplitResult{left, node, right};
+    if (go_right[depth - 1]) {
+      SplitResult result = SplitAlong(right, go_right, depth - 1);
+      result.left_ = Join(left, node, result.left_);
+      return result;
     }
+    SplitResult result = SplitAlong(left, go_right, depth - 1);
+    result.right_ = Join(result.right_, node, right);
+    return result;
+  }
 
-    return iterator(result);
+  /**
+   * @brief Посещает ключи поддерева node из [lo, hi). after_lo и before_hi
+   * означают, что все ключи поддерева уже известны как не меньшие lo и
+   * меньшие hi соответственно, и сравнивать их не нужно.
+   */
+  template <typename K, typename Visitor>
+  void VisitRange(tree_node *node, const K &lo, const K &hi, Visitor &visit,
+                  bool after_lo, bool before_hi) {
+    // Рекурсия только влево, вправо - цикл
+    while (node != nullptr) {
+      bool node_after_lo = after_lo || !cmp_(node->key_, lo);
+      bool node_before_hi = before_hi || cmp_(node->key_, hi);
+      if (node_after_lo) {
+        VisitRange(node->left_, lo, hi, visit, after_lo, node_before_hi);
+        if (node_before_hi) visit(node->key_);
+      }
+      if (!node_before_hi) return;
+      after_lo = node_after_lo;
+      node = node->right_;
+    }
   }
 
   /**
-   * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
-   * элементы становятся недействительными. Другие ссылки и итераторы не
-   * затрагиваются.
-   *
-   * @param pos
+   * @brief Соединяет left, middle и right в одно дерево. Все элементы left
+   * должны быть не больше middle, а элементы right - не меньше.
+   *
+   * @details Спускаемся по правому краю более высокого left (или левому
+   * краю right) до черного узла той же черной высоты, что и у другого
+   * дерева, и ставим на его место красный middle с этим узлом и другим
+   * деревом в потомках. Возможное нарушение "красный под красным"
+   * исправляется одним поворотом на подъеме. Стоит O(|bh(left) -
+   * bh(right)| + 1).
    */
-  void Erase(iterator pos) noexcept {
-    tree_node *result = ExtractNode(pos);
-    delete result;
+  static Subtree Join(Subtree left, tree_node *middle,
+                      Subtree right) noexcept {
+    // С черными корнями красный middle не окажется под красным корнем
+    left = Blacken(left);
+    right = Blacken(right);
+    if (left.black_height_ > right.black_height_) {
+      return Subtree{JoinRight(left.root_, left.black_height_, middle, right),
+                     left.black_height_};
+    }
+    if (left.black_height_ < right.black_height_) {
+      return Subtree{JoinLeft(right.root_, right.black_height_, middle, left),
+                     right.black_height_};
+    }
+    middle->color_ = kRed;
+    return Subtree{Link(middle, left.root_, right.root_), left.black_height_};
   }
 
   /**
-   * @brief Обменяет содержимое контейнера на содержимое other
-   * @details Не вызывает никаких операций перемещения, копирования или замены
-   * отдельных элементов. Все итераторы и ссылки остаются действительными.
-   * Итератор End() становится недействительным.
-   *
-   * Проверка на самосвап бессмысленна, т.к. дерево это переживает, а лишняя
-   * проверка будет всегда вызываться, а реально будет редко нужна.
-   *
-   * @param other
+   * @brief Соединяет left и right без среднего узла: средним становится
+   * максимум left
    */
-  void Swap(tree_type &other) noexcept {
-    std::swap(head_, other.head_);
-    std::swap(size_, other.size_);
-    std::swap(cmp_, other.cmp_);
+  static Subtree Join(Subtree left, Subtree right) noexcept {
+    if (left.root_ == nullptr) return right;
+    if (right.root_ == nullptr) return left;
+    tree_node *last = nullptr;
+    Subtree rest = SplitLast(left, last);
+    return Join(rest, last, right);
   }
 
   /**
-   * @brief Метод для тестирования красно-черного дерева на корректность.
-   * @details Проверяет все правила, которые должны соблюдаться для дерева
-   * (см. описание в начале файла). Пояснения написаны по ходу метода.
-   *
-   * @return true Дерево корректно
-   * @return false Дерево некорректно
+   * @brief Отделяет от tree максимальный узел last
    */
-  bool CheckTree() const noexcept {
-    // head дерева должен быть красный.
-    if (head_->color_ == kBlack) {
-      return false;
+  static Subtree SplitLast(Subtree tree, tree_node *&last) noexcept {
+    tree_node *node = tree.root_;
+    Subtree left{node->left_, ChildBlackHeight(tree)};
+    if (node->right_ == nullptr) {
+      last = node;
+      return left;
     }
+    Subtree rest = SplitLast(Subtree{node->right_, left.black_height_}, last);
+    return Join(left, node, rest);
+  }
 
-    // Пустое дерево корректно всегда
-    if (Root() == nullptr) {
-      return true;
+  /**
+   * @brief Правая половина Join(): node - поддерево left черной высоты
+   * height, которое выше right
+   */
+  static tree_node *JoinRight(tree_node *node, int height, tree_node *middle,
+                              Subtree right) noexcept {
+    if (height == right.black_height_ &&
+        (node == nullptr || node->color_ == kBlack)) {
+      middle->color_ = kRed;
+      return Link(middle, node, right.root_);
     }
-
-    // Корень дерева должен быть чёрный.
-    if (Root()->color_ == kRed) {
-      return false;
+    int child_height = height - (node->color_ == kBlack ? 1 : 0);
+    tree_node *child = JoinRight(node->right_, child_height, middle, right);
+    Link(node, node->left_, child);
+    if (node->color_ == kBlack && child->color_ == kRed &&
+        child->right_ != nullptr && child->right_->color_ == kRed) {
+      // Красный под красным: поворот поднимает красный child, а node и
+      // перекрашенный внук становятся его черными потомками
+      child->right_->color_ = kBlack;
+      return RotateLeftDetached(node);
     }
+    return node;
+  }
 
-    // Оба потомка каждого красного узла — чёрные.
-    if (checkRedNodes(Root()) == false) {
-      return false;
+  /**
+   * @brief Левая половина Join(), зеркальная JoinRight()
+   */
+  static tree_node *JoinLeft(tree_node *node, int height, tree_node *middle,
+                             Subtree left) noexcept {
+    if (height == left.black_height_ &&
+        (node == nullptr || node->color_ == kBlack)) {
+      middle->color_ = kRed;
+      return Link(middle, left.root_, node);
     }
+    int child_height = height - (node->color_ == kBlack ? 1 : 0);
+    tree_node *child = JoinLeft(node->left_, child_height, middle, left);
+    Link(node, child, node->right_);
+    if (node->color_ == kBlack && child->color_ == kRed &&
+        child->left_ != nullptr && child->left_->color_ == kRed) {
+      child->left_->color_ = kBlack;
+      return RotateRightDetached(node);
+    }
+    return node;
+  }
 
-    // Любой простой путь от узла-предка до листового узла-потомка содержит
-    // одинаковое число чёрных узлов.
-    if (ComputeBlackHeight(Root()) == -1) {
-      return false;
+  /**
+   * @brief Делает left и right потомками node и пересчитывает его размер.
+   * Родителя node выставляет тот, кто подвешивает node.
+   */
+  static tree_node *Link(tree_node *node, tree_node *left,
+                         tree_node *right) noexcept {
+    node->left_ = left;
+    node->right_ = right;
+    if (left != nullptr) left->parent_ = node;
+    if (right != nullptr) right->parent_ = node;
+    if constexpr (OrderStatistics) {
+      node->count_ = SubtreeCount(left) + SubtreeCount(right) + 1;
     }
+    return node;
+  }
 
-    // Если всё ок, то возвращаем true
-    return true;
+  /**
+   * @brief Повороты поддерева, не связанного с головой (в отличие от
+   * RotateLeft() и RotateRight()). Возвращают новый корень поддерева.
+   */
+  static tree_node *RotateLeftDetached(tree_node *node) noexcept {
+    tree_node *pivot = node->right_;
+    Link(node, node->left_, pivot->left_);
+    return Link(pivot, node, pivot->right_);
+  }
+
+  static tree_node *RotateRightDetached(tree_node *node) noexcept {
+    tree_node *pivot = node->left_;
+    Link(node, pivot->right_, node->right_);
+    return Link(pivot, pivot->left_, node);
   }
 
- private:
   /**
-   * @brief Приватный метод для копирования дерева other в this.
-   *
-   * @todo В части кейсов копирование осуществляется медленнее, чем в std.
-   * Связано это с тем, что наша версия Clear() медленнее оригинала, само
-   * копирование сопоставимо по скорости.
-   * @param other Копируемое дерево
+   * @brief Перекрашивает красный корень в черный (черная высота растет на 1)
    */
-  void CopyTreeFromOther(const tree_type &other) {
-    tree_node *other_copy_root = CopyTree(other.Root(), nullptr);
-    // Важно, что мы сначала создаем полную копию, а только потом вызываем
-    // очистку текущего дерева. Это необходимо для того, чтобы текущее
-    // дерево не было уничтожено, если при копировании вылетит исключение
-    // (см. тесты "CopyLeaks").
-    Clear();
-    Root() = other_copy_root;
-    Root()->parent_ = head_;
-    MostLeft() = SearchMinimum(Root());
-    MostRight() = SearchMaximum(Root());
-    size_ = other.size_;
-    cmp_ = other.cmp_;
+  static Subtree Blacken(Subtree tree) noexcept {
+    if (tree.root_ != nullptr && tree.root_->color_ == kRed) {
+      tree.root_->color_ = kBlack;
+      ++tree.black_height_;
+    }
+    return tree;
   }
 
   /**
-   * @brief Приватный метод для рекурсивного создания копий узлов и связей
-   * между ними
-   *
-   * @param node копируемый узел.
-   * @param parent копия родителя копируемого узла.
-   * @return tree_node* указатель на созданную копию узла.
+   * @brief Черная высота потомков корня tree
    */
-  [[nodiscard]] tree_node *CopyTree(const tree_node *node, tree_node *parent) {
-    // Если вылетит исключение при создании самого первого узла, то ничего
-    // страшного, ничего создано не будет
-    tree_node *copy = new tree_node{node->key_, node->color_};
-    // А вот все рекурсивные вызовы оборачиваем в try/catch, чтобы в случае
-    // возникновения исключения удалить все уже скопированные узлы (иначе
-    // будет утечка)
-    try {
-      if (node->left_) {
-        copy->left_ = CopyTree(node->left_, copy);
-      }
+  static int ChildBlackHeight(const Subtree &tree) noexcept {
+    return tree.black_height_ - (tree.root_->color_ == kBlack ? 1 : 0);
+  }
 
-      if (node->right_) {
-        copy->right_ = CopyTree(node->right_, copy);
-      }
-    } catch (...) {
-      Destroy(copy);
-      throw;
+  /**
+   * @brief Черная высота поддерева node, посчитанная по левому краю за
+   * O(log n). В отличие от ComputeBlackHeight() не проверяет остальные пути.
+   */
+  static int BlackHeight(const tree_node *node) noexcept {
+    int height = 0;
+    for (; node != nullptr; node = node->left_) {
+      if (node->color_ == kBlack) ++height;
     }
+    return height;
+  }
 
-    copy->parent_ = parent;
-    return copy;
+  /**
+   * @brief Отцепляет все узлы от головы, оставляя дерево пустым
+   */
+  Subtree DetachRoot() noexcept {
+    Subtree tree{Root(), BlackHeight(Root())};
+    InitializeHead();
+    size_ = 0;
+    return tree;
   }
 
   /**
-   * @brief Рекурсивно удаляет все узлы дерева и освобождает память, кроме
-   * служебного узла head.
-   *
-   * @todo map - 199054 элементов: std: 38.626 ms; s21: 65.842 ms;
-   * Отказаться от двойной рекурсии? Или это из-за неудачного механизма
-   * компаратора? set/multiset показывают лучшие результаты, чем map
-   * @param node
+   * @brief Подвешивает к голове пустого дерева поддерево root из size узлов
    */
-  void Destroy(tree_node *node) noexcept {
-    if (node == nullptr) return;
-    Destroy(node->left_);
-    Destroy(node->right_);
-    delete node;
+  void AttachRoot(tree_node *root, size_type size) noexcept {
+    size_ = size;
+    if (root == nullptr) return;
+    root->color_ = kBlack;
+    root->parent_ = head_;
+    Root() = root;
+    MostLeft() = SearchMinimum(root);
+    MostRight() = SearchMaximum(root);
+  }
+
+  /**
+   * @brief Удаляет все поддеревья цепочки и возвращает число удаленных узлов
+   */
+  size_type DestroyChain(const NodeChain &chain) noexcept {
+    size_type count = 0;
+    for (tree_node *root = chain.first_; root != nullptr;) {
+      tree_node *next = root->parent_;
+      TearDown(root, [this, &count](tree_node *dead) {
+        pool_.Destroy(dead);
+        ++count;
+      });
+      root = next;
+    }
+    return count;
   }
 
   /**
@@ -774,9 +2012,6 @@ class RedBlackTree {
    * если контейнер ещё не содержит элемент с эквивалентным ключом. false -
    * вставка любого узла, в т.ч., если контейнер уже содержит элемент с
    * эквивалентным ключом.
-   * @todo Insert можно ускорить, если сделать разные версии для обычной
-   * вставки и unique, так сейсчас при обычной вставке мы делаем лишние
-   * проверки, которые можно и не делать
    * @todo подозрительно быстро (особенно с оптимизацией) делается вставка
    * 200000 одинаковых элементов в set
    * @return std::pair<iterator, bool> - Пара, состоящая из итератора для
@@ -786,48 +2021,106 @@ class RedBlackTree {
    */
   std::pair<iterator, bool> Insert(tree_node *root, tree_node *new_node,
                                    bool unique_only) {
+    bool found = false;
+    tree_node *parent =
+        SearchInsertParent(root, new_node->key_, unique_only, found);
+    if (found) {
+      // Если node == new_node то возвращаем результат о невозможности
+      // вставки элемента
+      return {iterator(parent), false};
+    }
+    return {LinkNode(parent, new_node), true};
+  }
+
+  /**
+   * @brief Ищет от корня место для вставки key, см. версию с root
+   */
+  template <typename K>
+  tree_node *SearchInsertParent(const K &key, bool unique_only, bool &found) {
+    return SearchInsertParent(Root(), key, unique_only, found);
+  }
+
+  /**
+   * @brief Ищет ниже узла root место для вставки значения key. Узел при этом
+   * не нужен, поэтому неудачную вставку можно обнаружить до выделения памяти.
+   *
+   * @tparam K Тип искомого ключа: key_type или тип, который cmp_ умеет
+   * сравнивать с key_type (например, ключ словаря без значения)
+   * @param unique_only Режим вставки (см. Insert())
+   * @param found Выставляется в true, если unique_only и найден элемент с
+   * эквивалентным ключом
+   * @return tree_node* Будущий родитель нового узла (nullptr для пустого
+   * дерева) или, если found, узел с эквивалентным ключом
+   */
+  template <typename K>
+  tree_node *SearchInsertParent(tree_node *root, const K &key,
+                                bool unique_only, bool &found) {
+    found = false;
+    // Ключи часто вставляются по возрастанию: если key не меньше самого
+    // большого элемента (при unique_only - строго больше), то новый узел
+    // становится его правым потомком без спуска от корня
+    if (root == Root() && size_ > 0 &&
+        (unique_only ? cmp_(MostRight()->key_, key)
+                     : !cmp_(key, MostRight()->key_))) {
+      return MostRight();
+    }
+
     tree_node *node = root;
     tree_node *parent = nullptr;
+    // Последний узел, для которого !(key < node), т.е. node <= key
+    tree_node *not_greater = nullptr;
 
-    // Ищем место для вставки, пока не дойдем до пустого узла
+    // Ищем место для вставки, пока не дойдем до пустого узла. На каждом
+    // уровне одно сравнение: равные ключи уходят в правую ветвь
     while (node != nullptr) {
       parent = node;
-      if (cmp_(new_node->key_, node->key_)) {
-        // Если new_node < node
+      if (cmp_(key, node->key_)) {
+        // Если key < node
         node = node->left_;
       } else {
-        // Иначе (т.е. node >= new_node)
-        if (unique_only == false) {
-          // Если вставка неуникальных элементов разрешена, то всегда
-          // продолжаем искать дальше в правой ветви (т.к. нам не
-          // важно, равно ли значение текущего узла вставляемому)
-          node = node->right_;
-        } else {
-          // Если вставка неуникальных элементов не разрешена, то
-          // выясняем node > new_node или node == new_node
-          if (cmp_(node->key_, new_node->key_)) {
-            // Если node > new_node, то продолжаем поиски в правой
-            // ветви
-            node = node->right_;
-          } else {
-            // Если node == new_node то возвращаем результат о
-            // невозможности вставки элемента
-            return {iterator(node), false};
-          }
-        }
+        // Иначе (т.е. node <= key)
+        not_greater = node;
+        node = node->right_;
       }
     }
 
-    // После окончания цикла parent буден указывать на узел, потомком
-    // которого станет new_node. При этом parent может быть равен nullptr,
-    // если в дереве не окажется узлов (пустое дерево), если мы даже не
-    // зашли в цикл выше
+    // Если вставка неуникальных элементов не разрешена, то эквивалентный
+    // ключ может быть только у самого правого узла, не большего key
+    if (unique_only && not_greater != nullptr &&
+        !cmp_(not_greater->key_, key)) {
+      found = true;
+      return not_greater;
+    }
+
+    return parent;
+  }
+
+  /**
+   * @brief Встраивает new_node потомком parent, найденного
+   * SearchInsertParent(), и балансирует дерево
+   *
+   * @param parent Родитель нового узла, nullptr для пустого дерева
+   * @param new_node Встраиваемый узел
+   * @return iterator Итератор на вставленный узел
+   */
+  iterator LinkNode(tree_node *parent, tree_node *new_node) {
+    return LinkNode(parent, new_node,
+                    parent != nullptr && cmp_(new_node->key_, parent->key_));
+  }
+
+  /**
+   * @brief Встраивает new_node левым (as_left) или правым потомком parent и
+   * балансирует дерево. Соответствующий потомок parent должен быть пустым.
+   */
+  iterator LinkNode(tree_node *parent, tree_node *new_node, bool as_left) {
+    // parent может быть равен nullptr, если в дереве не окажется узлов
+    // (пустое дерево)
 
     if (parent != nullptr) {
       // Если дерево не пустое
       // То родителем нового узла указываем найденный parent
       new_node->parent_ = parent;
-      if (cmp_(new_node->key_, parent->key_)) {
+      if (as_left) {
         parent->left_ = new_node;
       } else {
         parent->right_ = new_node;
@@ -840,6 +2133,12 @@ class RedBlackTree {
     }
 
     ++size_;
+    if constexpr (OrderStatistics) {
+      for (tree_node *node = parent; node != nullptr && node != head_;
+           node = node->parent_) {
+        ++node->count_;
+      }
+    }
 
     // Обновляем указатель на самый маленький элемент дерева, если
     // необходимо
@@ -855,7 +2154,75 @@ class RedBlackTree {
     // Вызываем балансировку после вставки нового узла
     BalancingInsert(new_node);
 
-    return {iterator(new_node), true};
+    return iterator(new_node);
+  }
+
+  /**
+   * @brief Ищет место для вставки key рядом с hint: непосредственно перед
+   * hint или сразу после него. Если key туда не подходит, выполняется
+   * обычный поиск от корня (SearchInsertParent()).
+   *
+   * @details Проверка соседей hint стоит O(1) в среднем (переход к соседнему
+   * узлу амортизированно константный), поэтому вставка с верной подсказкой
+   * обходится без спуска от корня. Подходят оба распространенных шаблона:
+   * hint - следующий за новым элемент (как в стандарте) и hint - результат
+   * предыдущей вставки при вставке по возрастанию.
+   *
+   * @param unique_only Режим вставки (см. Insert())
+   * @param found Выставляется в true, если unique_only и найден элемент с
+   * эквивалентным ключом
+   * @param as_left Сторона, с которой новый узел встраивается к родителю
+   * @return tree_node* Родитель нового узла (nullptr для пустого дерева)
+   * или, если found, узел с эквивалентным ключом
+   */
+  tree_node *SearchHintParent(const_iterator hint, const key_type &key,
+                              bool unique_only, bool &found, bool &as_left) {
+    found = false;
+    as_left = false;
+    if (size_ == 0) return nullptr;
+
+    tree_node *pos = const_cast<tree_node *>(hint.node_);
+    // Можно ли поставить key сразу после left и сразу перед right
+    // (nullptr - край дерева)
+    auto fits = [this, unique_only, &key](const tree_node *left,
+                                          const tree_node *right) {
+      bool after_left = left == nullptr || (unique_only
+                                                ? cmp_(left->key_, key)
+                                                : !cmp_(key, left->key_));
+      bool before_right = right == nullptr || (unique_only
+                                                   ? cmp_(key, right->key_)
+                                                   : !cmp_(right->key_, key));
+      return after_left && before_right;
+    };
+
+    // Перед hint
+    tree_node *before = pos == MostLeft() ? nullptr : pos->PrevNode();
+    if (fits(before, pos == head_ ? nullptr : pos)) {
+      if (pos != head_ && pos->left_ == nullptr) {
+        as_left = true;
+        return pos;
+      }
+      // У before нет правого потомка: это либо самый правый узел дерева,
+      // либо самый правый узел левого поддерева pos
+      return before;
+    }
+
+    // После hint
+    if (pos != head_) {
+      tree_node *after = pos == MostRight() ? nullptr : pos->NextNode();
+      if (fits(pos, after)) {
+        if (pos->right_ == nullptr) {
+          return pos;
+        }
+        // after - самый левый узел правого поддерева pos
+        as_left = true;
+        return after;
+      }
+    }
+
+    tree_node *parent = SearchInsertParent(key, unique_only, found);
+    as_left = !found && cmp_(key, parent->key_);
+    return parent;
   }
 
   /**
@@ -1006,6 +2373,7 @@ class RedBlackTree {
 
     node->parent_ = pivot;
     pivot->right_ = node;
+    UpdateCountsAfterRotate(node, pivot);
   }
 
   /**
@@ -1034,6 +2402,29 @@ class RedBlackTree {
 
     node->parent_ = pivot;
     pivot->left_ = node;
+    UpdateCountsAfterRotate(node, pivot);
+  }
+
+  /**
+   * @brief Пересчитывает размеры поддеревьев после поворота: pivot занял
+   * место node, поэтому его поддерево совпадает со старым поддеревом node, а
+   * размер node складывается из его новых потомков
+   */
+  void UpdateCountsAfterRotate(tree_node *node, tree_node *pivot) noexcept {
+    if constexpr (OrderStatistics) {
+      pivot->count_ = node->count_;
+      node->count_ = SubtreeCount(node->left_) + SubtreeCount(node->right_) + 1;
+    } else {
+      (void)node;
+      (void)pivot;
+    }
+  }
+
+  /**
+   * @brief Размер поддерева node (0 для nullptr). Только для OrderStatistics.
+   */
+  static size_type SubtreeCount(const tree_node *node) noexcept {
+    return node == nullptr ? 0 : node->count_;
   }
 
   /**
@@ -1156,6 +2547,17 @@ class RedBlackTree {
     // функции. При таком случае все необходимые переменные для удаления уже
     // заполнены корректно
 
+    if constexpr (OrderStatistics) {
+      // Узел уже лист и останется на месте до конца балансировки. Считаем
+      // его пустым, а его предков - уменьшившимися на 1: тогда повороты в
+      // EraseBalancing() пересчитывают размеры уже без него
+      deleted_node->count_ = 0;
+      for (tree_node *node = deleted_node->parent_; node != head_;
+           node = node->parent_) {
+        --node->count_;
+      }
+    }
+
     // Обработка Ч0
     // Самый сложный и интересный случай, нам необходимо перед удалением
     // перебаласировать дерево таким образом, чтобы черная высота не
@@ -1246,6 +2648,10 @@ class RedBlackTree {
     std::swap(node->left_, other->left_);
     std::swap(node->right_, other->right_);
     std::swap(node->color_, other->color_);
+    if constexpr (OrderStatistics) {
+      // Размер поддерева принадлежит позиции в дереве, а не значению
+      std::swap(node->count_, other->count_);
+    }
 
     // Меняем родителей у потомков свапаемых узлов
 
@@ -1523,7 +2929,14 @@ class RedBlackTree {
    * @brief Класс, реализующий узел красно-чёрного дерева
    *
    */
-  struct RedBlackTreeNode {
+  // Размер поддерева узла, хранится только при OrderStatistics
+  struct SubtreeSize {
+    size_type count_ = 1;
+  };
+  struct NoSubtreeSize {};
+
+  struct RedBlackTreeNode
+      : std::conditional_t<OrderStatistics, SubtreeSize, NoSubtreeSize> {
     /**
      * @brief Конструктор по умолчанию для создания пустого узла дерева, с
      * дефолтной инициализацией значения узла
@@ -1565,6 +2978,18 @@ class RedBlackTree {
           key_(std::move(key)),
           color_(kRed) {}
 
+    /**
+     * @brief Конструктор, создающий значение узла прямо из args (для
+     * emplace-методов)
+     */
+    template <typename... Args>
+    explicit RedBlackTreeNode(std::in_place_t, Args &&...args)
+        : parent_(nullptr),
+          left_(nullptr),
+          right_(nullptr),
+          key_(std::forward<Args>(args)...),
+          color_(kRed) {}
+
     /**
      * @brief Конструктор, создающий узел дерева, инициализированный
      * значением key и цветом color
@@ -1589,6 +3014,9 @@ class RedBlackTree {
       right_ = nullptr;
       parent_ = nullptr;
       color_ = kRed;
+      if constexpr (OrderStatistics) {
+        this->count_ = 1;
+      }
     }
 
     /**
@@ -1702,6 +3130,144 @@ class RedBlackTree {
     tree_color color_;
   };
 
+  /**
+   * @brief Пул узлов дерева: выделяет память блоками (slab) и раздает ее по
+   * одному узлу.
+   *
+   * @details Размер блоков растет от kFirstSlabSize до kMaxSlabSize узлов.
+   * Освобожденные узлы попадают в односвязный список свободных ячеек
+   * (указатель на следующую ячейку хранится прямо в памяти узла) и
+   * переиспользуются следующими вставками.
+   *
+   * Блоки хранятся через std::shared_ptr: при merge узлы переходят в другое
+   * дерево вместе с памятью, поэтому пул принимающего дерева тоже ссылается
+   * на блоки пула other (Adopt()). Блок освобождается, когда на него не
+   * ссылается ни один пул. Ссылок пул-на-пул нет, поэтому циклических
+   * ссылок при взаимных merge не возникает.
+   *
+   * Если блоки ни с кем не разделены (Exclusive()), дерево может освободить
+   * всю память разом через Reset(), не обходя узлы по одному.
+   */
+  struct RedBlackTreeNodePool {
+    RedBlackTreeNodePool() noexcept
+        : free_(nullptr),
+          current_(nullptr),
+          current_left_(0U),
+          next_slab_size_(kFirstSlabSize) {}
+
+    RedBlackTreeNodePool(const RedBlackTreeNodePool &) = delete;
+    RedBlackTreeNodePool &operator=(const RedBlackTreeNodePool &) = delete;
+
+    /**
+     * @brief Создает узел из args в памяти пула. Если конструктор узла
+     * выбросит исключение, память возвращается в пул.
+     */
+    template <typename... Args>
+    tree_node *Create(Args &&...args) {
+      Slot *slot = Allocate();
+      try {
+        return new (slot->storage_) tree_node(std::forward<Args>(args)...);
+      } catch (...) {
+        Release(slot);
+        throw;
+      }
+    }
+
+    /**
+     * @brief Уничтожает узел и возвращает его память в список свободных
+     */
+    void Destroy(tree_node *node) noexcept {
+      node->~tree_node();
+      Release(reinterpret_cast<Slot *>(node));
+    }
+
+    /**
+     * @brief Освобождает все блоки пула. Узлы к этому моменту должны быть
+     * уничтожены, а их память - больше не использоваться.
+     */
+    void Reset() noexcept {
+      slabs_.clear();
+      free_ = nullptr;
+      current_ = nullptr;
+      current_left_ = 0U;
+      next_slab_size_ = kFirstSlabSize;
+    }
+
+    /**
+     * @brief Добавляет пулу ссылки на блоки other, чтобы узлы other могли
+     * перейти в дерево этого пула
+     */
+    void Adopt(const RedBlackTreeNodePool &other) {
+      if (&other == this || other.slabs_.empty()) return;
+      slabs_.insert(slabs_.end(), other.slabs_.begin(), other.slabs_.end());
+      // При повторных merge блоки могут повторяться
+      std::sort(slabs_.begin(), slabs_.end());
+      slabs_.erase(std::unique(slabs_.begin(), slabs_.end()), slabs_.end());
+    }
+
+    /**
+     * @brief Принадлежат ли все блоки только этому пулу
+     */
+    bool Exclusive() const noexcept {
+      for (const auto &slab : slabs_) {
+        if (slab.use_count() != 1) return false;
+      }
+      return true;
+    }
+
+    void Swap(RedBlackTreeNodePool &other) noexcept {
+      slabs_.swap(other.slabs_);
+      std::swap(free_, other.free_);
+      std::swap(current_, other.current_);
+      std::swap(current_left_, other.current_left_);
+      std::swap(next_slab_size_, other.next_slab_size_);
+    }
+
+   private:
+    // Ячейка блока: либо узел, либо ссылка на следующую свободную ячейку
+    union Slot {
+      Slot *next_;
+      alignas(tree_node) unsigned char storage_[sizeof(tree_node)];
+    };
+
+    // Размер первого блока (в узлах)
+    static constexpr size_type kFirstSlabSize = 32U;
+    // Максимальный размер блока (в узлах)
+    static constexpr size_type kMaxSlabSize = 4096U;
+
+    Slot *Allocate() {
+      if (free_ != nullptr) {
+        Slot *slot = free_;
+        free_ = slot->next_;
+        return slot;
+      }
+      if (current_left_ == 0U) {
+        std::shared_ptr<Slot[]> slab(new Slot[next_slab_size_]);
+        slabs_.push_back(slab);
+        current_ = slab.get();
+        current_left_ = next_slab_size_;
+        next_slab_size_ = std::min(next_slab_size_ * 2U, kMaxSlabSize);
+      }
+      --current_left_;
+      return current_++;
+    }
+
+    void Release(Slot *slot) noexcept {
+      slot->next_ = free_;
+      free_ = slot;
+    }
+
+    // Блоки, на которые ссылается пул (свои и принятые через Adopt())
+    std::vector<std::shared_ptr<Slot[]>> slabs_;
+    // Список свободных ячеек
+    Slot *free_;
+    // Еще не выданные ячейки последнего созданного блока
+    Slot *current_;
+    size_type current_left_;
+    // Размер следующего блока
+    size_type next_slab_size_;
+  };
+
   /**
    * @brief Класс итератора для дерева
    *
@@ -1920,6 +3486,8 @@ class RedBlackTree {
   size_type size_;
   // Компаратор дерева (класс для сравнения значений узлов)
   Comparator cmp_;
+  // Пул, из которого выделяются узлы дерева (кроме головы)
+  node_pool pool_;
 };
 
 #if defined(S21_CONTAINERS_TREE_TEST_HELPER)
@@ -0,0 +1,729 @@
+/**
+ * @file s21_unrolled_list.h
+ * @brief s21::unrolled_list (развернутый список) - двусвязный список, каждый
+ * узел которого хранит до B элементов в небольшом массиве.
+ *
+ * @details В s21::list каждый элемент живет в отдельном узле, поэтому при
+ * обходе на каждый элемент приходится промах кэша. В развернутом списке
+ * соседние элементы лежат в одном узле подряд, и промах кэша приходится уже на
+ * B элементов. Вставка в середину по-прежнему стоит O(B) (сдвиг внутри узла), а
+ * не O(n), как у вектора.
+ *
+ * Правила поддержания структуры:
+ * 1) Пустых узлов в списке нет - узел, из которого удалили последний элемент,
+ * сразу освобождается.
+ * 2) При вставке в заполненный узел он делится пополам.
+ * 3) Если после удаления в узле осталось меньше B / 2 элементов, то он либо
+ * сливается со следующим узлом (если элементы поместятся в один узел), либо
+ * забирает у него первый элемент.
+ *
+ * Список зациклен через служебный узел (sentinel), который хранится прямо в
+ * объекте списка и не содержит элементов. На него указывает end().
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+template <typename T, std::size_t B = 16>
+class unrolled_list {
+  static_assert(B >= 2, "s21::unrolled_list: node capacity must be >= 2");
+
+ private:
+  struct NodeBase;
+  struct Node;
+  struct UnrolledListIterator;
+  struct UnrolledListConstIterator;
+
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип ссылки на элемент
+  using reference = T &;
+  // Тип константной ссылки на элемент
+  using const_reference = const T &;
+  // Внутренний класс для итератора
+  using iterator = UnrolledListIterator;
+  // Внутренний класс для константного итератора
+  using const_iterator = UnrolledListConstIterator;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  // Максимальное количество элементов в одном узле
+  static constexpr size_type kNodeCapacity = B;
+
+  /**
+   * @brief Конструктор по умолчанию, создает пустой список
+   */
+  unrolled_list() noexcept : size_(0U) { InitializeSentinel(); }
+
+  /**
+   * @brief Параметризированный конструктор, создает список из n элементов,
+   * инициализированных значением по умолчанию
+   *
+   * @param n размер списка
+   */
+  explicit unrolled_list(size_type n) : unrolled_list() {
+    for (size_type i = 0; i < n; ++i) {
+      push_back(value_type{});
+    }
+  }
+
+  /**
+   * @brief Конструктор списка инициализаторов
+   *
+   * @param items Список создаваемых элементов
+   */
+  unrolled_list(std::initializer_list<value_type> const &items)
+      : unrolled_list() {
+    for (const auto &item : items) {
+      push_back(item);
+    }
+  }
+
+  /**
+   * @brief Конструктор копирования. Узлы копии заполняются плотно, поэтому
+   * копия может занимать меньше узлов, чем оригинал.
+   *
+   * @param other копируемый объект
+   */
+  unrolled_list(const unrolled_list &other) : unrolled_list() {
+    try {
+      for (const auto &item : other) {
+        push_back(item);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Конструктор переноса. Забираем цепочку узлов other целиком,
+   * other остается пустым.
+   *
+   * @param other переносимый объект
+   */
+  unrolled_list(unrolled_list &&other) noexcept : unrolled_list() {
+    swap(other);
+  }
+
+  /**
+   * @brief Оператор присваивания копированием
+   *
+   * @param other Копируемый список
+   * @return unrolled_list& ссылка на this
+   */
+  unrolled_list &operator=(const unrolled_list &other) {
+    if (this != &other) {
+      unrolled_list copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Оператор присваивания переносом
+   *
+   * @param other Перемещаемый список
+   * @return unrolled_list& ссылка на this
+   */
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Деструктор объекта
+   */
+  ~unrolled_list() { clear(); }
+
+  // Доступ к элементам
+
+  const_reference front() const { return *begin(); }
+
+  const_reference back() const { return *--end(); }
+
+  // Итераторы
+
+  iterator begin() noexcept { return iterator(sentinel_.next_, 0); }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(sentinel_.next_, 0);
+  }
+
+  iterator end() noexcept { return iterator(&sentinel_, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(const_cast<NodeBase *>(&sentinel_), 0);
+  }
+
+  // Информация о наполнении
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  /**
+   * @brief Возвращает максимальное количество элементов. Расчет аналогичен
+   * s21::RedBlackTree::MaxSize(), только память делится на узлы по B
+   * элементов.
+   */
+  size_type max_size() const noexcept {
+    return ((std::numeric_limits<size_type>::max() / 2) -
+            sizeof(unrolled_list)) /
+           sizeof(Node) * B;
+  }
+
+  // Изменение контейнера
+
+  /**
+   * @brief Удаляет все элементы и освобождает все узлы
+   */
+  void clear() noexcept {
+    NodeBase *node = sentinel_.next_;
+    while (node != &sentinel_) {
+      NodeBase *next = node->next_;
+      DestroyNode(static_cast<Node *>(node));
+      node = next;
+    }
+    InitializeSentinel();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Вставляет value перед pos.
+   * @details Если в узле есть место, то элементы правее позиции сдвигаются на
+   * одну ячейку. Если узел заполнен, то он делится пополам и вставка
+   * выполняется в нужную половину.
+   *
+   * @return iterator Итератор на вставленный элемент
+   */
+  iterator insert(iterator pos, const_reference value) {
+    return Emplace(pos, value);
+  }
+
+  iterator insert(iterator pos, value_type &&value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  /**
+   * @brief Удаляет элемент на позиции pos. Итераторы на элементы того же и
+   * следующего узла становятся недействительными.
+   *
+   * @param pos
+   */
+  void erase(iterator pos) {
+    if (empty() || pos.node_ == &sentinel_) {
+      throw std::invalid_argument("Erase error");
+    }
+    Node *node = static_cast<Node *>(pos.node_);
+    node->Data()[pos.index_].~value_type();
+    ShiftLeft(node, pos.index_ + 1);
+    --node->count_;
+    --size_;
+    if (node->count_ == 0) {
+      Unlink(node);
+      DestroyNode(node);
+    } else {
+      Rebalance(node);
+    }
+  }
+
+  void push_back(const_reference value) { Emplace(end(), value); }
+
+  void push_back(value_type &&value) { Emplace(end(), std::move(value)); }
+
+  void push_front(const_reference value) { Emplace(begin(), value); }
+
+  void push_front(value_type &&value) { Emplace(begin(), std::move(value)); }
+
+  void pop_back() {
+    if (empty()) {
+      throw std::out_of_range(
+          "Unable to remove the element from empty container");
+    }
+    erase(--end());
+  }
+
+  void pop_front() {
+    if (empty()) {
+      throw std::out_of_range(
+          "Unable to remove the element from empty container");
+    }
+    erase(begin());
+  }
+
+  /**
+   * @brief Обменивает содержимое списков. Т.к. служебный узел хранится внутри
+   * объекта, то перепривязываем крайние узлы обоих списков.
+   */
+  void swap(unrolled_list &other) noexcept {
+    std::swap(sentinel_.next_, other.sentinel_.next_);
+    std::swap(sentinel_.prev_, other.sentinel_.prev_);
+    std::swap(size_, other.size_);
+    FixSentinel();
+    other.FixSentinel();
+  }
+
+  /**
+   * @brief Объединяет два отсортированных списка в один отсортированный.
+   * other после операции пуст.
+   */
+  void merge(unrolled_list &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    size_type middle = size_;
+    splice(end(), other);
+    std::vector<value_type> values = ExtractValues();
+    std::inplace_merge(values.begin(), values.begin() + middle, values.end());
+    AssignValues(values);
+  }
+
+  /**
+   * @brief Переносит все элементы other перед pos за O(B): узлы other
+   * встраиваются целиком, при необходимости узел в позиции pos делится на
+   * два.
+   */
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    NodeBase *next = pos.node_;
+    if (pos.index_ != 0) {
+      next = SplitNode(static_cast<Node *>(pos.node_), pos.index_);
+    }
+    NodeBase *prev = next->prev_;
+    prev->next_ = other.sentinel_.next_;
+    other.sentinel_.next_->prev_ = prev;
+    next->prev_ = other.sentinel_.prev_;
+    other.sentinel_.prev_->next_ = next;
+    size_ += other.size_;
+    other.InitializeSentinel();
+    other.size_ = 0;
+  }
+
+  /**
+   * @brief Разворачивает список: меняем порядок узлов и порядок элементов
+   * внутри каждого узла, без перемещения элементов между узлами.
+   */
+  void reverse() noexcept {
+    NodeBase *node = &sentinel_;
+    do {
+      std::swap(node->next_, node->prev_);
+      if (node != &sentinel_) {
+        Node *full = static_cast<Node *>(node);
+        std::reverse(full->Data(), full->Data() + full->count_);
+      }
+      node = node->prev_;
+    } while (node != &sentinel_);
+  }
+
+  /**
+   * @brief Удаляет последовательно повторяющиеся элементы
+   */
+  void unique() {
+    if (size_ < 2) {
+      return;
+    }
+    std::vector<value_type> values = ExtractValues();
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    clear();
+    for (auto &value : values) {
+      push_back(std::move(value));
+    }
+  }
+
+  /**
+   * @brief Сортирует элементы (устойчивая сортировка). Элементы
+   * перемещаются во временный буфер, сортируются и возвращаются на прежние
+   * места, поэтому структура узлов не меняется.
+   */
+  void sort() {
+    if (size_ < 2) {
+      return;
+    }
+    std::vector<value_type> values = ExtractValues();
+    std::stable_sort(values.begin(), values.end());
+    AssignValues(values);
+  }
+
+  // Bonus part
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    iterator it(pos.node_, pos.index_);
+    ((it = ++insert(it, std::forward<Args>(args))), ...);
+    return it;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (push_front(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  /**
+   * @brief Связующая часть узла. Служебный узел списка состоит только из неё
+   * (count_ у него всегда 0).
+   */
+  struct NodeBase {
+    NodeBase *next_;
+    NodeBase *prev_;
+    size_type count_;
+  };
+
+  /**
+   * @brief Узел списка с массивом на B элементов. Память под элементы не
+   * инициализирована, элементы конструируются в ней по мере вставки, поэтому
+   * T не обязан иметь конструктор по умолчанию.
+   */
+  struct Node : NodeBase {
+    Node() : NodeBase{nullptr, nullptr, 0U} {}
+    value_type *Data() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage_));
+    }
+    alignas(value_type) unsigned char storage_[sizeof(value_type) * B];
+  };
+
+  struct UnrolledListIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = T *;
+    using reference = T &;
+
+    UnrolledListIterator() = delete;
+    UnrolledListIterator(NodeBase *node, size_type index)
+        : node_(node), index_(index) {}
+
+    reference operator*() const {
+      if (index_ >= node_->count_) {
+        throw std::invalid_argument("Iterator points to end!");
+      }
+      return static_cast<Node *>(node_)->Data()[index_];
+    }
+
+    iterator &operator++() noexcept {
+      if (++index_ >= node_->count_) {
+        node_ = node_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    iterator &operator--() noexcept {
+      if (index_ == 0) {
+        node_ = node_->prev_;
+        index_ = node_->count_;
+      }
+      // Для пустого списка prev_ служебного узла - он сам, count_ равен 0
+      if (index_ != 0) {
+        --index_;
+      }
+      return *this;
+    }
+
+    iterator operator--(int) noexcept {
+      iterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const iterator &other) const noexcept {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+
+    bool operator!=(const iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+    NodeBase *node_;
+    size_type index_;
+  };
+
+  struct UnrolledListConstIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T *;
+    using reference = const T &;
+
+    UnrolledListConstIterator() = delete;
+    UnrolledListConstIterator(NodeBase *node, size_type index)
+        : node_(node), index_(index) {}
+    UnrolledListConstIterator(const iterator &it)
+        : node_(it.node_), index_(it.index_) {}
+
+    reference operator*() const { return *iterator(node_, index_); }
+
+    const_iterator &operator++() noexcept {
+      iterator it(node_, index_);
+      ++it;
+      node_ = it.node_;
+      index_ = it.index_;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    const_iterator &operator--() noexcept {
+      iterator it(node_, index_);
+      --it;
+      node_ = it.node_;
+      index_ = it.index_;
+      return *this;
+    }
+
+    const_iterator operator--(int) noexcept {
+      const_iterator tmp = *this;
+      --(*this);
+      return tmp;
+    }
+
+    friend bool operator==(const const_iterator &it1,
+                           const const_iterator &it2) noexcept {
+      return it1.node_ == it2.node_ && it1.index_ == it2.index_;
+    }
+
+    friend bool operator!=(const const_iterator &it1,
+                           const const_iterator &it2) noexcept {
+      return !(it1 == it2);
+    }
+
+    NodeBase *node_;
+    size_type index_;
+  };
+
+  /**
+   * @brief Конструирует элемент из args перед pos. Общая часть всех вставок.
+   */
+  template <typename... Args>
+  iterator Emplace(iterator pos, Args &&...args) {
+    Node *node;
+    size_type index = pos.index_;
+    if (pos.node_ == &sentinel_) {
+      // Вставка в конец - дописываем в последний узел, если в нем есть
+      // место, иначе заводим новый
+      NodeBase *last = sentinel_.prev_;
+      if (last != &sentinel_ && last->count_ < B) {
+        node = static_cast<Node *>(last);
+      } else {
+        node = CreateNode(last);
+      }
+      index = node->count_;
+    } else if (index == 0 && pos.node_->prev_ != &sentinel_ &&
+               pos.node_->prev_->count_ < B) {
+      // Вставка перед первым элементом узла - дописываем в конец
+      // предыдущего узла, если в нем есть место, чтобы не сдвигать элементы
+      node = static_cast<Node *>(pos.node_->prev_);
+      index = node->count_;
+    } else {
+      node = static_cast<Node *>(pos.node_);
+      if (node->count_ == B) {
+        // Узел заполнен - делим его пополам
+        size_type half = B / 2;
+        Node *right = static_cast<Node *>(SplitNode(node, half));
+        if (index > half) {
+          node = right;
+          index -= half;
+        }
+      }
+    }
+
+    ShiftRight(node, index);
+    ++node->count_;
+    try {
+      new (node->Data() + index) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      ShiftLeft(node, index + 1);
+      --node->count_;
+      if (node->count_ == 0) {
+        Unlink(node);
+        DestroyNode(node);
+      }
+      throw;
+    }
+    ++size_;
+    return iterator(node, index);
+  }
+
+  /**
+   * @brief Сдвигает элементы узла [from, count_) на одну ячейку вправо,
+   * освобождая ячейку from. Ячейка from после вызова не инициализирована.
+   */
+  void ShiftRight(Node *node, size_type from) {
+    value_type *data = node->Data();
+    for (size_type i = node->count_; i > from; --i) {
+      new (data + i) value_type(std::move(data[i - 1]));
+      data[i - 1].~value_type();
+    }
+  }
+
+  /**
+   * @brief Сдвигает элементы узла [from, count_) на одну ячейку влево. Ячейка
+   * from - 1 перед вызовом должна быть не инициализирована.
+   */
+  void ShiftLeft(Node *node, size_type from) noexcept {
+    value_type *data = node->Data();
+    for (size_type i = from; i < node->count_; ++i) {
+      new (data + i - 1) value_type(std::move(data[i]));
+      data[i].~value_type();
+    }
+  }
+
+  /**
+   * @brief Делит узел: элементы [index, count_) переносятся в новый узел,
+   * который встает сразу после node.
+   *
+   * @return NodeBase* Новый узел
+   */
+  NodeBase *SplitNode(Node *node, size_type index) {
+    Node *right = CreateNode(node);
+    MoveElements(node, index, node->count_, right);
+    return right;
+  }
+
+  /**
+   * @brief Переносит элементы [from, to) узла src в конец узла dst
+   */
+  void MoveElements(Node *src, size_type from, size_type to,
+                    Node *dst) noexcept {
+    value_type *src_data = src->Data();
+    value_type *dst_data = dst->Data();
+    for (size_type i = from; i < to; ++i) {
+      new (dst_data + dst->count_) value_type(std::move(src_data[i]));
+      src_data[i].~value_type();
+      ++dst->count_;
+    }
+    src->count_ -= to - from;
+  }
+
+  /**
+   * @brief Восстанавливает заполненность узла после удаления из него
+   * элемента (см. правило 3 в описании файла)
+   */
+  void Rebalance(Node *node) noexcept {
+    if (node->count_ >= B / 2 || node->next_ == &sentinel_) {
+      return;
+    }
+    Node *next = static_cast<Node *>(node->next_);
+    if (node->count_ + next->count_ <= B) {
+      MoveElements(next, 0, next->count_, node);
+      Unlink(next);
+      DestroyNode(next);
+    } else {
+      // Забираем первый элемент следующего узла
+      value_type *next_data = next->Data();
+      new (node->Data() + node->count_) value_type(std::move(next_data[0]));
+      next_data[0].~value_type();
+      ++node->count_;
+      ShiftLeft(next, 1);
+      --next->count_;
+    }
+  }
+
+  /**
+   * @brief Создает пустой узел и встраивает его после prev
+   */
+  Node *CreateNode(NodeBase *prev) {
+    Node *node = new Node;
+    node->prev_ = prev;
+    node->next_ = prev->next_;
+    prev->next_->prev_ = node;
+    prev->next_ = node;
+    return node;
+  }
+
+  void Unlink(NodeBase *node) noexcept {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+  }
+
+  void DestroyNode(Node *node) noexcept {
+    value_type *data = node->Data();
+    for (size_type i = 0; i < node->count_; ++i) {
+      data[i].~value_type();
+    }
+    delete node;
+  }
+
+  /**
+   * @brief Переносит все элементы во временный буфер, оставляя узлы на месте
+   * (элементы узлов остаются в moved-from состоянии)
+   */
+  std::vector<value_type> ExtractValues() {
+    std::vector<value_type> values;
+    values.reserve(size_);
+    for (auto &value : *this) {
+      values.push_back(std::move(value));
+    }
+    return values;
+  }
+
+  /**
+   * @brief Возвращает элементы из буфера на их места в узлах
+   */
+  void AssignValues(std::vector<value_type> &values) {
+    auto src = values.begin();
+    for (auto &value : *this) {
+      value = std::move(*src++);
+    }
+  }
+
+  void InitializeSentinel() noexcept {
+    sentinel_.next_ = &sentinel_;
+    sentinel_.prev_ = &sentinel_;
+    sentinel_.count_ = 0;
+  }
+
+  /**
+   * @brief Возвращает указатели крайних узлов на служебный узел после
+   * обмена/переноса цепочки узлов между списками
+   */
+  void FixSentinel() noexcept {
+    if (size_ == 0) {
+      InitializeSentinel();
+    } else {
+      sentinel_.next_->prev_ = &sentinel_;
+      sentinel_.prev_->next_ = &sentinel_;
+    }
+  }
+
+  // Служебный узел, через который зациклен список
+  NodeBase sentinel_;
+  // Количество элементов в списке
+  size_type size_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_UNROLLED_LIST_H_
@@ -1,12 +1,14 @@
 #ifndef SRC_HEADERS_S21_VECTOR_H
 #define SRC_HEADERS_S21_VECTOR_H
 
-#include <algorithm>         // для std::copy и std::min
+#include <algorithm>  // для std::copy, std::move и std::min
 #include <initializer_list>  // для std::initializer_list
 #include <iostream>
 #include <limits>     // для std::numeric_limits
 #include <stdexcept>  // для std::out_of_range
 #include <string>
+#include <type_traits>  // для std::is_nothrow_*
+#include <utility>  // для std::move и std::forward
 
 namespace s21 {
 template <typename T>
@@ -67,11 +69,16 @@ class vector {
                                   // освобождения неиспользуемой памяти
 
   // Изменение контейнера
-  void clear() noexcept;
+  // не бросает, если не бросают T() и перемещающее присваивание T
+  void clear() noexcept(std::is_nothrow_default_constructible_v<T> &&
+                        std::is_nothrow_move_assignable_v<T>);
   iterator insert(const_iterator pos, const_reference value);
   iterator insert(const_iterator pos, value_type &&value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);  // создает элемент в конце
   void pop_back();  // удаляет последний элемент
   void swap(vector &other);
 
@@ -282,7 +289,7 @@ void vector<T>::reserve(size_type size) {
   }
   if (size > capacity_) {
     value_type *temp = new value_type[size];
-    std::copy(vector_, vector_ + size_, temp);
+    std::move(vector_, vector_ + size_, temp);
     delete[] vector_;
     vector_ = temp;
     capacity_ = size;
@@ -305,11 +312,16 @@ void vector<T>::shrink_to_fit() noexcept {
 
 // ИЗМЕНЕНИЕ КОНТЕЙНЕРА
 // очищает содержимое
-template <typename T>
-void vector<T>::clear() noexcept {
+// буфер сохраняется (как у std::vector), поэтому capacity_ остается верным и
+// push_back() после clear() не выделяет память заново. Буфер создан через
+// new T[], поэтому элементы не разрушаются, а получают значение T(), чтобы
+// освободить занятые ими ресурсы. T() и присваивание могут бросить, поэтому
+// clear() noexcept только для типов, у которых они не бросают.
+template <typename T>
+void vector<T>::clear() noexcept(std::is_nothrow_default_constructible_v<T> &&
+                                 std::is_nothrow_move_assignable_v<T>) {
+  for (size_type i = 0; i < size_; ++i) vector_[i] = value_type();
   size_ = 0;
-  delete[] vector_;
-  vector_ = nullptr;
 }
 
 // вставляет элементы в конкретную позицию и возвращает итератор, указывающий на
@@ -332,7 +344,7 @@ typename vector<T>::iterator vector<T>::insert(const_iterator pos,
   if (pos < begin() || pos > end())
     throw std::out_of_range("Error: pos >= size_");
   size_type position = pos - begin();
-  push_back(value);
+  push_back(std::move(value));
   for (size_type i = size_ - 1; i > position; i--)
     std::swap(vector_[i], vector_[i - 1]);
   return vector_ + position;
@@ -359,6 +371,24 @@ void vector<T>::push_back(const_reference value) {
   size_ += 1;
 }
 
+template <typename T>
+void vector<T>::push_back(value_type &&value) {
+  if (size_ + 1 > capacity_) {
+    reserve((capacity_ == 0) ? 1 : capacity_ * 2);
+  }
+  vector_[size_] = std::move(value);
+  size_ += 1;
+}
+
+// элементы буфера уже созданы, поэтому новый элемент строится из args и
+// переносится на свое место
+template <typename T>
+template <typename... Args>
+typename vector<T>::reference vector<T>::emplace_back(Args &&...args) {
+  push_back(value_type(std::forward<Args>(args)...));
+  return back();
+}
+
 // удаляет последний элемент
 template <typename T>
 void vector<T>::pop_back() {
@@ -0,0 +1,206 @@
+/**
+ * @file s21_ws_deque.h
+ * @brief s21::ws_deque - дек для планировщиков с перехватом работы
+ * (work stealing), алгоритм Chase-Lev.
+ *
+ * @details У дека один владелец и сколько угодно "воров":
+ * 1) Владелец кладет (push) и забирает (pop) элементы с нижнего конца без
+ * блокировок. Атомарная операция CAS нужна ему, только когда в деке остается
+ * последний элемент и за него можно соревноваться с вором.
+ * 2) Воры забирают (steal) элементы с верхнего конца: один CAS на верхний
+ * индекс. Проигравший CAS вор получает false и пробует еще раз (или другой
+ * дек).
+ *
+ * Элементы лежат в кольцевом буфере, который владелец удваивает при
+ * заполнении. Старый буфер может еще читаться ворами, поэтому он не
+ * освобождается до уничтожения дека (суммарно это не больше размера
+ * текущего буфера).
+ *
+ * Порядок памяти соответствует работе N. M. Le, A. Pop, A. Cohen,
+ * F. Zappa Nardelli "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (2013).
+ *
+ * Элементы хранятся в std::atomic<T>, поэтому T должен быть тривиально
+ * копируемым. Обычно это указатель на задачу.
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_WS_DEQUE_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_WS_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+template <typename T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ws_deque elements must be trivially copyable");
+
+ public:
+  // Тип элемента (T — параметр шаблона)
+  using value_type = T;
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пустой дек
+   *
+   * @param capacity Начальный размер буфера, степень двойки
+   * @throw std::invalid_argument capacity не степень двойки
+   */
+  explicit ws_deque(size_type capacity = 64U) : top_(0), bottom_(0) {
+    if (capacity == 0U || (capacity & (capacity - 1U)) != 0U) {
+      throw std::invalid_argument("ws_deque capacity must be a power of two");
+    }
+    buffer_.store(new Buffer(capacity), std::memory_order_relaxed);
+  }
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  ~ws_deque() {
+    delete buffer_.load(std::memory_order_relaxed);
+    for (Buffer *old : retired_) {
+      delete old;
+    }
+  }
+
+  /**
+   * @brief Кладет элемент на нижний конец. Вызывает только владелец.
+   */
+  void push(value_type value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<std::int64_t>(buffer->mask_)) {
+      buffer = Grow(buffer, top, bottom);
+    }
+    buffer->Put(bottom, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Забирает элемент с нижнего конца (последний положенный).
+   * Вызывает только владелец.
+   *
+   * @return false дек пуст
+   */
+  bool pop(value_type &value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+
+    bool result = true;
+    if (top <= bottom) {
+      // Как в steal(): value меняется, только если элемент достался нам
+      value_type item = buffer->Get(bottom);
+      if (top == bottom) {
+        // Последний элемент: соревнуемся с ворами
+        result = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+      if (result) value = item;
+    } else {
+      result = false;
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Забирает элемент с верхнего конца (первый положенный). Может
+   * вызываться из любого потока.
+   *
+   * @return false дек пуст или элемент перехватил другой поток
+   */
+  bool steal(value_type &value) {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    Buffer *buffer = buffer_.load(std::memory_order_acquire);
+    value_type result = buffer->Get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+
+  /**
+   * @brief Примерное количество элементов: при параллельной работе значение
+   * может устареть сразу после чтения
+   */
+  size_type size_approx() const noexcept {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0U;
+  }
+
+  bool empty() const noexcept { return size_approx() == 0U; }
+
+  /**
+   * @brief Текущий размер буфера
+   */
+  size_type capacity() const noexcept {
+    return buffer_.load(std::memory_order_relaxed)->mask_ + 1U;
+  }
+
+ private:
+  /**
+   * @brief Кольцевой буфер. Индексы растут монотонно, позиция в буфере -
+   * индекс по маске.
+   */
+  struct Buffer {
+    explicit Buffer(size_type capacity)
+        : mask_(capacity - 1U), slots_(new std::atomic<value_type>[capacity]) {}
+    Buffer(const Buffer &) = delete;
+    Buffer &operator=(const Buffer &) = delete;
+    ~Buffer() { delete[] slots_; }
+
+    value_type Get(std::int64_t index) const noexcept {
+      return slots_[static_cast<size_type>(index) & mask_].load(
+          std::memory_order_relaxed);
+    }
+    void Put(std::int64_t index, value_type value) noexcept {
+      slots_[static_cast<size_type>(index) & mask_].store(
+          value, std::memory_order_relaxed);
+    }
+
+    size_type mask_;
+    std::atomic<value_type> *slots_;
+  };
+
+  Buffer *Grow(Buffer *buffer, std::int64_t top, std::int64_t bottom) {
+    Buffer *bigger = new Buffer((buffer->mask_ + 1U) * 2U);
+    for (std::int64_t i = top; i < bottom; ++i) {
+      bigger->Put(i, buffer->Get(i));
+    }
+    retired_.push_back(buffer);
+    buffer_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  // Верхний (воровской) и нижний (владельца) индексы лежат в разных
+  // строках кэша, чтобы push/pop владельца не мешали ворам
+  alignas(64) std::atomic<std::int64_t> top_;
+  alignas(64) std::atomic<std::int64_t> bottom_;
+  alignas(64) std::atomic<Buffer *> buffer_;
+  // Старые буферы, которые еще могут читать воры
+  std::vector<Buffer *> retired_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_WS_DEQUE_H_
@@ -0,0 +1,360 @@
+/**
+ * @file s21_ws_scheduler.h
+ * @brief s21::ws_scheduler - пул потоков с перехватом работы (work stealing)
+ * для рекурсивных задач "разделяй и властвуй".
+ *
+ * @details У каждого рабочего потока свой s21::ws_deque задач:
+ * 1) Задача, порожденная внутри рабочего потока, кладется в его дек, и
+ * поток сам выполняет ее следующей (LIFO) - данные еще в кэше.
+ * 2) Поток без работы крадет самую старую задачу (FIFO) у случайного
+ * соседа - обычно это самый крупный кусок работы.
+ * 3) Задачи из внешних потоков попадают в общую очередь под мьютексом.
+ *
+ * Ожидание task_group::wait() не блокирует поток, а выполняет другие задачи,
+ * пока группа не завершится, поэтому вложенные группы не приводят к
+ * взаимной блокировке. Простаивающие рабочие потоки засыпают на условной
+ * переменной и просыпаются при появлении новой работы.
+ *
+ * Пример (параллельное вычисление числа Фибоначчи):
+ * @code
+ * long long Fib(s21::ws_scheduler &s, int n) {
+ *   if (n < 20) return SerialFib(n);
+ *   long long a = 0, b = 0;
+ *   s21::ws_scheduler::task_group group(s);
+ *   group.run([&] { a = Fib(s, n - 1); });
+ *   b = Fib(s, n - 2);
+ *   group.wait();
+ *   return a + b;
+ * }
+ * @endcode
+ */
+
+#ifndef S21_CONTAINERS_S21_CONTAINERS_S21_WS_SCHEDULER_H_
+#define S21_CONTAINERS_S21_CONTAINERS_S21_WS_SCHEDULER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_queue.h"
+#include "s21_ws_deque.h"
+
+namespace s21 {
+class ws_scheduler {
+ private:
+  struct Task;
+  struct Worker;
+
+ public:
+  // Тип для размера контейнера
+  using size_type = std::size_t;
+
+  /**
+   * @brief Группа задач, завершения которых можно дождаться. Деструктор
+   * дожидается оставшихся задач.
+   */
+  class task_group {
+   public:
+    explicit task_group(ws_scheduler &scheduler)
+        : scheduler_(scheduler), pending_(0U) {}
+
+    task_group(const task_group &) = delete;
+    task_group &operator=(const task_group &) = delete;
+
+    ~task_group() {
+      try {
+        wait();
+      } catch (...) {
+        // Исключение задачи, которое никто не забрал через wait()
+      }
+    }
+
+    /**
+     * @brief Запускает f асинхронно в рамках группы
+     */
+    template <typename F>
+    void run(F &&f) {
+      pending_.fetch_add(1U, std::memory_order_relaxed);
+      scheduler_.Spawn(
+          new TaskImpl<std::decay_t<F>>(this, std::forward<F>(f)));
+    }
+
+    /**
+     * @brief Дожидается завершения всех задач группы, выполняя тем временем
+     * другие задачи. Пробрасывает первое исключение, выброшенное задачей.
+     */
+    void wait() {
+      scheduler_.WaitFor(pending_);
+      std::exception_ptr error;
+      {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        std::swap(error, error_);
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+   private:
+    friend class ws_scheduler;
+
+    void Finish(std::exception_ptr error) {
+      if (error) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) {
+          error_ = error;
+        }
+      }
+      pending_.fetch_sub(1U, std::memory_order_release);
+    }
+
+    ws_scheduler &scheduler_;
+    std::atomic<size_type> pending_;
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+  };
+
+  /**
+   * @brief Запускает threads рабочих потоков
+   */
+  explicit ws_scheduler(size_type threads = DefaultConcurrency())
+      : injected_size_(0U), stop_(false), sleepers_(0U), epoch_(0U) {
+    if (threads == 0U) {
+      threads = 1U;
+    }
+    for (size_type i = 0; i < threads; ++i) {
+      workers_.emplace_back(new Worker(this, i));
+    }
+    for (auto &worker : workers_) {
+      worker->thread_ = std::thread(&ws_scheduler::WorkerLoop, this,
+                                    worker.get());
+    }
+  }
+
+  ws_scheduler(const ws_scheduler &) = delete;
+  ws_scheduler &operator=(const ws_scheduler &) = delete;
+
+  /**
+   * @brief Останавливает рабочие потоки. Все группы задач должны быть
+   * завершены до уничтожения планировщика.
+   */
+  ~ws_scheduler() {
+    stop_.store(true, std::memory_order_release);
+    WakeAll();
+    for (auto &worker : workers_) {
+      worker->thread_.join();
+    }
+    Task *task = nullptr;
+    for (auto &worker : workers_) {
+      while (worker->deque_.pop(task)) {
+        delete task;
+      }
+    }
+    while (!injected_.empty()) {
+      delete injected_.front();
+      injected_.pop();
+    }
+  }
+
+  /**
+   * @brief Количество рабочих потоков
+   */
+  size_type concurrency() const noexcept { return workers_.size(); }
+
+ private:
+  /**
+   * @brief Задача: тип-стертая функция и группа, которой она принадлежит
+   */
+  struct Task {
+    explicit Task(task_group *group) : group_(group) {}
+    virtual ~Task() = default;
+    virtual void Run() = 0;
+
+    task_group *group_;
+  };
+
+  template <typename F>
+  struct TaskImpl : Task {
+    template <typename G>
+    TaskImpl(task_group *group, G &&f)
+        : Task(group), f_(std::forward<G>(f)) {}
+    void Run() override { f_(); }
+
+    F f_;
+  };
+
+  struct Worker {
+    Worker(ws_scheduler *owner, size_type index)
+        : owner_(owner),
+          index_(index),
+          rng_(static_cast<std::uint32_t>(index * 2654435761U + 1U)) {}
+
+    ws_scheduler *owner_;
+    size_type index_;
+    std::uint32_t rng_;
+    ws_deque<Task *> deque_;
+    std::thread thread_;
+  };
+
+  static size_type DefaultConcurrency() noexcept {
+    unsigned threads = std::thread::hardware_concurrency();
+    return threads == 0U ? 1U : threads;
+  }
+
+  // Рабочий поток, который выполняет текущий код (nullptr во внешних потоках)
+  static Worker *&CurrentWorker() noexcept {
+    thread_local Worker *worker = nullptr;
+    return worker;
+  }
+
+  Worker *LocalWorker() const noexcept {
+    Worker *worker = CurrentWorker();
+    return worker != nullptr && worker->owner_ == this ? worker : nullptr;
+  }
+
+  void Spawn(Task *task) {
+    Worker *worker = LocalWorker();
+    if (worker != nullptr) {
+      worker->deque_.push(task);
+    } else {
+      std::lock_guard<std::mutex> lock(injected_mutex_);
+      injected_.push(task);
+      injected_size_.fetch_add(1U, std::memory_order_relaxed);
+    }
+    // Пара к проверке в WorkerLoop: либо засыпающий поток увидит задачу,
+    // либо мы увидим его в sleepers_
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_relaxed) > 0U) {
+      WakeOne();
+    }
+  }
+
+  /**
+   * @brief Ищет задачу: свой дек, затем общая очередь, затем кража у
+   * соседей начиная со случайного
+   */
+  Task *FindTask(Worker *worker) {
+    Task *task = nullptr;
+    if (worker != nullptr && worker->deque_.pop(task)) {
+      return task;
+    }
+    if (injected_size_.load(std::memory_order_relaxed) > 0U) {
+      std::lock_guard<std::mutex> lock(injected_mutex_);
+      if (!injected_.empty()) {
+        task = injected_.front();
+        injected_.pop();
+        injected_size_.fetch_sub(1U, std::memory_order_relaxed);
+        return task;
+      }
+    }
+    size_type n = workers_.size();
+    size_type start = 0U;
+    if (worker != nullptr) {
+      worker->rng_ ^= worker->rng_ << 13;
+      worker->rng_ ^= worker->rng_ >> 17;
+      worker->rng_ ^= worker->rng_ << 5;
+      start = worker->rng_ % n;
+    }
+    for (size_type i = 0; i < n; ++i) {
+      Worker *victim = workers_[(start + i) % n].get();
+      if (victim != worker && victim->deque_.steal(task)) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  static void Execute(Task *task) {
+    std::exception_ptr error;
+    try {
+      task->Run();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    task_group *group = task->group_;
+    delete task;
+    group->Finish(error);
+  }
+
+  void WaitFor(const std::atomic<size_type> &pending) {
+    Worker *worker = LocalWorker();
+    while (pending.load(std::memory_order_acquire) > 0U) {
+      Task *task = FindTask(worker);
+      if (task != nullptr) {
+        Execute(task);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void WorkerLoop(Worker *worker) {
+    CurrentWorker() = worker;
+    while (!stop_.load(std::memory_order_acquire)) {
+      Task *task = FindTask(worker);
+      if (task != nullptr) {
+        Execute(task);
+        continue;
+      }
+      // Перед сном объявляем себя спящим и проверяем еще раз
+      std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+      sleepers_.fetch_add(1U, std::memory_order_seq_cst);
+      task = FindTask(worker);
+      if (task != nullptr) {
+        sleepers_.fetch_sub(1U, std::memory_order_relaxed);
+        Execute(task);
+        continue;
+      }
+      {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.wait(lock, [this, epoch] {
+          return epoch_.load(std::memory_order_relaxed) != epoch ||
+                 stop_.load(std::memory_order_relaxed);
+        });
+      }
+      sleepers_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+    CurrentWorker() = nullptr;
+  }
+
+  void WakeOne() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      epoch_.fetch_add(1U, std::memory_order_release);
+    }
+    sleep_cv_.notify_one();
+  }
+
+  void WakeAll() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      epoch_.fetch_add(1U, std::memory_order_release);
+    }
+    sleep_cv_.notify_all();
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Задачи из внешних потоков
+  s21::queue<Task *> injected_;
+  std::mutex injected_mutex_;
+  // Размер injected_, чтобы не брать мьютекс, когда очередь пуста
+  std::atomic<size_type> injected_size_;
+
+  std::atomic<bool> stop_;
+  // Количество потоков, готовящихся заснуть или спящих
+  std::atomic<size_type> sleepers_;
+  // Счетчик пробуждений: спящий поток ждет его изменения
+  std::atomic<std::uint64_t> epoch_;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_CONTAINERS_S21_WS_SCHEDULER_H_
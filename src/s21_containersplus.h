@@ -2,6 +2,20 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "headers/s21_array.h"
+#include "headers/s21_blocking_queue.h"
+#include "headers/s21_btree.h"
+#include "headers/s21_concurrent_skiplist.h"
+#include "headers/s21_concurrent_stack.h"
+#include "headers/s21_ebr.h"
+#include "headers/s21_intrusive_list.h"
+#include "headers/s21_mpmc_queue.h"
 #include "headers/s21_multiset.h"
+#include "headers/s21_persistent_tree.h"
+#include "headers/s21_priority_queue.h"
+#include "headers/s21_sharded_map.h"
+#include "headers/s21_spsc_queue.h"
+#include "headers/s21_unrolled_list.h"
+#include "headers/s21_ws_deque.h"
+#include "headers/s21_ws_scheduler.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
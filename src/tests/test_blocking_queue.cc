@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_blocking_queue.h"
+
+TEST(BlockingQueueTest, TryPushTryPop) {
+  s21::blocking_queue<int> q1(3);
+  EXPECT_EQ(q1.capacity(), 3);
+  EXPECT_TRUE(q1.empty());
+
+  int value = 0;
+  EXPECT_FALSE(q1.try_pop(value));
+  EXPECT_TRUE(q1.try_push(1));
+  EXPECT_TRUE(q1.try_push(2));
+  EXPECT_TRUE(q1.push(3));
+  EXPECT_FALSE(q1.try_push(4));
+  EXPECT_EQ(q1.size(), 3);
+
+  EXPECT_TRUE(q1.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(q1.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_EQ(q1.size(), 1);
+
+  EXPECT_ANY_THROW(s21::blocking_queue<int> q2(0));
+}
+
+TEST(BlockingQueueTest, Timeouts) {
+  s21::blocking_queue<std::string> q1(1);
+  std::string value;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(q1.try_pop_for(value, std::chrono::milliseconds(20)));
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+
+  EXPECT_TRUE(q1.try_push_for(std::string("first"),
+                              std::chrono::milliseconds(20)));
+  std::string second = "second";
+  EXPECT_FALSE(q1.try_push_for(std::move(second),
+                               std::chrono::milliseconds(20)));
+  // Неудачная вставка не забирает значение
+  EXPECT_EQ(second, "second");
+
+  EXPECT_TRUE(q1.try_pop_for(value, std::chrono::milliseconds(20)));
+  EXPECT_EQ(value, "first");
+}
+
+TEST(BlockingQueueTest, CloseWakesWaiters) {
+  s21::blocking_queue<int> q1(1);
+  q1.push(1);
+
+  std::atomic<int> results(0);
+  std::thread producer([&q1, &results] {
+    if (!q1.push(2)) ++results;
+  });
+  s21::blocking_queue<int> q2;
+  std::thread consumer([&q2, &results] {
+    int value = 0;
+    if (!q2.pop(value)) ++results;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  q1.close();
+  q2.close();
+  producer.join();
+  consumer.join();
+  EXPECT_EQ(results.load(), 2);
+  EXPECT_TRUE(q1.closed());
+  EXPECT_FALSE(q1.try_push(5));
+
+  // Оставшиеся элементы можно дочитать после закрытия
+  int value = 0;
+  EXPECT_TRUE(q1.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(q1.pop(value));
+}
+
+TEST(BlockingQueueTest, PopAll) {
+  s21::blocking_queue<int, std::deque<int>> q1;
+  for (int i = 0; i < 10; ++i) q1.push(i);
+
+  s21::vector<int> out;
+  EXPECT_EQ(q1.pop_all(out, 4), 4);
+  EXPECT_EQ(q1.pop_all(out), 6);
+  ASSERT_EQ(out.size(), 10);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(out[i], i);
+
+  q1.close();
+  EXPECT_EQ(q1.pop_all(out), 0);
+}
+
+TEST(BlockingQueueTest, ManyProducersManyConsumers) {
+  const int kProducers = 4;
+  const int kConsumers = 3;
+  const int kPerProducer = 5000;
+  s21::blocking_queue<int> q1(16);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&q1] {
+      for (int i = 1; i <= kPerProducer; ++i) q1.push(i);
+    });
+  }
+  std::atomic<long long> sum(0);
+  std::atomic<int> count(0);
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < kConsumers; ++c) {
+    consumers.emplace_back([&q1, &sum, &count, c] {
+      if (c % 2) {
+        s21::vector<int> batch;
+        while (q1.pop_all(batch, 8) > 0) {
+          for (int value : batch) sum += value;
+          count += static_cast<int>(batch.size());
+          batch.clear();
+        }
+      } else {
+        int value = 0;
+        while (q1.pop(value)) {
+          sum += value;
+          ++count;
+        }
+      }
+    });
+  }
+  for (auto &thread : producers) thread.join();
+  q1.close();
+  for (auto &thread : consumers) thread.join();
+
+  EXPECT_EQ(count.load(), kProducers * kPerProducer);
+  EXPECT_EQ(sum.load(),
+            1LL * kProducers * kPerProducer * (kPerProducer + 1) / 2);
+}
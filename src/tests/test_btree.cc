@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../headers/s21_btree.h"
+
+namespace {
+template <typename Container, typename Reference>
+void ExpectSame(const Container &actual, const Reference &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  auto it = actual.begin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  EXPECT_EQ(it, actual.end());
+}
+}  // namespace
+
+TEST(BTreeSetTest, BasicOperations) {
+  s21::btree_set<int> s1 = {5, 1, 9, 3, 7, 3};
+  std::set<int> s2 = {5, 1, 9, 3, 7, 3};
+  ExpectSame(s1, s2);
+
+  auto res = s1.insert(4);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 4);
+  res = s1.insert(4);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first, 4);
+
+  EXPECT_TRUE(s1.contains(9));
+  EXPECT_FALSE(s1.contains(2));
+  EXPECT_EQ(s1.find(2), s1.end());
+  EXPECT_EQ(*s1.find(7), 7);
+  EXPECT_EQ(s1.count(7), 1U);
+
+  EXPECT_EQ(*s1.lower_bound(6), 7);
+  EXPECT_EQ(*s1.lower_bound(7), 7);
+  EXPECT_EQ(*s1.upper_bound(7), 9);
+  EXPECT_EQ(s1.lower_bound(10), s1.end());
+
+  EXPECT_EQ(s1.erase(5), 1U);
+  EXPECT_EQ(s1.erase(5), 0U);
+  EXPECT_EQ(*s1.erase(s1.find(1)), 3);
+  EXPECT_EQ(*std::prev(s1.end()), 9);
+  EXPECT_EQ(s1.size(), 4U);
+  s1.clear();
+  EXPECT_TRUE(s1.empty());
+  EXPECT_EQ(s1.begin(), s1.end());
+}
+
+TEST(BTreeSetTest, ManyElementsSplitAndMerge) {
+  // Достаточно элементов для нескольких уровней узлов
+  s21::btree_set<int> s1;
+  std::set<int> s2;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 5000);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(s1.erase(key), s2.erase(key));
+    } else {
+      EXPECT_EQ(s1.insert(key).second, s2.insert(key).second);
+    }
+  }
+  ExpectSame(s1, s2);
+  // Обход в обратную сторону
+  auto it = s1.end();
+  for (auto rit = s2.rbegin(); rit != s2.rend(); ++rit) {
+    --it;
+    EXPECT_EQ(*it, *rit);
+  }
+  // Удаление всех элементов через итератор, который возвращает erase()
+  auto next = s1.begin();
+  while (next != s1.end()) {
+    int expected = *std::next(s2.begin());
+    s2.erase(s2.begin());
+    next = s1.erase(next);
+    if (next != s1.end()) {
+      EXPECT_EQ(*next, expected);
+    }
+  }
+  EXPECT_TRUE(s1.empty());
+}
+
+TEST(BTreeSetTest, StringsCopyAndAssign) {
+  s21::btree_set<std::string> s1;
+  std::set<std::string> s2;
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = std::to_string(i * 7919 % 3001) + " long enough for heap";
+    s1.insert(key);
+    s2.insert(key);
+  }
+  s21::btree_set<std::string> s3(s1);
+  ExpectSame(s3, s2);
+  s21::btree_set<std::string> s4 = {"x"};
+  s4 = s3;
+  ExpectSame(s4, s2);
+  s21::btree_set<std::string> s5(std::move(s4));
+  ExpectSame(s5, s2);
+  EXPECT_TRUE(s4.empty());
+  s1.clear();
+  EXPECT_TRUE(s1.empty());
+  ExpectSame(s3, s2);
+}
+
+TEST(BTreeSetTest, SortedRangeAndHint) {
+  std::vector<int> items;
+  for (int i = 0; i < 10000; ++i) items.push_back(i * 2);
+  s21::btree_set<int> s1(items.begin(), items.end());
+  EXPECT_EQ(s1.size(), items.size());
+  EXPECT_EQ(*s1.begin(), 0);
+  EXPECT_EQ(*std::prev(s1.end()), 19998);
+  auto it = s1.insert(s1.find(10), 9);
+  EXPECT_EQ(*it, 9);
+  // Неверная подсказка: вставка все равно на своем месте
+  it = s1.insert(s1.begin(), 101);
+  EXPECT_EQ(*std::prev(it), 100);
+  EXPECT_EQ(*s1.emplace_hint(s1.end(), 30000), 30000);
+  EXPECT_EQ(s1.insert(s1.end(), 4), s1.find(4));
+  EXPECT_EQ(s1.size(), items.size() + 3);
+}
+
+TEST(BTreeSetTest, MergeAndInsertMany) {
+  s21::btree_set<int> s1 = {1, 3, 5};
+  s21::btree_set<int> s2 = {2, 3, 4};
+  s1.merge(s2);
+  ExpectSame(s1, std::set<int>{1, 2, 3, 4, 5});
+  ExpectSame(s2, std::set<int>{3});
+
+  auto result = s1.insert_many(6, 1, 0);
+  ASSERT_EQ(result.size(), 3U);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_TRUE(result[2].second);
+  // Итераторы действительны после всех вставок
+  EXPECT_EQ(*result[0].first, 6);
+  EXPECT_EQ(*result[1].first, 1);
+  EXPECT_EQ(*result[2].first, 0);
+}
+
+TEST(BTreeSetTest, CopyThrowKeepsSource) {
+  struct Throwing {
+    Throwing(int v) : value(v) {}
+    Throwing(const Throwing &other) : value(other.value) {
+      if (++Counter() == Limit()) throw std::runtime_error("copy");
+    }
+    Throwing(Throwing &&other) noexcept : value(other.value) {}
+    bool operator<(const Throwing &other) const { return value < other.value; }
+
+    int value;
+    static int &Counter() {
+      static int counter = 0;
+      return counter;
+    }
+    static int &Limit() {
+      static int limit = -1;
+      return limit;
+    }
+  };
+  s21::btree_set<Throwing> s1;
+  for (int i = 0; i < 500; ++i) s1.insert(Throwing(i));
+  Throwing::Counter() = 0;
+  Throwing::Limit() = 300;
+  // Частично скопированное дерево удаляется (утечки ловит AddressSanitizer)
+  EXPECT_THROW(s21::btree_set<Throwing> s2(s1), std::runtime_error);
+  Throwing::Limit() = -1;
+  EXPECT_EQ(s1.size(), 500U);
+  s21::btree_set<Throwing> s3(s1);
+  EXPECT_EQ(s3.size(), 500U);
+}
+
+TEST(BTreeMultisetTest, DuplicatesCountAndErase) {
+  s21::btree_multiset<int> s1;
+  std::multiset<int> s2;
+  std::mt19937 gen(3);
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(gen() % 40);
+    s1.insert(key);
+    s2.insert(key);
+  }
+  ExpectSame(s1, s2);
+  for (int key = 0; key < 40; ++key) {
+    EXPECT_EQ(s1.count(key), s2.count(key));
+    auto range = s1.equal_range(key);
+    auto distance = std::distance(range.first, range.second);
+    EXPECT_EQ(static_cast<std::size_t>(distance), s2.count(key));
+  }
+  EXPECT_EQ(s1.erase(7), s2.erase(7));
+  EXPECT_EQ(s1.count(7), 0U);
+  s1.erase(s1.find(8));
+  s2.erase(s2.find(8));
+  ExpectSame(s1, s2);
+
+  s21::btree_multiset<int> s3 = {1, 1, 2};
+  s1.merge(s3);
+  s2.insert({1, 1, 2});
+  EXPECT_TRUE(s3.empty());
+  ExpectSame(s1, s2);
+}
+
+TEST(BTreeMultisetTest, InsertManyAndHint) {
+  s21::btree_multiset<int> s1 = {1, 1, 2};
+  auto result = s1.insert_many(1, 2, 1);
+  // Каждый итератор указывает на свой экземпляр: вставленные позже стоят
+  // правее
+  EXPECT_EQ(std::distance(s1.begin(), result[0].first), 2);
+  EXPECT_EQ(std::distance(s1.begin(), result[2].first), 3);
+  EXPECT_EQ(std::distance(s1.begin(), result[1].first), 5);
+  auto it = s1.insert(s1.end(), 2);
+  EXPECT_EQ(std::next(it), s1.end());
+  s1.emplace_hint(s1.begin(), 0);
+  ExpectSame(s1, std::multiset<int>{0, 1, 1, 1, 1, 2, 2, 2});
+}
+
+TEST(BTreeMapTest, BasicOperations) {
+  s21::btree_map<int, std::string> m1 = {{3, "c"}, {1, "a"}, {2, "b"}};
+  EXPECT_EQ(m1.at(2), "b");
+  EXPECT_THROW(m1.at(4), std::out_of_range);
+  m1[4] = "d";
+  EXPECT_EQ(m1.size(), 4U);
+  EXPECT_FALSE(m1.insert(1, "z").second);
+  EXPECT_EQ(m1[1], "a");
+  EXPECT_FALSE(m1.insert_or_assign(1, "z").second);
+  EXPECT_EQ(m1[1], "z");
+  EXPECT_TRUE(m1.try_emplace(5, 3, 'e').second);
+  EXPECT_EQ(m1.at(5), "eee");
+  EXPECT_EQ(m1.find(5)->second, "eee");
+  EXPECT_EQ(m1.lower_bound(0)->first, 1);
+  EXPECT_EQ(m1.upper_bound(5), m1.end());
+  EXPECT_EQ(m1.erase(3), 1U);
+  EXPECT_FALSE(m1.contains(3));
+  const auto &m2 = m1;
+  EXPECT_EQ(m2.at(4), "d");
+  EXPECT_EQ(m2.count(4), 1U);
+}
+
+TEST(BTreeMapTest, MatchesStdMap) {
+  s21::btree_map<int, int> m1;
+  std::map<int, int> m2;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(gen() % 4000);
+    if (gen() % 4 == 0) {
+      EXPECT_EQ(m1.erase(key), m2.erase(key));
+    } else {
+      m1[key] += i;
+      m2[key] += i;
+    }
+  }
+  ExpectSame(m1, m2);
+  s21::btree_map<int, int> m3 = {{-1, 0}, {0, 0}};
+  m1.merge(m3);
+  m2.insert({-1, 0});
+  ExpectSame(m1, m2);
+  ExpectSame(m3, std::map<int, int>{{0, 0}});
+
+  auto result = m3.insert_many(std::make_pair(5, 5), std::make_pair(0, 1));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(result[0].first->second, 5);
+  EXPECT_EQ(result[1].first->second, 0);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_concurrent_skiplist.h"
+
+TEST(ConcurrentSkipListSetTest, BasicOperations) {
+  s21::concurrent_skiplist_set<int> s1 = {5, 1, 9, 3, 7, 3};
+  std::set<int> s2 = {5, 1, 9, 3, 7, 3};
+  EXPECT_EQ(s1.size(), s2.size());
+  auto it2 = s2.begin();
+  for (auto it1 = s1.begin(); it1 != s1.end(); ++it1, ++it2) {
+    EXPECT_EQ(*it1, *it2);
+  }
+
+  auto res = s1.insert(4);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 4);
+  res = s1.insert(4);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first, 4);
+
+  EXPECT_TRUE(s1.contains(9));
+  EXPECT_FALSE(s1.contains(2));
+  EXPECT_EQ(s1.find(2), s1.end());
+  EXPECT_EQ(*s1.find(7), 7);
+
+  EXPECT_EQ(*s1.lower_bound(6), 7);
+  EXPECT_EQ(*s1.lower_bound(7), 7);
+  EXPECT_EQ(*s1.upper_bound(7), 9);
+  EXPECT_EQ(s1.lower_bound(10), s1.end());
+
+  EXPECT_EQ(s1.erase(5), 1);
+  EXPECT_EQ(s1.erase(5), 0);
+  s1.erase(s1.find(1));
+  std::string ss = "";
+  for (auto value : s1) {
+    ss += std::to_string(value) + ", ";
+  }
+  EXPECT_EQ(ss, "3, 4, 7, 9, ");
+  EXPECT_EQ(s1.size(), 4);
+
+  s1.clear();
+  EXPECT_TRUE(s1.empty());
+  EXPECT_EQ(s1.begin(), s1.end());
+  EXPECT_GT(s1.max_size(), 0);
+}
+
+TEST(ConcurrentSkipListSetTest, CopyMoveSwapMerge) {
+  s21::concurrent_skiplist_set<std::string> s1 = {"b", "a", "c"};
+  s21::concurrent_skiplist_set<std::string> s2(s1);
+  s21::concurrent_skiplist_set<std::string> s3(std::move(s1));
+  EXPECT_TRUE(s1.empty());
+  EXPECT_EQ(s2.size(), 3);
+  EXPECT_EQ(s3.size(), 3);
+  EXPECT_EQ(*s3.begin(), "a");
+
+  s21::concurrent_skiplist_set<std::string> s4 = {"c", "d"};
+  s3.merge(s4);
+  EXPECT_EQ(s3.size(), 4);
+  EXPECT_EQ(s4.size(), 1);
+  EXPECT_EQ(*s4.begin(), "c");
+
+  s4.swap(s3);
+  EXPECT_EQ(s4.size(), 4);
+  EXPECT_EQ(s3.size(), 1);
+
+  s3 = s2;
+  EXPECT_EQ(s3.size(), 3);
+  s2 = std::move(s4);
+  EXPECT_EQ(s2.size(), 4);
+
+  auto results = s2.insert_many("e", "a");
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+}
+
+TEST(ConcurrentSkipListMapTest, BasicOperations) {
+  s21::concurrent_skiplist_map<int, std::string> m1 = {
+      {3, "three"}, {1, "one"}, {2, "two"}};
+  EXPECT_EQ(m1.size(), 3);
+  EXPECT_EQ(m1.at(2), "two");
+  EXPECT_ANY_THROW(m1.at(5));
+
+  EXPECT_TRUE(m1.insert(5, "five").second);
+  EXPECT_FALSE(m1.insert({5, "other"}).second);
+  EXPECT_EQ(m1.find(5)->second, "five");
+  EXPECT_TRUE(m1.contains(1));
+  EXPECT_EQ(m1.lower_bound(4)->first, 5);
+  EXPECT_EQ(m1.upper_bound(1)->first, 2);
+
+  EXPECT_EQ(m1.erase(1), 1);
+  EXPECT_FALSE(m1.contains(1));
+
+  std::string ss = "";
+  for (auto &item : m1) {
+    ss += std::to_string(item.first) + "=" + item.second + ", ";
+  }
+  EXPECT_EQ(ss, "2=two, 3=three, 5=five, ");
+}
+
+TEST(ConcurrentSkipListMapTest, LookupWithoutDefaultConstructibleValue) {
+  // Поиск по ключу не создает значение, поэтому конструктор по умолчанию не
+  // нужен
+  struct NoDefault {
+    explicit NoDefault(int v) : value(v) {}
+    int value;
+  };
+  s21::concurrent_skiplist_map<int, NoDefault> m1;
+  for (int i = 0; i < 10; i += 2) m1.insert(i, NoDefault(i * 10));
+  EXPECT_EQ(m1.find(4)->second.value, 40);
+  EXPECT_EQ(m1.find(5), m1.end());
+  EXPECT_TRUE(m1.contains(8));
+  EXPECT_EQ(m1.lower_bound(5)->first, 6);
+  EXPECT_EQ(m1.upper_bound(6)->first, 8);
+  EXPECT_EQ(m1.at(2).value, 20);
+  EXPECT_EQ(m1.erase(2), 1U);
+  EXPECT_EQ(m1.erase(2), 0U);
+  EXPECT_EQ(m1.size(), 4U);
+}
+
+TEST(ConcurrentSkipListSetTest, ParallelInsertErase) {
+  const int kThreads = 8;
+  const int kPerThread = 2000;
+  s21::concurrent_skiplist_set<int> s1;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&s1, t]() {
+      for (int i = 0; i < kPerThread; ++i) {
+        s1.insert(i * kThreads + t);
+        // Ключи, которые вставляют все потоки сразу
+        s1.insert(-(i % 100) - 1);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(s1.size(), kThreads * kPerThread + 100);
+
+  int expected = -100;
+  for (auto value : s1) {
+    EXPECT_EQ(value, expected);
+    expected = expected == -1 ? 0 : expected + 1;
+  }
+
+  // Одни потоки удаляют нечетные ключи, другие ищут четные и обходят список
+  std::atomic<int> missing(0);
+  threads.clear();
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&s1, &missing, t]() {
+      for (int i = t; i < kThreads * kPerThread; i += kThreads) {
+        if (t % 2) {
+          EXPECT_EQ(s1.erase(i), 1);
+        } else if (!s1.contains(i)) {
+          ++missing;
+        }
+      }
+      int prev = -1000;
+      for (auto it = s1.lower_bound(0); it != s1.end(); ++it) {
+        EXPECT_LT(prev, *it);
+        prev = *it;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(missing.load(), 0);
+  EXPECT_EQ(s1.size(), kThreads * kPerThread / 2 + 100);
+}
+
+TEST(ConcurrentSkipListMapTest, ParallelMixedOperations) {
+  const int kThreads = 6;
+  const int kKeys = 256;
+  s21::concurrent_skiplist_map<int, std::string> m1;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m1, t]() {
+      for (int i = 0; i < 3000; ++i) {
+        int key = (i * 7 + t * 13) % kKeys;
+        switch (i % 3) {
+          case 0:
+            m1.insert(key, std::to_string(key));
+            break;
+          case 1:
+            m1.erase(key);
+            break;
+          default: {
+            auto it = m1.find(key);
+            if (it != m1.end()) {
+              EXPECT_EQ(it->second, std::to_string(key));
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  std::map<int, std::string> m2;
+  for (auto &item : m1) {
+    m2.insert(item);
+  }
+  EXPECT_EQ(m1.size(), m2.size());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stack>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_concurrent_stack.h"
+
+TEST(ConcurrentStackTest, PushPop) {
+  s21::concurrent_stack<std::string> s1;
+  std::stack<std::string> s2;
+  EXPECT_TRUE(s1.empty());
+
+  std::string value;
+  EXPECT_FALSE(s1.try_pop(value));
+  std::string c = "c";
+  s1.push("a");
+  s2.push("a");
+  s1.push(std::move(c));
+  s2.push("c");
+  s1.emplace(2, 'b');
+  s2.emplace(2, 'b');
+  EXPECT_FALSE(s1.empty());
+
+  while (s1.try_pop(value)) {
+    EXPECT_EQ(value, s2.top());
+    s2.pop();
+  }
+  EXPECT_TRUE(s2.empty());
+  EXPECT_TRUE(s1.empty());
+}
+
+TEST(ConcurrentStackTest, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> s1;
+    for (int i = 0; i < 100; ++i) s1.push(counter);
+    std::shared_ptr<int> value;
+    for (int i = 0; i < 60; ++i) s1.try_pop(value);
+    value.reset();
+    EXPECT_EQ(counter.use_count(), 41);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentStackTest, ConcurrentPushPop) {
+  // Узлы постоянно снимаются и удаляются, пока другие потоки читают
+  // вершину: под AddressSanitizer это проверяет безопасное освобождение
+  s21::concurrent_stack<int> s1;
+  const int threads = 4;
+  const int per_thread = 20000;
+  std::vector<std::atomic<int>> seen(threads * per_thread);
+  for (auto &flag : seen) flag.store(0);
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&s1, &seen, t] {
+      int value = 0;
+      for (int i = 0; i < per_thread; ++i) {
+        s1.push(t * per_thread + i);
+        if (i % 2 == 1) {
+          for (int k = 0; k < 2; ++k) {
+            if (s1.try_pop(value)) seen[value].fetch_add(1);
+          }
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  int value = 0;
+  while (s1.try_pop(value)) seen[value].fetch_add(1);
+
+  // Каждый элемент снят ровно один раз
+  int once = 0;
+  for (auto &flag : seen) once += flag.load() == 1;
+  EXPECT_EQ(once, threads * per_thread);
+}
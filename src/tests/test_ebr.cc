@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_ebr.h"
+
+namespace {
+// Объект, который помнит, что он жив: чтение удаленного объекта ловит
+// AddressSanitizer, а проверка magic_ - порчу памяти без санитайзера
+struct Tracked {
+  static constexpr int kAlive = 0x5A5A5A5A;
+
+  explicit Tracked(int value) : magic_(kAlive), value_(value) {
+    created.fetch_add(1);
+  }
+  ~Tracked() {
+    magic_ = 0;
+    destroyed.fetch_add(1);
+  }
+
+  int magic_;
+  int value_;
+
+  static std::atomic<int> created;
+  static std::atomic<int> destroyed;
+};
+
+std::atomic<int> Tracked::created(0);
+std::atomic<int> Tracked::destroyed(0);
+
+// Несколько проходов collect(): каждый продвигает эпоху не больше чем на 1
+void CollectAll() {
+  for (int i = 0; i < 4; ++i) s21::ebr::collect();
+}
+}  // namespace
+
+TEST(EbrTest, GuardDelaysDeletion) {
+  int destroyed = Tracked::destroyed.load();
+  auto *object = new Tracked(1);
+  {
+    s21::ebr::guard guard;
+    EXPECT_TRUE(s21::ebr::in_critical_section());
+    {
+      // Вложенная секция
+      s21::ebr::guard inner;
+    }
+    EXPECT_TRUE(s21::ebr::in_critical_section());
+    s21::ebr::retire(object);
+    EXPECT_GE(s21::ebr::pending(), 1U);
+    // Пока поток в критической секции, эпоха не уходит дальше на 2
+    CollectAll();
+    EXPECT_EQ(Tracked::destroyed.load(), destroyed);
+    EXPECT_EQ(object->magic_, Tracked::kAlive);
+  }
+  EXPECT_FALSE(s21::ebr::in_critical_section());
+  CollectAll();
+  EXPECT_EQ(Tracked::destroyed.load(), destroyed + 1);
+  EXPECT_EQ(s21::ebr::pending(), 0U);
+}
+
+TEST(EbrTest, CustomDeleterAndEpoch) {
+  static int deleted = 0;
+  int value = 0;
+  std::uint64_t epoch = s21::ebr::epoch();
+  s21::ebr::retire(&value, [](void *ptr) {
+    ++*static_cast<int *>(ptr);
+    ++deleted;
+  });
+  CollectAll();
+  EXPECT_GT(s21::ebr::epoch(), epoch);
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(deleted, 1);
+}
+
+TEST(EbrTest, ExitedThreadObjects) {
+  int destroyed = Tracked::destroyed.load();
+  std::thread worker([] {
+    s21::ebr::guard guard;
+    for (int i = 0; i < 10; ++i) s21::ebr::retire(new Tracked(i));
+  });
+  worker.join();
+  // Объекты завершившегося потока освобождает другой поток
+  CollectAll();
+  EXPECT_EQ(Tracked::destroyed.load(), destroyed + 10);
+}
+
+TEST(EbrTest, Stress) {
+  // Писатели заменяют общий объект и отдают старый в retire(), читатели в
+  // критической секции читают текущий. Читатель не должен увидеть
+  // удаленный объект.
+  int created = Tracked::created.load();
+  std::atomic<Tracked *> shared(new Tracked(0));
+  std::atomic<bool> stop(false);
+  std::atomic<int> broken(0);
+
+  std::vector<std::thread> threads;
+  for (int r = 0; r < 3; ++r) {
+    threads.emplace_back([&shared, &stop, &broken] {
+      while (!stop.load()) {
+        s21::ebr::guard guard;
+        Tracked *object = shared.load(std::memory_order_acquire);
+        for (int i = 0; i < 10; ++i) {
+          if (object->magic_ != Tracked::kAlive) broken.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (int w = 0; w < 2; ++w) {
+    threads.emplace_back([&shared] {
+      for (int i = 1; i <= 5000; ++i) {
+        s21::ebr::guard guard;
+        Tracked *old = shared.exchange(new Tracked(i));
+        s21::ebr::retire(old);
+      }
+    });
+  }
+  for (std::size_t i = 3; i < threads.size(); ++i) threads[i].join();
+  stop.store(true);
+  for (int r = 0; r < 3; ++r) threads[r].join();
+
+  delete shared.load();
+  CollectAll();
+  EXPECT_EQ(broken.load(), 0);
+  EXPECT_EQ(Tracked::created.load() - created, 10001);
+  EXPECT_EQ(Tracked::destroyed.load(), Tracked::created.load());
+}
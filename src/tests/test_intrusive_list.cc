@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../headers/s21_intrusive_list.h"
+
+namespace {
+struct Item {
+  explicit Item(int v = 0) : value(v) {}
+  bool operator<(const Item &other) const { return value < other.value; }
+  bool operator==(const Item &other) const { return value == other.value; }
+
+  int value;
+  s21::intrusive_list_hook hook;
+  s21::intrusive_list_hook second_hook;
+};
+
+using ItemList = s21::intrusive_list<Item, &Item::hook>;
+using SecondItemList = s21::intrusive_list<Item, &Item::second_hook>;
+
+std::string ToString(const ItemList &l) {
+  std::string ss = "";
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    ss += std::to_string(it->value) + ", ";
+  }
+  return ss;
+}
+}  // namespace
+
+TEST(IntrusiveListTest, PushPop) {
+  std::vector<Item> pool(5);
+  for (int i = 0; i < 5; ++i) pool[i].value = i;
+
+  ItemList l;
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.begin(), l.end());
+  EXPECT_ANY_THROW(l.front());
+  EXPECT_ANY_THROW(l.pop_back());
+
+  l.push_back(pool[1]);
+  l.push_back(pool[2]);
+  l.push_front(pool[0]);
+  EXPECT_EQ(ToString(l), "0, 1, 2, ");
+  EXPECT_EQ(l.size(), 3);
+  EXPECT_EQ(l.front().value, 0);
+  EXPECT_EQ(l.back().value, 2);
+  EXPECT_TRUE(pool[1].hook.is_linked());
+  EXPECT_FALSE(pool[4].hook.is_linked());
+
+  EXPECT_ANY_THROW(l.push_back(pool[1]));
+
+  l.pop_front();
+  l.pop_back();
+  EXPECT_EQ(ToString(l), "1, ");
+  EXPECT_FALSE(pool[0].hook.is_linked());
+  EXPECT_FALSE(pool[2].hook.is_linked());
+  l.clear();
+  EXPECT_FALSE(pool[1].hook.is_linked());
+}
+
+TEST(IntrusiveListTest, EraseByObject) {
+  std::vector<Item> pool(6);
+  ItemList l;
+  for (int i = 0; i < 6; ++i) {
+    pool[i].value = i;
+    l.push_back(pool[i]);
+  }
+  l.erase(pool[3]);
+  l.erase(pool[0]);
+  l.erase(pool[5]);
+  EXPECT_EQ(ToString(l), "1, 2, 4, ");
+  EXPECT_EQ(l.size(), 3);
+
+  auto it = l.iterator_to(pool[2]);
+  EXPECT_EQ(it->value, 2);
+  it = l.erase(it);
+  EXPECT_EQ(it->value, 4);
+  EXPECT_ANY_THROW(l.erase(l.end()));
+  // pool[3] уже исключен и ни в каком списке не состоит
+  EXPECT_ANY_THROW(l.erase(pool[3]));
+  EXPECT_EQ(l.size(), 2);
+}
+
+TEST(IntrusiveListTest, TwoHooksTwoLists) {
+  std::vector<Item> pool(4);
+  ItemList l1;
+  SecondItemList l2;
+  for (int i = 0; i < 4; ++i) {
+    pool[i].value = i;
+    l1.push_back(pool[i]);
+    l2.push_front(pool[i]);
+  }
+  std::string ss = "";
+  for (auto &item : l2) ss += std::to_string(item.value) + ", ";
+  EXPECT_EQ(ss, "3, 2, 1, 0, ");
+  EXPECT_EQ(ToString(l1), "0, 1, 2, 3, ");
+}
+
+TEST(IntrusiveListTest, Splice) {
+  std::vector<Item> pool(6);
+  ItemList l1, l2;
+  for (int i = 0; i < 6; ++i) {
+    pool[i].value = i;
+    (i < 3 ? l1 : l2).push_back(pool[i]);
+  }
+  l1.splice(++l1.begin(), l2);
+  EXPECT_EQ(ToString(l1), "0, 3, 4, 5, 1, 2, ");
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ(l1.size(), 6);
+
+  l2.splice(l2.end(), l1, l1.iterator_to(pool[4]));
+  EXPECT_EQ(ToString(l1), "0, 3, 5, 1, 2, ");
+  EXPECT_EQ(ToString(l2), "4, ");
+  EXPECT_EQ(l1.size(), 5);
+  EXPECT_EQ(l2.size(), 1);
+
+  Item unlinked(7);
+  EXPECT_ANY_THROW(l1.splice(l1.end(), l2, l2.iterator_to(unlinked)));
+  EXPECT_EQ(l1.size(), 5);
+  EXPECT_EQ(l2.size(), 1);
+}
+
+TEST(IntrusiveListTest, SortMergeReverseUnique) {
+  std::vector<Item> pool = {Item(5), Item(1), Item(4), Item(1), Item(3),
+                            Item(2), Item(9), Item(0)};
+  ItemList l1, l2;
+  for (std::size_t i = 0; i < pool.size(); ++i) {
+    (i < 5 ? l1 : l2).push_back(pool[i]);
+  }
+  l1.sort();
+  l2.sort();
+  EXPECT_EQ(ToString(l1), "1, 1, 3, 4, 5, ");
+  EXPECT_EQ(ToString(l2), "0, 2, 9, ");
+  // Сортировка устойчивая - первой идет единица с меньшим индексом в пуле
+  EXPECT_EQ(&l1.front(), &pool[1]);
+
+  l1.merge(l2);
+  EXPECT_EQ(ToString(l1), "0, 1, 1, 2, 3, 4, 5, 9, ");
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ(l1.size(), 8);
+
+  l1.unique();
+  EXPECT_EQ(ToString(l1), "0, 1, 2, 3, 4, 5, 9, ");
+  EXPECT_FALSE(pool[3].hook.is_linked());
+
+  l1.reverse();
+  EXPECT_EQ(ToString(l1), "9, 5, 4, 3, 2, 1, 0, ");
+  l1.sort([](const Item &a, const Item &b) { return a.value > b.value; });
+  EXPECT_EQ(ToString(l1), "9, 5, 4, 3, 2, 1, 0, ");
+
+  auto it = l1.end();
+  --it;
+  EXPECT_EQ(it->value, 0);
+}
+
+TEST(IntrusiveListTest, MoveAndSwap) {
+  std::vector<Item> pool(3);
+  ItemList l1;
+  for (int i = 0; i < 3; ++i) {
+    pool[i].value = i;
+    l1.push_back(pool[i]);
+  }
+  ItemList l2(std::move(l1));
+  EXPECT_TRUE(l1.empty());
+  EXPECT_EQ(ToString(l2), "0, 1, 2, ");
+
+  ItemList l3;
+  l3.swap(l2);
+  EXPECT_EQ(ToString(l3), "0, 1, 2, ");
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ(l2.begin(), l2.end());
+
+  l1 = std::move(l3);
+  EXPECT_EQ(ToString(l1), "0, 1, 2, ");
+
+  // Копия объекта не наследует связи оригинала
+  Item copy = pool[1];
+  EXPECT_FALSE(copy.hook.is_linked());
+
+  const ItemList &cl = l1;
+  EXPECT_EQ(cl.front().value, 0);
+  EXPECT_EQ(cl.back().value, 2);
+  EXPECT_EQ(cl.iterator_to(pool[1])->value, 1);
+}
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <list>
+#include <stdexcept>
 #include <string>
 
 #include "../headers/s21_list.h"
@@ -618,6 +619,19 @@ TEST(ListTest, UniqueList2) {
   EXPECT_ANY_THROW(*it);
 }
 
+TEST(ListTest, DereferenceEndThrows) {
+  s21::list<int> l_int_1 = {1, 2, 3};
+  const s21::list<int> &l_int_2 = l_int_1;
+  EXPECT_THROW(*l_int_1.end(), std::invalid_argument);
+  EXPECT_THROW(*l_int_2.end(), std::invalid_argument);
+  auto it = l_int_1.begin();
+  ++it;
+  ++it;
+  EXPECT_EQ(*it, 3);
+  ++it;
+  EXPECT_THROW(*it, std::invalid_argument);
+}
+
 TEST(ListTest, UniqueList3) {
   s21::list<int> l_int_1 = {1, 2, 3, 2, 6};
 
@@ -642,4 +656,124 @@ TEST(ListTest, UniqueList4) {
     ss += std::to_string(*it) + ", ";
   }
   EXPECT_EQ(ss, str1);
-}
\ No newline at end of file
+}
+namespace {
+// Тип, который считает свои копирования и перемещения.
+struct Tracked {
+  static int copies;
+  static int moves;
+  Tracked() : a(0), b(0) {}
+  Tracked(int x, int y) : a(x), b(y) {}
+  Tracked(const Tracked &other) : a(other.a), b(other.b) { ++copies; }
+  Tracked(Tracked &&other) noexcept : a(other.a), b(other.b) { ++moves; }
+  Tracked &operator=(const Tracked &other) {
+    a = other.a;
+    b = other.b;
+    ++copies;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) noexcept {
+    a = other.a;
+    b = other.b;
+    ++moves;
+    return *this;
+  }
+  int a;
+  int b;
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+}  // namespace
+
+TEST(ListTest, MovePushAndInsert) {
+  s21::list<Tracked> l;
+  Tracked::copies = 0;
+  Tracked::moves = 0;
+
+  Tracked t1(1, 1), t2(2, 2), t3(3, 3);
+  l.push_back(std::move(t1));
+  l.push_front(std::move(t2));
+  l.insert(l.begin(), std::move(t3));
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 3);
+
+  Tracked t4(4, 4);
+  l.push_back(t4);
+  EXPECT_EQ(Tracked::copies, 1);
+
+  std::string ss = "";
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    ss += std::to_string((*it).a) + ", ";
+  }
+  EXPECT_EQ(ss, "3, 2, 1, 4, ");
+}
+
+TEST(ListTest, EmplaceList) {
+  s21::list<Tracked> l;
+  Tracked::copies = 0;
+  Tracked::moves = 0;
+
+  Tracked &back = l.emplace_back(1, 10);
+  EXPECT_EQ(back.a, 1);
+  EXPECT_EQ(back.b, 10);
+  Tracked &front = l.emplace_front(0, 20);
+  EXPECT_EQ(front.a, 0);
+  auto it = l.emplace(++l.begin(), 5, 50);
+  EXPECT_EQ((*it).a, 5);
+  EXPECT_EQ((*it).b, 50);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 0);
+
+  std::string ss = "";
+  for (auto i = l.begin(); i != l.end(); ++i) {
+    ss += std::to_string((*i).a) + ", ";
+  }
+  EXPECT_EQ(ss, "0, 5, 1, ");
+}
+
+TEST(ListTest, InsertManyForwards) {
+  s21::list<Tracked> l;
+  Tracked::copies = 0;
+  Tracked::moves = 0;
+
+  l.insert_many_back(Tracked(1, 1), Tracked(2, 2));
+  l.insert_many_front(Tracked(0, 0));
+  l.insert_many(l.end(), Tracked(3, 3));
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 4);
+
+  std::string ss = "";
+  for (auto i = l.begin(); i != l.end(); ++i) {
+    ss += std::to_string((*i).a) + ", ";
+  }
+  EXPECT_EQ(ss, "0, 1, 2, 3, ");
+}
+
+TEST(ListTest, NonArithmeticType) {
+  s21::list<std::string> l1(2);
+  EXPECT_EQ(l1.size(), 2);
+  EXPECT_EQ(l1.front(), "");
+
+  l1.push_back("c");
+  l1.push_front("a");
+  l1.insert(++l1.begin(), std::string(40, 'b'));
+  l1.erase(--l1.end());
+  std::list<std::string> l2 = {"a", std::string(40, 'b'), "", ""};
+  EXPECT_EQ(l1.size(), l2.size());
+  auto it2 = l2.begin();
+  for (auto it1 = l1.begin(); it1 != l1.end(); ++it1, ++it2) {
+    EXPECT_EQ(*it1, *it2);
+  }
+
+  s21::list<std::string> l3 = {"x", "y"};
+  l1.swap(l3);
+  EXPECT_EQ(l1.back(), "y");
+  EXPECT_EQ(l3.size(), 4);
+  l3.splice(l3.begin(), l1);
+  EXPECT_TRUE(l1.empty());
+  EXPECT_EQ(l3.front(), "x");
+  EXPECT_EQ(l3.size(), 6);
+  l3.reverse();
+  EXPECT_EQ(l3.front(), "");
+  EXPECT_EQ(l3.back(), "x");
+}
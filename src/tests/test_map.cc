@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../headers/s21_map.h"
 
@@ -413,4 +417,169 @@ TEST(map_test, insert_many3) {
   s21::map<int, int> m1;
   m1.insert_many(std::make_pair(1, 1));
   EXPECT_EQ(m1.contains(1), true);
-}
\ No newline at end of file
+}
+TEST(map_test, range_constr) {
+  std::vector<std::pair<int, int>> items = {
+      {3, 30}, {1, 10}, {3, 31}, {2, 20}, {1, 11}};
+  s21::map<int, int> m1(items.begin(), items.end());
+  std::map<int, int> m2(items.begin(), items.end());
+  EXPECT_EQ(m1.size(), m2.size());
+  // Из элементов с одинаковым ключом остается первый
+  auto it1 = m1.begin();
+  for (auto it2 = m2.begin(); it2 != m2.end(); it1++, it2++) {
+    EXPECT_EQ((*it1).first, (*it2).first);
+    EXPECT_EQ((*it1).second, (*it2).second);
+  }
+  m1.assign(m2.begin(), m2.end());
+  EXPECT_EQ(m1.at(3), 30);
+}
+
+TEST(map_test, emplace_hint) {
+  s21::map<int, std::string> m1;
+  auto it = m1.end();
+  for (int i = 0; i < 50; ++i) it = m1.emplace_hint(it, i, "v");
+  it = m1.emplace_hint(m1.begin(), 25, "other");
+  EXPECT_EQ((*it).second, "v");
+  m1.emplace_hint(++m1.begin(), 1000, std::string(3, 'x'));
+  EXPECT_EQ(m1.size(), 51U);
+  EXPECT_EQ(m1.at(1000), "xxx");
+  int expected = 0;
+  for (auto item : m1) {
+    if (expected == 50) expected = 1000;
+    EXPECT_EQ(item.first, expected++);
+  }
+}
+
+TEST(map_test, try_emplace) {
+  s21::map<int, std::string> m1;
+  auto result = m1.try_emplace(2, 3, 'a');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).second, "aaa");
+  // Если ключ уже есть, аргументы не забираются
+  std::string value = "moved";
+  result = m1.try_emplace(2, std::move(value));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, "aaa");
+  EXPECT_EQ(value, "moved");
+  m1.try_emplace(1);
+  m1.try_emplace(3, value);
+  EXPECT_EQ(m1.size(), 3U);
+  EXPECT_EQ(m1.at(1), "");
+  EXPECT_EQ(m1.at(3), "moved");
+}
+
+TEST(map_test, operator_brackets_and_insert_or_assign) {
+  s21::map<std::string, int> m1;
+  std::map<std::string, int> m2;
+  const char *words[] = {"b", "a", "c", "a", "b", "a"};
+  for (const char *word : words) {
+    ++m1[word];
+    ++m2[word];
+  }
+  EXPECT_FALSE(m1.insert_or_assign("c", 10).second);
+  EXPECT_TRUE(m1.insert_or_assign("d", 20).second);
+  m2.insert_or_assign("c", 10);
+  m2.insert_or_assign("d", 20);
+  EXPECT_EQ(m1.size(), m2.size());
+  auto it1 = m1.begin();
+  for (auto it2 = m2.begin(); it2 != m2.end(); it1++, it2++) {
+    EXPECT_EQ((*it1).first, (*it2).first);
+    EXPECT_EQ((*it1).second, (*it2).second);
+  }
+}
+
+namespace {
+// Значение, считающее свои создания по умолчанию
+struct CountedValue {
+  CountedValue() { ++defaults; }
+  explicit CountedValue(int v) : value(v) {}
+
+  static int defaults;
+  int value = 0;
+};
+int CountedValue::defaults = 0;
+}  // namespace
+
+TEST(map_test, key_lookup) {
+  s21::map<int, CountedValue> m1;
+  for (int i = 0; i < 10; i += 2) m1.try_emplace(i, i * 10);
+  CountedValue::defaults = 0;
+  EXPECT_EQ(m1.at(4).value, 40);
+  EXPECT_TRUE(m1.contains(6));
+  EXPECT_EQ(m1.count(5), 0U);
+  EXPECT_EQ((*m1.find(8)).first, 8);
+  EXPECT_EQ(m1.find(9), m1.end());
+  EXPECT_EQ((*m1.lower_bound(3)).first, 4);
+  EXPECT_EQ((*m1.lower_bound(4)).first, 4);
+  EXPECT_EQ((*m1.upper_bound(4)).first, 6);
+  EXPECT_EQ(m1.upper_bound(8), m1.end());
+  auto range = m1.equal_range(2);
+  EXPECT_EQ((*range.first).first, 2);
+  EXPECT_EQ((*range.second).first, 4);
+  range = m1.equal_range(3);
+  EXPECT_EQ(range.first, range.second);
+  // Поиск не создает значения
+  EXPECT_EQ(CountedValue::defaults, 0);
+}
+
+TEST(map_test, transparent_lookup) {
+  s21::map<std::string, int, std::less<>> m1 = {
+      {"one", 1}, {"two", 2}, {"three", 3}};
+  std::string_view key = "two";
+  EXPECT_EQ((*m1.find(key)).second, 2);
+  EXPECT_TRUE(m1.contains(std::string_view("three")));
+  EXPECT_EQ(m1.count(std::string_view("four")), 0U);
+  EXPECT_EQ((*m1.lower_bound(std::string_view("p"))).first, "three");
+  EXPECT_EQ(m1.upper_bound(std::string_view("two")), m1.end());
+  auto range = m1.equal_range(std::string_view("one"));
+  EXPECT_EQ((*range.first).second, 1);
+  const auto &m2 = m1;
+  EXPECT_EQ((*m2.find("one")).second, 1);
+}
+
+TEST(map_test, order_statistics) {
+  s21::map<int, int, std::less<int>, true> m1;
+  for (int i = 0; i < 100; ++i) m1[i * 2] = i;
+  for (int i = 0; i < 100; i += 4) m1.erase(m1.find(i * 2));
+  EXPECT_EQ(m1.size(), 75U);
+  EXPECT_EQ((*m1.select(0)).first, 2);
+  EXPECT_EQ((*m1.select(3)).first, 10);
+  EXPECT_EQ(m1.rank(7), 3U);
+  EXPECT_EQ(m1.rank(6), 2U);
+  EXPECT_EQ(m1.distance(m1.find(2), m1.find(198)), 74);
+  EXPECT_EQ(m1.select(75), m1.end());
+}
+
+TEST(map_test, set_algebra) {
+  s21::map<int, std::string> m1 = {{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::map<int, std::string> m2 = {{2, "x"}, {3, "y"}, {4, "z"}};
+  s21::map<int, std::string> m3(m1);
+  m1.intersect(m2);
+  ASSERT_EQ(m1.size(), 2U);
+  EXPECT_EQ(m1.at(2), "b");
+  EXPECT_EQ(m1.at(3), "c");
+  m3.subtract(m2);
+  ASSERT_EQ(m3.size(), 1U);
+  EXPECT_EQ(m3.at(1), "a");
+  m3.merge(m2);
+  EXPECT_EQ(m3.size(), 4U);
+  EXPECT_EQ(m3.at(4), "z");
+  EXPECT_TRUE(m2.empty());
+}
+
+TEST(map_test, range_erase) {
+  s21::map<int, std::string> m1;
+  for (int i = 0; i < 10; ++i) m1.insert(i, std::string(1, 'a' + i));
+  m1.erase(m1.find(2), m1.find(4));
+  EXPECT_EQ(m1.erase_range(6, 100), 4U);
+  m1.for_each_in_range(3, 6, [](std::pair<const int, std::string> &item) {
+    item.second += "!";
+  });
+  std::vector<std::string> values;
+  const auto &const_map = m1;
+  const_map.for_each_in_range(
+      0, 10, [&values](const std::pair<const int, std::string> &item) {
+        values.push_back(item.second);
+      });
+  EXPECT_EQ(values, (std::vector<std::string>{"a", "b", "e!", "f!"}));
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_mpmc_queue.h"
+
+TEST(MpmcQueueTest, TryPushTryPop) {
+  s21::mpmc_queue<std::string> q1(4);
+  EXPECT_EQ(q1.capacity(), 4);
+  EXPECT_TRUE(q1.empty());
+
+  std::string value;
+  EXPECT_FALSE(q1.try_pop(value));
+  EXPECT_TRUE(q1.try_push("a"));
+  EXPECT_TRUE(q1.try_push(std::string("b")));
+  EXPECT_TRUE(q1.try_emplace(2, 'c'));
+  EXPECT_TRUE(q1.try_push("d"));
+  std::string e = "e";
+  EXPECT_FALSE(q1.try_push(std::move(e)));
+  // Неудачная вставка не забирает значение
+  EXPECT_EQ(e, "e");
+  EXPECT_EQ(q1.size_approx(), 4);
+
+  std::string result;
+  for (int round = 0; round < 3; ++round) {
+    EXPECT_TRUE(q1.try_pop(value));
+    result += value + ", ";
+    EXPECT_TRUE(q1.try_push(value));
+  }
+  EXPECT_EQ(result, "a, b, cc, ");
+  result.clear();
+  while (q1.try_pop(value)) result += value + ", ";
+  EXPECT_EQ(result, "d, a, b, cc, ");
+
+  EXPECT_ANY_THROW(s21::mpmc_queue<int> q2(0));
+  EXPECT_ANY_THROW(s21::mpmc_queue<int> q3(1));
+  EXPECT_ANY_THROW(s21::mpmc_queue<int> q4(6));
+}
+
+namespace {
+struct Thrower {
+  explicit Thrower(int value) : value_(value) {
+    if (value < 0) throw std::runtime_error("negative");
+  }
+  int value_;
+};
+}  // namespace
+
+TEST(MpmcQueueTest, ThrowingConstructor) {
+  s21::mpmc_queue<Thrower> q1(4);
+  EXPECT_TRUE(q1.try_emplace(1));
+  EXPECT_THROW(q1.try_emplace(-1), std::runtime_error);
+  EXPECT_TRUE(q1.try_emplace(2));
+
+  // Ячейка, в которой конструктор выбросил исключение, пропускается
+  Thrower value(0);
+  EXPECT_TRUE(q1.try_pop(value));
+  EXPECT_EQ(value.value_, 1);
+  EXPECT_TRUE(q1.try_pop(value));
+  EXPECT_EQ(value.value_, 2);
+  EXPECT_FALSE(q1.try_pop(value));
+}
+
+TEST(MpmcQueueTest, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> q1(4);
+    for (int i = 0; i < 3; ++i) q1.try_push(counter);
+    std::shared_ptr<int> value;
+    q1.try_pop(value);
+    value.reset();
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueueTest, ProducersConsumers) {
+  s21::mpmc_queue<int> q1(16);
+  const int producers = 3;
+  const int consumers = 3;
+  const int per_producer = 20000;
+  std::vector<std::atomic<int>> seen(producers * per_producer);
+  for (auto &flag : seen) flag.store(0);
+  std::atomic<int> taken(0);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&q1, p] {
+      for (int i = 0; i < per_producer; ++i) {
+        while (!q1.try_push(p * per_producer + i)) std::this_thread::yield();
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&q1, &seen, &taken] {
+      int value = 0;
+      while (taken.load() < producers * per_producer) {
+        if (q1.try_pop(value)) {
+          seen[value].fetch_add(1);
+          taken.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  // Каждый элемент извлечен ровно один раз
+  int once = 0;
+  for (auto &flag : seen) once += flag.load() == 1;
+  EXPECT_EQ(once, producers * per_producer);
+  EXPECT_TRUE(q1.empty());
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <iterator>
+#include <random>
 #include <set>
+#include <vector>
 
 #include "../headers/s21_multiset.h"
 
@@ -518,3 +522,85 @@ TEST(multiset_test, insert_many3) {
   --iter;
   EXPECT_EQ(*iter, 4);
 }
+
+TEST(multiset_test, range_constr) {
+  std::vector<int> items(init1);
+  s21::multiset<int> ms1(items.begin(), items.end());
+  std::multiset<int> ms2(items.begin(), items.end());
+  EXPECT_EQ(ms1.size(), ms2.size());
+  auto it1 = ms1.begin();
+  for (auto it2 = ms2.begin(); it2 != ms2.end(); it1++, it2++)
+    EXPECT_EQ(*it1, *it2);
+  ms1.assign(ms2.begin(), ms2.end());
+  EXPECT_EQ(ms1.count(6), 4U);
+}
+
+TEST(multiset_test, insert_hint) {
+  s21::multiset<int> ms1 = {1, 2, 2, 3};
+  std::multiset<int> ms2 = {1, 2, 2, 3};
+  auto hint = ms1.find(3);
+  for (int i = 0; i < 3; ++i) {
+    hint = ms1.insert(hint, 2);
+    ms2.insert(2);
+  }
+  ms1.emplace_hint(ms1.end(), 3);
+  ms1.insert(ms1.begin(), 5);
+  ms2.insert({3, 5});
+  EXPECT_EQ(ms1.count(2), 5U);
+  auto it1 = ms1.begin();
+  for (auto it2 = ms2.begin(); it2 != ms2.end(); it1++, it2++)
+    EXPECT_EQ(*it1, *it2);
+}
+
+TEST(multiset_test, order_statistics) {
+  s21::multiset<int, std::less<int>, true> ms1;
+  std::multiset<int> ms2;
+  std::mt19937 gen(7);
+  // Вставки и удаления вперемешку, чтобы задеть все случаи балансировки
+  for (int i = 0; i < 2000; ++i) {
+    int key = static_cast<int>(gen() % 100);
+    if (gen() % 3 == 0 && ms1.contains(key)) {
+      ms1.erase(ms1.find(key));
+      ms2.erase(ms2.find(key));
+    } else {
+      ms1.insert(key);
+      ms2.insert(key);
+    }
+  }
+  ASSERT_EQ(ms1.size(), ms2.size());
+  auto it2 = ms2.begin();
+  for (std::size_t i = 0; i < ms2.size(); ++i, ++it2) {
+    EXPECT_EQ(*ms1.select(i), *it2);
+  }
+  EXPECT_EQ(ms1.select(ms1.size()), ms1.end());
+  for (int key = -1; key <= 100; ++key) {
+    EXPECT_EQ(ms1.count(key), ms2.count(key));
+    auto rank = std::distance(ms2.begin(), ms2.lower_bound(key));
+    EXPECT_EQ(ms1.rank(key), static_cast<std::size_t>(rank));
+    auto range = ms1.equal_range(key);
+    EXPECT_EQ(ms1.distance(range.first, range.second),
+              static_cast<std::ptrdiff_t>(ms2.count(key)));
+  }
+  EXPECT_EQ(ms1.distance(ms1.begin(), ms1.end()),
+            static_cast<std::ptrdiff_t>(ms1.size()));
+  // Копия и дерево, построенное из диапазона, тоже хранят размеры
+  const s21::multiset<int, std::less<int>, true> ms3(ms1);
+  s21::multiset<int, std::less<int>, true> ms4(ms2.begin(), ms2.end());
+  EXPECT_EQ(*ms3.select(ms3.size() / 2), *ms4.select(ms4.size() / 2));
+  EXPECT_EQ(ms3.count(50), ms4.count(50));
+}
+
+TEST(multiset_test, range_erase) {
+  s21::multiset<int> s1(init1);
+  std::multiset<int> s2(init1);
+  // Разрез внутри серии шестерок
+  s1.erase(std::next(s1.find(6)), std::next(s1.find(9)));
+  s2.erase(std::next(s2.find(6)), std::next(s2.find(9)));
+  EXPECT_EQ(std::vector<int>(s1.begin(), s1.end()),
+            std::vector<int>(s2.begin(), s2.end()));
+  EXPECT_EQ(s1.erase_range(1, 3), 4U);
+  std::vector<int> visited;
+  s1.for_each_in_range(3, 6,
+                       [&visited](const int &key) { visited.push_back(key); });
+  EXPECT_EQ(visited, (std::vector<int>{3, 3, 4, 4, 5}));
+}
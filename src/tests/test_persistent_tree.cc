@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_persistent_tree.h"
+
+namespace {
+template <typename Container, typename Reference>
+void ExpectSame(const Container &actual, const Reference &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  auto it = actual.begin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  EXPECT_EQ(it, actual.end());
+}
+
+// Считает копирования, чтобы проверить, сколько узлов копирует запись
+struct Counted {
+  Counted(int v) : value(v) {}
+  Counted(const Counted &other) : value(other.value) { ++Copies(); }
+  bool operator<(const Counted &other) const { return value < other.value; }
+  bool operator==(const Counted &other) const { return value == other.value; }
+
+  int value;
+  static int &Copies() {
+    static int copies = 0;
+    return copies;
+  }
+};
+}  // namespace
+
+TEST(PersistentSetTest, BasicOperations) {
+  s21::persistent_set<int> s1 = {5, 1, 9, 3, 7, 3};
+  ExpectSame(s1, std::set<int>{1, 3, 5, 7, 9});
+
+  auto res = s1.insert(4);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, 4);
+  res = s1.insert(4);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*std::next(res.first), 5);
+
+  EXPECT_TRUE(s1.contains(9));
+  EXPECT_FALSE(s1.contains(2));
+  EXPECT_EQ(s1.find(2), s1.end());
+  EXPECT_EQ(s1.count(7), 1U);
+  EXPECT_EQ(*s1.lower_bound(6), 7);
+  EXPECT_EQ(*s1.upper_bound(7), 9);
+  EXPECT_EQ(s1.lower_bound(10), s1.end());
+  EXPECT_EQ(*std::prev(s1.end()), 9);
+
+  EXPECT_EQ(s1.erase(5), 1U);
+  EXPECT_EQ(s1.erase(5), 0U);
+  ExpectSame(s1, std::set<int>{1, 3, 4, 7, 9});
+  s1.clear();
+  EXPECT_TRUE(s1.empty());
+  EXPECT_EQ(s1.begin(), s1.end());
+}
+
+TEST(PersistentSetTest, SnapshotsMatchStd) {
+  using Tree = s21::persistent_set<int>::tree_type;
+  s21::persistent_set<int> s1;
+  std::set<int> s2;
+  std::vector<s21::persistent_set<int>> snapshots;
+  std::vector<std::set<int>> expected;
+  std::mt19937 gen(11);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 3000);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(s1.erase(key), s2.erase(key));
+    } else {
+      EXPECT_EQ(s1.insert(key).second, s2.insert(key).second);
+    }
+    if (i % 1000 == 0) {
+      snapshots.push_back(s1.snapshot());
+      expected.push_back(s2);
+    }
+  }
+  ExpectSame(s1, s2);
+  // Снимки не изменились, и все версии остались корректными деревьями
+  for (std::size_t i = 0; i < snapshots.size(); ++i) {
+    ExpectSame(snapshots[i], expected[i]);
+  }
+  Tree tree;
+  for (int key : s2) tree.Emplace(key);
+  EXPECT_TRUE(tree.CheckTree());
+  Tree copy(tree);
+  std::set<int> reference = s2;
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(gen() % 3000);
+    if (gen() % 2 == 0) {
+      copy.EraseKey(key);
+      reference.erase(key);
+    } else {
+      copy.Emplace(key);
+      reference.insert(key);
+    }
+  }
+  EXPECT_TRUE(tree.CheckTree());
+  EXPECT_TRUE(copy.CheckTree());
+  ExpectSame(std::vector<int>(tree.Begin(), tree.End()), s2);
+  ExpectSame(std::vector<int>(copy.Begin(), copy.End()), reference);
+}
+
+TEST(PersistentSetTest, IterateBothWays) {
+  std::vector<int> items;
+  for (int i = 0; i < 1000; ++i) items.push_back(i * 3);
+  s21::persistent_set<int> s1(items.begin(), items.end());
+  auto it = s1.end();
+  for (auto rit = items.rbegin(); rit != items.rend(); ++rit) {
+    --it;
+    EXPECT_EQ(*it, *rit);
+  }
+  EXPECT_EQ(it, s1.begin());
+  it = s1.find(300);
+  EXPECT_EQ(*it++, 300);
+  EXPECT_EQ(*it--, 303);
+  EXPECT_EQ(*--it, 297);
+}
+
+TEST(PersistentSetTest, WriteAfterSnapshotCopiesPath) {
+  s21::persistent_set<Counted> s1;
+  for (int i = 0; i < 4096; ++i) s1.insert(Counted(i * 2));
+  // Без снимков узлы меняются на месте: копируется только сам вставляемый
+  // элемент
+  Counted::Copies() = 0;
+  s1.insert(Counted(1));
+  s1.erase(Counted(100));
+  EXPECT_EQ(Counted::Copies(), 1);
+
+  s21::persistent_set<Counted> snapshot = s1.snapshot();
+  Counted::Copies() = 0;
+  s1.insert(Counted(3001));
+  // Путь от корня и несколько соседей, а не 4096 узлов
+  EXPECT_LE(Counted::Copies(), 40);
+  Counted::Copies() = 0;
+  s1.erase(Counted(2000));
+  EXPECT_LE(Counted::Copies(), 80);
+  EXPECT_TRUE(snapshot.contains(Counted(2000)));
+  EXPECT_FALSE(snapshot.contains(Counted(3001)));
+  EXPECT_EQ(snapshot.size(), 4096U);
+  EXPECT_EQ(s1.size(), 4096U);
+}
+
+TEST(PersistentMapTest, BasicOperations) {
+  s21::persistent_map<int, std::string> m1 = {{3, "c"}, {1, "a"}, {2, "b"}};
+  EXPECT_EQ(m1.at(2), "b");
+  EXPECT_THROW(m1.at(4), std::out_of_range);
+  EXPECT_TRUE(m1.insert(4, "d").second);
+  EXPECT_FALSE(m1.insert(1, "z").second);
+  EXPECT_EQ(m1.at(1), "a");
+
+  auto snapshot = m1.snapshot();
+  EXPECT_FALSE(m1.insert_or_assign(1, "z").second);
+  EXPECT_TRUE(m1.insert_or_assign(5, "e").second);
+  EXPECT_TRUE(m1.try_emplace(6, 3, 'f').second);
+  EXPECT_EQ(m1.find(6)->second, "fff");
+  EXPECT_EQ(m1.erase(2), 1U);
+  ExpectSame(m1, std::map<int, std::string>{
+                     {1, "z"}, {3, "c"}, {4, "d"}, {5, "e"}, {6, "fff"}});
+  ExpectSame(snapshot, std::map<int, std::string>{
+                           {1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}});
+  EXPECT_EQ(m1.lower_bound(2)->first, 3);
+  EXPECT_EQ(m1.upper_bound(6), m1.end());
+}
+
+TEST(PersistentMapTest, ReadersKeepSnapshotsWhileWriterChanges) {
+  s21::persistent_map<int, int> map;
+  for (int i = 0; i < 2000; ++i) map.insert(i, i);
+  std::vector<s21::persistent_map<int, int>> snapshots;
+  for (int round = 0; round < 4; ++round) {
+    snapshots.push_back(map.snapshot());
+    for (int i = 0; i < 2000; ++i) map.insert_or_assign(i, i + round + 1);
+  }
+
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> readers;
+  for (int round = 0; round < 4; ++round) {
+    readers.emplace_back([&failed, round, &snapshots] {
+      for (int pass = 0; pass < 20; ++pass) {
+        // Копия снимка в потоке читателя тоже разделяет узлы
+        s21::persistent_map<int, int> own = snapshots[round];
+        int expected = 0;
+        for (const auto &item : own) {
+          if (item.first != expected || item.second != expected + round) {
+            failed = true;
+          }
+          ++expected;
+        }
+        if (expected != 2000) failed = true;
+      }
+    });
+  }
+  std::mt19937 gen(5);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 4000);
+    if (gen() % 2 == 0) {
+      map.erase(key);
+    } else {
+      map.insert_or_assign(key, -key);
+    }
+  }
+  for (std::thread &reader : readers) reader.join();
+  EXPECT_FALSE(failed);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../headers/s21_priority_queue.h"
+
+namespace {
+template <typename Queue>
+std::string PopAll(Queue &pq) {
+  std::string ss = "";
+  while (!pq.empty()) {
+    ss += std::to_string(pq.top()) + ", ";
+    pq.pop();
+  }
+  return ss;
+}
+}  // namespace
+
+TEST(PriorityQueueTest, BasicOperations) {
+  s21::priority_queue<int> pq1 = {5, 1, 8, 3, 9, 2};
+  EXPECT_EQ(pq1.size(), 6);
+  EXPECT_EQ(pq1.top(), 9);
+  pq1.push(7);
+  pq1.emplace(10);
+  pq1.insert_many(0, 4);
+  EXPECT_EQ(pq1.top(), 10);
+  EXPECT_EQ(PopAll(pq1), "10, 9, 8, 7, 5, 4, 3, 2, 1, 0, ");
+  EXPECT_ANY_THROW(pq1.pop());
+  EXPECT_THROW(pq1.top(), std::out_of_range);
+
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> pq2(
+      std::greater<int>(), s21::vector<int>{4, 2, 6});
+  EXPECT_EQ(PopAll(pq2), "2, 4, 6, ");
+}
+
+TEST(PriorityQueueTest, CompareWithStd) {
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 2> pq1;
+  s21::priority_queue<int, std::deque<int>, std::less<int>, 5> pq2;
+  s21::priority_queue<int> pq3;
+  std::priority_queue<int> pq4;
+  unsigned state = 12345;
+  for (int i = 0; i < 2000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value = static_cast<int>((state >> 8) % 1000);
+    if (i % 3 == 2) {
+      ASSERT_EQ(pq1.top(), pq4.top());
+      ASSERT_EQ(pq2.top(), pq4.top());
+      ASSERT_EQ(pq3.top(), pq4.top());
+      pq1.pop();
+      pq2.pop();
+      pq3.pop();
+      pq4.pop();
+    } else {
+      pq1.push(value);
+      pq2.push(value);
+      pq3.push(value);
+      pq4.push(value);
+    }
+  }
+  EXPECT_EQ(pq3.size(), pq4.size());
+  while (!pq4.empty()) {
+    ASSERT_EQ(pq3.top(), pq4.top());
+    pq3.pop();
+    pq4.pop();
+  }
+}
+
+TEST(PriorityQueueTest, CopyMoveSwap) {
+  s21::priority_queue<std::string> pq1 = {"b", "c", "a"};
+  s21::priority_queue<std::string> pq2(pq1);
+  s21::priority_queue<std::string> pq3(std::move(pq1));
+  EXPECT_EQ(pq2.top(), "c");
+  EXPECT_EQ(pq3.size(), 3);
+
+  s21::priority_queue<std::string> pq4;
+  pq4.push(std::string("z"));
+  pq4.swap(pq3);
+  EXPECT_EQ(pq4.size(), 3);
+  EXPECT_EQ(pq3.top(), "z");
+  pq3 = pq2;
+  EXPECT_EQ(pq3.size(), 3);
+}
+
+TEST(IndexedPriorityQueueTest, HandlesAndDecreaseKey) {
+  s21::indexed_priority_queue<int, std::greater<int>> pq1;
+  auto h10 = pq1.push(10);
+  auto h20 = pq1.push(20);
+  auto h30 = pq1.push(30);
+  auto h40 = pq1.push(40);
+  EXPECT_EQ(pq1.top(), 10);
+  EXPECT_EQ(pq1.top_handle(), h10);
+
+  pq1.decrease_key(h30, 5);
+  EXPECT_EQ(pq1.top(), 5);
+  EXPECT_EQ(pq1.top_handle(), h30);
+  EXPECT_ANY_THROW(pq1.decrease_key(h40, 50));
+
+  pq1.update(h30, 35);
+  EXPECT_EQ(pq1.top_handle(), h10);
+  EXPECT_EQ(pq1.value(h30), 35);
+
+  pq1.erase(h10);
+  EXPECT_FALSE(pq1.contains(h10));
+  EXPECT_ANY_THROW(pq1.erase(h10));
+  EXPECT_EQ(pq1.top_handle(), h20);
+  EXPECT_EQ(pq1.size(), 3);
+
+  // Освободившийся дескриптор используется повторно
+  auto h1 = pq1.push(1);
+  EXPECT_EQ(h1, h10);
+  EXPECT_EQ(pq1.top(), 1);
+
+  std::string ss = "";
+  while (!pq1.empty()) {
+    ss += std::to_string(pq1.top()) + ", ";
+    pq1.pop();
+  }
+  EXPECT_EQ(ss, "1, 20, 35, 40, ");
+  EXPECT_ANY_THROW(pq1.top());
+  EXPECT_ANY_THROW(pq1.pop());
+}
+
+TEST(IndexedPriorityQueueTest, Dijkstra) {
+  // Граф: ребра (from, to, weight)
+  const int n = 6;
+  std::vector<std::vector<std::pair<int, int>>> graph(n);
+  int edges[][3] = {{0, 1, 7}, {0, 2, 9},  {0, 5, 14}, {1, 2, 10},
+                    {1, 3, 15}, {2, 3, 11}, {2, 5, 2},  {3, 4, 6},
+                    {4, 5, 9}};
+  for (auto &e : edges) {
+    graph[e[0]].push_back({e[1], e[2]});
+    graph[e[1]].push_back({e[0], e[2]});
+  }
+
+  const int kInf = 1 << 30;
+  std::vector<int> dist(n, kInf);
+  std::vector<std::size_t> handle(n);
+  std::vector<int> vertex_of(n);
+  s21::indexed_priority_queue<std::pair<int, int>,
+                              std::greater<std::pair<int, int>>>
+      pq1;
+  dist[0] = 0;
+  for (int v = 0; v < n; ++v) {
+    handle[v] = pq1.push({dist[v], v});
+  }
+  while (!pq1.empty()) {
+    int u = pq1.top().second;
+    pq1.pop();
+    for (auto &edge : graph[u]) {
+      int v = edge.first;
+      if (dist[u] + edge.second < dist[v]) {
+        dist[v] = dist[u] + edge.second;
+        pq1.decrease_key(handle[v], {dist[v], v});
+      }
+    }
+  }
+  EXPECT_EQ(dist, std::vector<int>({0, 7, 9, 20, 20, 11}));
+}
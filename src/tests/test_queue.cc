@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <deque>
 #include <iostream>
 #include <string>
 
@@ -178,4 +179,42 @@ TEST(TestQueue, InsertManyBackQueue2) {
   }
 
   EXPECT_ANY_THROW(qu1.pop());
-}
\ No newline at end of file
+}
+
+TEST(TestQueue, DequeContainer) {
+  s21::queue<int, std::deque<int>> qu1 = {1, 2};
+  qu1.push(3);
+  qu1.emplace(4);
+  qu1.insert_many_back(5, 6);
+  s21::queue<int, std::deque<int>> qu2;
+  qu2 = qu1;
+
+  std::string ss = "";
+  while (!qu1.empty()) {
+    ss += std::to_string(qu1.front()) + ", ";
+    qu1.pop();
+  }
+  EXPECT_EQ(ss, "1, 2, 3, 4, 5, 6, ");
+  EXPECT_EQ(qu2.size(), 6);
+  EXPECT_EQ(qu2.back(), 6);
+
+  qu1 = std::move(qu2);
+  EXPECT_EQ(qu1.front(), 1);
+  EXPECT_EQ(qu1.size(), 6);
+}
+
+TEST(TestQueue, MovePushEmplace) {
+  s21::queue<std::string> qu1;
+  std::string value(64, 'a');
+  qu1.push(std::move(value));
+  std::string &ref = qu1.emplace(3, 'b');
+  EXPECT_EQ(ref, "bbb");
+  EXPECT_EQ(qu1.front(), std::string(64, 'a'));
+  EXPECT_EQ(qu1.back(), "bbb");
+
+  s21::queue<std::string> qu2(qu1);
+  s21::queue<std::string> qu3(std::move(qu1));
+  EXPECT_EQ(qu2.size(), 2);
+  EXPECT_EQ(qu3.size(), 2);
+  EXPECT_TRUE(qu1.empty());
+}
@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "../headers/s21_tree.h"
+#include "../headers/s21_ws_scheduler.h"
 
 TEST(RedBlackTreeTest, Insert_Size) {
   s21::RedBlackTree<int> tree;
@@ -303,3 +310,354 @@ TEST(RedBlackTreeTest, RandomInsertAndFind) {
     EXPECT_EQ(*it, i);
   }
 }
+
+namespace {
+// Ключ, считающий свои копии и умеющий выбросить исключение на заданной
+struct CountedKey {
+  CountedKey(int v = 0) : value(v) {}
+  CountedKey(const CountedKey &other) : value(other.value) {
+    if (++copies == throw_on) throw std::runtime_error("copy");
+  }
+  CountedKey &operator=(const CountedKey &) = default;
+  bool operator<(const CountedKey &other) const { return value < other.value; }
+
+  static int copies;
+  static int throw_on;
+  int value;
+};
+int CountedKey::copies = 0;
+int CountedKey::throw_on = -1;
+}  // namespace
+
+TEST(RedBlackTreeTest, InsertUniqueDuplicateCreatesNoNode) {
+  s21::RedBlackTree<CountedKey> tree;
+  tree.InsertUnique(CountedKey(1));
+  CountedKey::copies = 0;
+  auto result = tree.InsertUnique(CountedKey(1));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).value, 1);
+  // Ключ не копировался в новый узел
+  EXPECT_EQ(CountedKey::copies, 0);
+  EXPECT_EQ(tree.Size(), 1);
+}
+
+TEST(RedBlackTreeTest, ErasedNodeIsReused) {
+  s21::RedBlackTree<int> tree;
+  for (int i = 0; i < 100; ++i) {
+    tree.Insert(i);
+  }
+  const int *erased = &*tree.Find(42);
+  tree.Erase(tree.Find(42));
+  EXPECT_EQ(&*tree.Insert(1000), erased);
+}
+
+TEST(RedBlackTreeTest, MergeBackAndForthKeepsNodesAlive) {
+  s21::RedBlackTree<std::string> tree1;
+  {
+    s21::RedBlackTree<std::string> tree2;
+    for (int i = 0; i < 100; ++i) {
+      tree1.Insert(std::to_string(i) + " first tree, long enough for heap");
+      tree2.Insert(std::to_string(i) + " second tree, long enough for heap");
+    }
+    tree1.Merge(tree2);
+    tree2.Merge(tree1);
+    tree1.Merge(tree2);
+    // Дерево, чьи блоки хранят половину узлов tree1, уничтожается
+  }
+  EXPECT_EQ(tree1.Size(), 200);
+  std::string result;
+  for (auto it = tree1.Begin(); it != tree1.End(); ++it) {
+    result += (*it)[0];
+  }
+  EXPECT_EQ(result.size(), 200);
+  tree1.Erase(tree1.Begin());
+  tree1.Clear();
+  tree1.Insert("reused");
+  EXPECT_EQ(*tree1.Begin(), "reused");
+}
+
+TEST(RedBlackTreeTest, CopyThrowKeepsTarget) {
+  s21::RedBlackTree<CountedKey> source;
+  s21::RedBlackTree<CountedKey> target;
+  for (int i = 0; i < 50; ++i) {
+    source.Insert(CountedKey(i));
+  }
+  target.Insert(CountedKey(-1));
+  CountedKey::copies = 0;
+  CountedKey::throw_on = 25;
+  EXPECT_THROW(target = source, std::runtime_error);
+  CountedKey::throw_on = -1;
+  EXPECT_EQ(target.Size(), 1);
+  EXPECT_EQ((*target.Begin()).value, -1);
+  target = source;
+  EXPECT_EQ(target.Size(), 50);
+}
+
+TEST(RedBlackTreeTest, CopyThrowAtEveryNodeFreesPartialCopy) {
+  s21::RedBlackTree<CountedKey> source;
+  for (int i = 0; i < 20; ++i) {
+    source.Insert(CountedKey(i));
+  }
+  // Исключение на каждом узле: частичная копия в любой точке обхода должна
+  // удаляться целиком (утечки ловит AddressSanitizer)
+  for (int throw_on = 1; throw_on <= 20; ++throw_on) {
+    s21::RedBlackTree<CountedKey> target;
+    CountedKey::copies = 0;
+    CountedKey::throw_on = throw_on;
+    EXPECT_THROW(target = source, std::runtime_error);
+    EXPECT_EQ(target.Size(), 0);
+  }
+  CountedKey::throw_on = -1;
+}
+
+TEST(RedBlackTreeTest, CopyKeepsShapeAndClearOfSharedPool) {
+  s21::RedBlackTree<std::string> source;
+  s21::RedBlackTree<std::string> other;
+  for (int i = 0; i < 10000; ++i) {
+    source.Insert(std::to_string(i) + " long enough for the heap");
+    other.Insert(std::to_string(-i) + " long enough for the heap");
+  }
+  s21::RedBlackTree<std::string> copy(source);
+  EXPECT_TRUE(copy.CheckTree());
+  EXPECT_EQ(copy.Size(), source.Size());
+  auto it = copy.Begin();
+  for (auto src = source.Begin(); src != source.End(); ++src, ++it) {
+    EXPECT_EQ(*it, *src);
+  }
+  // После merge блоки пула общие, и Clear() удаляет узлы по одному
+  copy.Merge(other);
+  copy.Clear();
+  EXPECT_EQ(copy.Size(), 0);
+  copy.Insert("reused");
+  EXPECT_EQ(*copy.Begin(), "reused");
+}
+
+namespace {
+template <typename Tree>
+void ExpectTreeEq(const Tree &tree, const std::set<int> &expected) {
+  EXPECT_TRUE(tree.CheckTree());
+  ASSERT_EQ(tree.Size(), expected.size());
+  auto it = tree.Begin();
+  for (int item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+}
+
+template <typename Tree>
+Tree MakeRandomTree(std::mt19937 &gen, int size, int range,
+                    std::set<int> &expected) {
+  Tree tree;
+  for (int i = 0; i < size; ++i) {
+    int key = static_cast<int>(gen() % range);
+    tree.InsertUnique(key);
+    expected.insert(key);
+  }
+  return tree;
+}
+
+// Сравнивает MergeUnique(), Intersect() и Subtract() с std::set на парах
+// деревьев разных размеров (merge идет и через split/join, и вставкой)
+template <typename Tree, typename Run>
+void CheckSetAlgebra(int rounds, int max_size, Run run) {
+  std::mt19937 gen(17);
+  for (int round = 0; round < rounds; ++round) {
+    int range = 1 + static_cast<int>(gen() % (2 * max_size));
+    std::set<int> a;
+    std::set<int> b;
+    Tree tree_a = MakeRandomTree<Tree>(gen, gen() % max_size, range, a);
+    Tree tree_b = MakeRandomTree<Tree>(gen, gen() % max_size, range, b);
+    std::set<int> united = a;
+    std::set<int> duplicates;
+    std::set<int> common;
+    std::set<int> difference;
+    for (int item : b) {
+      if (!united.insert(item).second) duplicates.insert(item);
+    }
+    for (int item : a) {
+      (b.count(item) != 0 ? common : difference).insert(item);
+    }
+
+    Tree intersected(tree_a);
+    Tree subtracted(tree_a);
+    run([&] { intersected.Intersect(tree_b); },
+        [&](auto &scheduler) { intersected.Intersect(tree_b, scheduler); });
+    run([&] { subtracted.Subtract(tree_b); },
+        [&](auto &scheduler) { subtracted.Subtract(tree_b, scheduler); });
+    run([&] { tree_a.MergeUnique(tree_b); },
+        [&](auto &scheduler) { tree_a.MergeUnique(tree_b, scheduler); });
+    ExpectTreeEq(intersected, common);
+    ExpectTreeEq(subtracted, difference);
+    ExpectTreeEq(tree_a, united);
+    ExpectTreeEq(tree_b, duplicates);
+  }
+}
+}  // namespace
+
+TEST(RedBlackTreeTest, SetAlgebraMatchesStd) {
+  auto sequential = [](auto plain, auto) { plain(); };
+  CheckSetAlgebra<s21::RedBlackTree<int>>(300, 300, sequential);
+  CheckSetAlgebra<s21::RedBlackTree<int>>(10, 20000, sequential);
+}
+
+TEST(RedBlackTreeTest, SetAlgebraKeepsSubtreeSizes) {
+  using Tree = s21::RedBlackTree<int, std::less<int>, true>;
+  CheckSetAlgebra<Tree>(100, 500, [](auto plain, auto) { plain(); });
+  std::set<int> expected;
+  std::mt19937 gen(5);
+  Tree tree = MakeRandomTree<Tree>(gen, 3000, 5000, expected);
+  std::set<int> other_expected;
+  Tree other = MakeRandomTree<Tree>(gen, 3000, 5000, other_expected);
+  tree.MergeUnique(other);
+  expected.insert(other_expected.begin(), other_expected.end());
+  std::size_t index = 0;
+  for (int item : expected) {
+    EXPECT_EQ(*tree.Select(index), item);
+    EXPECT_EQ(tree.Rank(item), index);
+    ++index;
+  }
+}
+
+TEST(RedBlackTreeTest, SetAlgebraParallel) {
+  // Деревья достаточно большие, чтобы половины рекурсии уходили в задачи
+  s21::ws_scheduler scheduler(4);
+  CheckSetAlgebra<s21::RedBlackTree<int>>(
+      4, 60000, [&scheduler](auto, auto parallel) { parallel(scheduler); });
+}
+
+TEST(RedBlackTreeTest, MergeKeepsOrderOfEquivalentKeys) {
+  struct Tagged {
+    bool operator<(const Tagged &other) const { return key < other.key; }
+    int key;
+    int tag;
+  };
+  std::mt19937 gen(3);
+  for (int round = 0; round < 20; ++round) {
+    s21::RedBlackTree<Tagged> tree;
+    s21::RedBlackTree<Tagged> other;
+    std::multiset<Tagged> expected;
+    int size = 1 + static_cast<int>(gen() % 3000);
+    for (int i = 0; i < size; ++i) {
+      Tagged item{static_cast<int>(gen() % 50), i};
+      tree.Insert(item);
+      expected.insert(item);
+    }
+    for (int i = 0; i < size; ++i) {
+      Tagged item{static_cast<int>(gen() % 50), size + i};
+      other.Insert(item);
+      expected.insert(item);
+    }
+    tree.Merge(other);
+    EXPECT_TRUE(tree.CheckTree());
+    EXPECT_TRUE(other.Empty());
+    ASSERT_EQ(tree.Size(), expected.size());
+    auto it = tree.Begin();
+    for (const Tagged &item : expected) {
+      EXPECT_EQ((*it).key, item.key);
+      EXPECT_EQ((*it).tag, item.tag);
+      ++it;
+    }
+  }
+}
+
+namespace {
+struct Tagged {
+  bool operator<(const Tagged &other) const { return key < other.key; }
+  int key;
+  int tag;
+};
+
+// Срезы EraseRange() по случайным позициям (в том числе внутри серий
+// эквивалентных ключей) и по ключам в сравнении с std::multiset
+template <bool OrderStatistics>
+void CheckRangeErase(int rounds, int max_size) {
+  using Tree = s21::RedBlackTree<Tagged, std::less<Tagged>, OrderStatistics>;
+  std::mt19937 gen(23);
+  for (int round = 0; round < rounds; ++round) {
+    Tree tree;
+    std::multiset<Tagged> expected;
+    int size = static_cast<int>(gen() % max_size);
+    int range = 1 + static_cast<int>(gen() % (max_size / 4 + 1));
+    for (int i = 0; i < size; ++i) {
+      Tagged item{static_cast<int>(gen() % range), i};
+      tree.Insert(item);
+      expected.insert(item);
+    }
+    int from = size == 0 ? 0 : static_cast<int>(gen() % (size + 1));
+    int to = from + static_cast<int>(gen() % (size - from + 1));
+    auto first = std::next(tree.Begin(), from);
+    auto last = std::next(tree.Begin(), to);
+    EXPECT_EQ(tree.EraseRange(first, last),
+              static_cast<std::size_t>(to - from));
+    expected.erase(std::next(expected.begin(), from),
+                   std::next(expected.begin(), to));
+    if (last != tree.End()) {
+      EXPECT_EQ((*last).tag, (*std::next(expected.begin(), from)).tag);
+    }
+
+    Tagged lo{static_cast<int>(gen() % range), 0};
+    Tagged hi{static_cast<int>(gen() % range), 0};
+    std::size_t erased = 0;
+    if (lo < hi) {
+      auto low = expected.lower_bound(lo);
+      auto high = expected.lower_bound(hi);
+      erased = static_cast<std::size_t>(std::distance(low, high));
+      expected.erase(low, high);
+    }
+    EXPECT_EQ(tree.EraseKeyRange(lo, hi), erased);
+
+    EXPECT_TRUE(tree.CheckTree());
+    ASSERT_EQ(tree.Size(), expected.size());
+    std::size_t index = 0;
+    auto it = tree.Begin();
+    for (const Tagged &item : expected) {
+      EXPECT_EQ((*it).tag, item.tag);
+      if constexpr (OrderStatistics) {
+        EXPECT_EQ((*tree.Select(index)).tag, item.tag);
+      }
+      ++it;
+      ++index;
+    }
+  }
+}
+}  // namespace
+
+TEST(RedBlackTreeTest, EraseRangeMatchesStd) {
+  CheckRangeErase<false>(300, 400);
+  CheckRangeErase<false>(10, 20000);
+}
+
+TEST(RedBlackTreeTest, EraseRangeKeepsSubtreeSizes) {
+  CheckRangeErase<true>(200, 400);
+}
+
+TEST(RedBlackTreeTest, ForEachInRangeMatchesStd) {
+  std::mt19937 gen(29);
+  for (int round = 0; round < 200; ++round) {
+    s21::RedBlackTree<int> tree;
+    std::multiset<int> expected;
+    int size = static_cast<int>(gen() % 500);
+    for (int i = 0; i < size; ++i) {
+      int key = static_cast<int>(gen() % 200);
+      tree.Insert(key);
+      expected.insert(key);
+    }
+    int lo = static_cast<int>(gen() % 220) - 10;
+    int hi = static_cast<int>(gen() % 220) - 10;
+    std::vector<int> visited;
+    const auto &const_tree = tree;
+    const_tree.ForEachInRange(
+        lo, hi, [&visited](const int &key) { visited.push_back(key); });
+    std::vector<int> in_range;
+    if (lo < hi) {
+      in_range.assign(expected.lower_bound(lo), expected.lower_bound(hi));
+    }
+    EXPECT_EQ(visited, in_range);
+  }
+  s21::RedBlackTree<int> tree;
+  for (int i = 0; i < 10; ++i) tree.Insert(i);
+  // Неконстантное дерево отдает ссылки на сами элементы
+  tree.ForEachInRange(3, 5, [&tree](int &key) {
+    EXPECT_EQ(&key, &*tree.Find(key));
+  });
+}
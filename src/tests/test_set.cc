@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../headers/s21_set.h"
 
@@ -381,4 +385,135 @@ TEST(set_test, insert_many3) {
   EXPECT_FALSE(res3[0].second);
   EXPECT_FALSE(res3[1].second);
   EXPECT_FALSE(res3[2].second);
-}
\ No newline at end of file
+}
+TEST(set_test, range_constr) {
+  std::vector<int> items = {5, 1, 9, 1, 3, 7, 5, 2, 8, 6, 4, 10};
+  s21::set<int> s1(items.begin(), items.end());
+  std::set<int> s2(items.begin(), items.end());
+  EXPECT_EQ(s1.size(), s2.size());
+  auto it1 = s1.begin();
+  for (auto it2 = s2.begin(); it2 != s2.end(); it1++, it2++)
+    EXPECT_EQ(*it1, *it2);
+  // Дерево, построенное сразу, остается корректным при вставке и удалении
+  s1.insert(0);
+  s1.erase(s1.find(5));
+  EXPECT_EQ(*s1.begin(), 0);
+  EXPECT_FALSE(s1.contains(5));
+}
+
+TEST(set_test, assign_own_range) {
+  s21::set<int> s1 = {1, 2, 3, 4, 5};
+  auto first = s1.find(2);
+  auto last = s1.find(5);
+  s1.assign(first, last);
+  EXPECT_EQ(s1.size(), 3U);
+  EXPECT_EQ(*s1.begin(), 2);
+  s1.assign(first, first);
+  EXPECT_TRUE(s1.empty());
+}
+
+TEST(set_test, insert_hint) {
+  s21::set<int> s1;
+  std::set<int> s2;
+  // Подсказка - результат предыдущей вставки, end() и неверная подсказка
+  auto it = s1.end();
+  for (int i = 0; i < 100; i += 2) it = s1.insert(it, i);
+  s1.insert(s1.end(), 1000);
+  s1.insert(s1.find(10), 11);
+  s1.insert(s1.find(10), 9);
+  EXPECT_EQ(*s1.insert(s1.begin(), 50), 50);
+  for (int i = 0; i < 100; i += 2) s2.insert(i);
+  s2.insert({1000, 11, 9});
+  EXPECT_EQ(s1.size(), s2.size());
+  auto it1 = s1.begin();
+  for (auto it2 = s2.begin(); it2 != s2.end(); it1++, it2++)
+    EXPECT_EQ(*it1, *it2);
+}
+
+TEST(set_test, transparent_find) {
+  s21::set<std::string, std::less<>> s1 = {"alpha", "beta", "gamma"};
+  std::string_view key = "beta";
+  EXPECT_EQ(*s1.find(key), "beta");
+  EXPECT_TRUE(s1.contains(std::string_view("gamma")));
+  EXPECT_EQ(s1.find(std::string_view("delta")), s1.end());
+  const auto &s2 = s1;
+  EXPECT_EQ(*s2.find("alpha"), "alpha");
+}
+
+TEST(set_test, custom_compare) {
+  s21::set<int, std::greater<int>> s1 = {1, 3, 2};
+  std::string result;
+  for (int item : s1) result += std::to_string(item) + ", ";
+  EXPECT_EQ(result, "3, 2, 1, ");
+}
+
+TEST(set_test, order_statistics) {
+  s21::set<int, std::less<int>, true> s1;
+  std::set<int> s2;
+  for (int i = 0; i < 300; ++i) {
+    int key = (i * 37) % 211;
+    s1.insert(key);
+    s2.insert(key);
+  }
+  for (int i = 0; i < 211; i += 3) {
+    if (s1.contains(i)) s1.erase(s1.find(i));
+    s2.erase(i);
+  }
+  ASSERT_EQ(s1.size(), s2.size());
+  std::size_t index = 0;
+  for (int item : s2) {
+    EXPECT_EQ(*s1.select(index), item);
+    EXPECT_EQ(s1.rank(item), index);
+    EXPECT_EQ(s1.distance(s1.begin(), s1.find(item)),
+              static_cast<std::ptrdiff_t>(index));
+    ++index;
+  }
+  EXPECT_EQ(s1.rank(1000), s1.size());
+  EXPECT_EQ(s1.count(1), 1U);
+  EXPECT_EQ(s1.count(3), 0U);
+  // Без OrderStatistics distance() считает перебором
+  s21::set<int> s3 = {1, 2, 3, 4};
+  EXPECT_EQ(s3.distance(s3.find(2), s3.end()), 3);
+}
+
+TEST(set_test, set_algebra) {
+  s21::set<int> s1 = {1, 2, 3, 4, 5, 6};
+  s21::set<int> s2 = {4, 5, 6, 7, 8};
+  s21::set<int> united = s21::set_union(s1, s2);
+  s21::set<int> common = s21::set_intersection(s1, s2);
+  s21::set<int> difference = s21::set_difference(s1, s2);
+  EXPECT_EQ(std::vector<int>(united.begin(), united.end()),
+            (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+  EXPECT_EQ(std::vector<int>(common.begin(), common.end()),
+            (std::vector<int>{4, 5, 6}));
+  EXPECT_EQ(std::vector<int>(difference.begin(), difference.end()),
+            (std::vector<int>{1, 2, 3}));
+  // Аргументы функций не меняются
+  EXPECT_EQ(s1.size(), 6U);
+  EXPECT_EQ(s2.size(), 5U);
+
+  auto it = s1.find(5);
+  s1.intersect(s2);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(s1.size(), 3U);
+  s1.subtract(s2);
+  EXPECT_TRUE(s1.empty());
+  s2.subtract(s2);
+  EXPECT_TRUE(s2.empty());
+}
+
+TEST(set_test, range_erase) {
+  s21::set<int> s1;
+  for (int i = 0; i < 20; ++i) s1.insert(i);
+  auto last = s1.find(8);
+  s1.erase(s1.find(3), last);
+  EXPECT_EQ(*last, 8);
+  EXPECT_EQ(s1.erase_range(10, 15), 5U);
+  EXPECT_EQ(s1.erase_range(15, 10), 0U);
+  std::vector<int> visited;
+  s1.for_each_in_range(1, 17,
+                       [&visited](const int &key) { visited.push_back(key); });
+  EXPECT_EQ(visited, (std::vector<int>{1, 2, 8, 9, 15, 16}));
+  s1.erase(s1.begin(), s1.end());
+  EXPECT_TRUE(s1.empty());
+}
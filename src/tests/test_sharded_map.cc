@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_sharded_map.h"
+#include "../headers/s21_ws_scheduler.h"
+
+TEST(ShardedMapTest, BasicOperations) {
+  s21::sharded_map<int, std::string, 4> m1 = {{1, "a"}, {2, "b"}, {3, "c"}};
+  EXPECT_EQ(m1.size(), 3U);
+  std::string value;
+  EXPECT_TRUE(m1.find(2, value));
+  EXPECT_EQ(value, "b");
+  EXPECT_FALSE(m1.find(4, value));
+  EXPECT_EQ(value, "b");
+  EXPECT_EQ(m1.at(3), "c");
+  EXPECT_THROW(m1.at(4), std::out_of_range);
+
+  EXPECT_TRUE(m1.insert(4, "d"));
+  EXPECT_FALSE(m1.insert(4, "x"));
+  EXPECT_EQ(m1.at(4), "d");
+  EXPECT_FALSE(m1.insert_or_assign(4, "x"));
+  EXPECT_EQ(m1.at(4), "x");
+  EXPECT_TRUE(m1.insert_or_assign(5, "e"));
+  EXPECT_TRUE(m1.contains(5));
+  EXPECT_EQ(m1.count(6), 0U);
+
+  EXPECT_EQ(m1.erase(1), 1U);
+  EXPECT_EQ(m1.erase(1), 0U);
+  EXPECT_EQ(m1.size(), 4U);
+  m1.clear();
+  EXPECT_TRUE(m1.empty());
+}
+
+TEST(ShardedMapTest, ShardVisitorsAndOrderedIteration) {
+  s21::sharded_map<int, int, 8> m1;
+  std::map<int, int> m2;
+  std::mt19937 gen(9);
+  for (int i = 0; i < 5000; ++i) {
+    // Ключи с общим шагом все равно расходятся по сегментам
+    int key = static_cast<int>(gen() % 2000) * 8;
+    m1.insert_or_assign(key, i);
+    m2[key] = i;
+  }
+
+  std::vector<std::pair<int, int>> ordered;
+  m1.for_each_ordered([&ordered](const std::pair<const int, int> &item) {
+    ordered.emplace_back(item.first, item.second);
+  });
+  std::vector<std::pair<int, int>> expected_order(m2.begin(), m2.end());
+  EXPECT_EQ(ordered, expected_order);
+
+  std::size_t total = 0;
+  std::size_t used_shards = 0;
+  m1.for_each_shard([&](const auto &shard) {
+    total += shard.size();
+    used_shards += !shard.empty();
+  });
+  EXPECT_EQ(total, m2.size());
+  EXPECT_EQ(used_shards, m1.kShards);
+
+  s21::ws_scheduler scheduler(4);
+  std::atomic<long long> sum{0};
+  m1.for_each_shard(
+      [&sum](const auto &shard) {
+        for (const auto &item : shard) sum += item.second;
+      },
+      scheduler);
+  long long expected = 0;
+  for (const auto &item : m2) expected += item.second;
+  EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(ShardedMapTest, ParallelMixedOperations) {
+  const int kThreads = 6;
+  const int kKeysPerThread = 500;
+  s21::sharded_map<int, int> m1;
+  std::atomic<bool> wrong_value{false};
+
+  // Каждый поток пишет в свой диапазон ключей и читает чужие
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m1, &wrong_value, t]() {
+      for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < kKeysPerThread; ++i) {
+          int key = t * kKeysPerThread + i;
+          m1.insert_or_assign(key, key * 2);
+          if (i % 3 == 0) m1.erase(key);
+          int other = (key + kKeysPerThread) % (kThreads * kKeysPerThread);
+          int value = 0;
+          if (m1.find(other, value) && value != other * 2) wrong_value = true;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  EXPECT_FALSE(wrong_value);
+  // Остаются ключи с i % 3 != 0
+  int kept = kKeysPerThread - (kKeysPerThread + 2) / 3;
+  EXPECT_EQ(m1.size(), static_cast<std::size_t>(kThreads * kept));
+  int previous = -1;
+  m1.for_each_ordered([&previous](const std::pair<const int, int> &item) {
+    EXPECT_GT(item.first, previous);
+    EXPECT_NE(item.first % kKeysPerThread % 3, 0);
+    previous = item.first;
+  });
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_spsc_queue.h"
+
+TEST(SpscQueueTest, TryPushTryPop) {
+  s21::spsc_queue<int> q1(3);
+  EXPECT_EQ(q1.capacity(), 3);
+  EXPECT_TRUE(q1.empty());
+
+  int value = 0;
+  EXPECT_FALSE(q1.try_pop(value));
+  EXPECT_TRUE(q1.try_push(1));
+  EXPECT_TRUE(q1.try_push(2));
+  EXPECT_TRUE(q1.try_emplace(3));
+  // Емкость соблюдается точно, хотя буфер округлен до 4
+  EXPECT_FALSE(q1.try_push(4));
+  EXPECT_EQ(q1.size_approx(), 3);
+
+  EXPECT_TRUE(q1.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(q1.try_push(4));
+  std::string result;
+  while (q1.try_pop(value)) result += std::to_string(value) + ", ";
+  EXPECT_EQ(result, "2, 3, 4, ");
+
+  EXPECT_ANY_THROW(s21::spsc_queue<int> q2(0));
+}
+
+TEST(SpscQueueTest, Bulk) {
+  s21::spsc_queue<std::string> q1(5);
+  std::vector<std::string> in = {"a", "b", "c", "d", "e", "f", "g"};
+  EXPECT_EQ(q1.try_push_bulk(in.begin(), in.size()), 5);
+  EXPECT_EQ(q1.try_push_bulk(in.begin(), in.size()), 0);
+
+  std::vector<std::string> out(3);
+  EXPECT_EQ(q1.try_pop_bulk(out.begin(), out.size()), 3);
+  EXPECT_EQ(out, std::vector<std::string>({"a", "b", "c"}));
+  EXPECT_EQ(q1.try_push_bulk(in.begin() + 5, 2), 2);
+
+  std::vector<std::string> rest;
+  EXPECT_EQ(q1.try_pop_bulk(std::back_inserter(rest), 10), 4);
+  EXPECT_EQ(rest, std::vector<std::string>({"d", "e", "f", "g"}));
+  EXPECT_TRUE(q1.empty());
+}
+
+TEST(SpscQueueTest, DestroysRemaining) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> q1(4);
+    q1.try_push(counter);
+    q1.try_push(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+    std::shared_ptr<int> value;
+    q1.try_pop(value);
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueueTest, ProducerConsumer) {
+  // Маленькая емкость, чтобы индексы много раз обошли буфер
+  s21::spsc_queue<int> q1(7);
+  const int items = 100000;
+
+  std::thread producer([&q1] {
+    int next = 0;
+    int batch[5];
+    while (next < items) {
+      if (next % 3 == 0) {
+        int count = 0;
+        while (count < 5 && next + count < items) {
+          batch[count] = next + count;
+          ++count;
+        }
+        next += static_cast<int>(q1.try_push_bulk(batch, count));
+      } else if (q1.try_push(next)) {
+        ++next;
+      }
+      if (next < items && q1.size_approx() == q1.capacity()) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  // Элементы приходят по порядку, без потерь и повторов
+  int expected = 0;
+  bool ordered = true;
+  int batch[4];
+  while (expected < items) {
+    std::size_t count = q1.try_pop_bulk(batch, 4);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (batch[i] != expected++) ordered = false;
+    }
+    if (count == 0U) std::this_thread::yield();
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q1.empty());
+}
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <deque>
 #include <iostream>
 #include <string>
 
 #include "../headers/s21_stack.h"
+#include "../headers/s21_vector.h"
 
 TEST(TestStack, BasicStackOperations_1) {
   s21::stack<int> st1;
@@ -179,4 +181,89 @@ TEST(TestStack, InsertManyFrontStack2) {
   }
 
   EXPECT_ANY_THROW(st1.pop());
-}
\ No newline at end of file
+}
+
+namespace {
+// Тип, который считает свои копирования
+struct Counted {
+  static int copies;
+  Counted(int v = 0) : value(v) {}
+  Counted(const Counted &other) : value(other.value) { ++copies; }
+  Counted(Counted &&other) noexcept : value(other.value) {}
+  Counted &operator=(const Counted &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  Counted &operator=(Counted &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  int value;
+};
+int Counted::copies = 0;
+
+template <typename Stack>
+std::string PopAll(Stack &st) {
+  std::string ss = "";
+  while (!st.empty()) {
+    ss += std::to_string(st.top()) + ", ";
+    st.pop();
+  }
+  return ss;
+}
+}  // namespace
+
+TEST(TestStack, OtherContainers) {
+  s21::stack<int, s21::vector<int>> st1 = {1, 2, 3};
+  st1.push(4);
+  st1.emplace(5);
+  st1.insert_many_front(6, 7);
+  EXPECT_EQ(st1.size(), 7);
+  s21::stack<int, s21::vector<int>> st2(st1);
+  EXPECT_EQ(PopAll(st1), "7, 6, 5, 4, 3, 2, 1, ");
+  EXPECT_ANY_THROW(st1.pop());
+
+  s21::stack<int, std::deque<int>> st3 = {1, 2};
+  s21::stack<int, std::deque<int>> st4;
+  st4 = st3;
+  st3.push(3);
+  EXPECT_EQ(PopAll(st3), "3, 2, 1, ");
+  EXPECT_EQ(PopAll(st4), "2, 1, ");
+
+  st1 = std::move(st2);
+  EXPECT_EQ(st1.top(), 7);
+  EXPECT_EQ(st1.size(), 7);
+}
+
+TEST(TestStack, MovePushEmplace) {
+  s21::stack<std::string> st1;
+  std::string value(64, 'a');
+  st1.push(std::move(value));
+  EXPECT_EQ(st1.top(), std::string(64, 'a'));
+  std::string &ref = st1.emplace(3, 'b');
+  EXPECT_EQ(ref, "bbb");
+  EXPECT_EQ(st1.top(), "bbb");
+  EXPECT_EQ(st1.size(), 2);
+}
+
+TEST(TestStack, CopyIsSingleCopy) {
+  s21::stack<Counted> st1;
+  for (int i = 0; i < 100; ++i) {
+    st1.emplace(i);
+  }
+  Counted::copies = 0;
+  s21::stack<Counted> st2(st1);
+  EXPECT_EQ(Counted::copies, 100);
+
+  Counted::copies = 0;
+  s21::stack<Counted> st3;
+  st3 = st1;
+  EXPECT_EQ(Counted::copies, 100);
+
+  Counted::copies = 0;
+  s21::stack<Counted> st4(std::move(st3));
+  st2 = std::move(st4);
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(st2.top().value, 99);
+}
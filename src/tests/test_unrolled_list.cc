@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+
+#include "../headers/s21_unrolled_list.h"
+
+template <typename T, std::size_t B>
+std::string ToString(const s21::unrolled_list<T, B> &l) {
+  std::string ss = "";
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    ss += std::to_string(*it) + ", ";
+  }
+  return ss;
+}
+
+template <typename T, std::size_t B>
+void ExpectEqualToStd(const s21::unrolled_list<T, B> &l1,
+                      const std::list<T> &l2) {
+  ASSERT_EQ(l1.size(), l2.size());
+  auto it2 = l2.begin();
+  for (auto it1 = l1.begin(); it1 != l1.end(); ++it1, ++it2) {
+    EXPECT_EQ(*it1, *it2);
+  }
+}
+
+TEST(UnrolledListTest, Constructors) {
+  s21::unrolled_list<int> l1;
+  EXPECT_TRUE(l1.empty());
+  EXPECT_EQ(l1.size(), 0);
+  EXPECT_EQ(l1.begin(), l1.end());
+
+  s21::unrolled_list<int> l2(5);
+  EXPECT_EQ(ToString(l2), "0, 0, 0, 0, 0, ");
+
+  s21::unrolled_list<int, 4> l3 = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(ToString(l3), "1, 2, 3, 4, 5, 6, 7, 8, 9, ");
+
+  s21::unrolled_list<int, 4> l4(l3);
+  EXPECT_EQ(ToString(l4), ToString(l3));
+
+  s21::unrolled_list<int, 4> l5(std::move(l4));
+  EXPECT_EQ(ToString(l5), ToString(l3));
+  EXPECT_TRUE(l4.empty());
+  EXPECT_EQ(l4.begin(), l4.end());
+
+  l4 = l5;
+  EXPECT_EQ(ToString(l4), ToString(l3));
+  l1 = {7, 8};
+  EXPECT_EQ(ToString(l1), "7, 8, ");
+}
+
+TEST(UnrolledListTest, PushPopFrontBack) {
+  s21::unrolled_list<int, 4> l1;
+  std::list<int> l2;
+  for (int i = 0; i < 50; ++i) {
+    if (i % 3 == 0) {
+      l1.push_front(i);
+      l2.push_front(i);
+    } else {
+      l1.push_back(i);
+      l2.push_back(i);
+    }
+  }
+  ExpectEqualToStd(l1, l2);
+  EXPECT_EQ(l1.front(), l2.front());
+  EXPECT_EQ(l1.back(), l2.back());
+
+  while (!l2.empty()) {
+    if (l2.size() % 2) {
+      l1.pop_front();
+      l2.pop_front();
+    } else {
+      l1.pop_back();
+      l2.pop_back();
+    }
+    ExpectEqualToStd(l1, l2);
+  }
+  EXPECT_ANY_THROW(l1.pop_back());
+  EXPECT_ANY_THROW(l1.pop_front());
+  EXPECT_ANY_THROW(l1.front());
+}
+
+TEST(UnrolledListTest, InsertSplitsNodes) {
+  s21::unrolled_list<int, 4> l1 = {1, 2, 3, 4};
+  std::list<int> l2 = {1, 2, 3, 4};
+
+  auto it1 = l1.begin();
+  auto it2 = l2.begin();
+  ++it1;
+  ++it2;
+  for (int i = 0; i < 20; ++i) {
+    it1 = l1.insert(it1, 100 + i);
+    it2 = l2.insert(it2, 100 + i);
+    EXPECT_EQ(*it1, 100 + i);
+    ExpectEqualToStd(l1, l2);
+  }
+
+  auto res = l1.insert(l1.end(), 555);
+  EXPECT_EQ(*res, 555);
+  EXPECT_EQ(l1.back(), 555);
+}
+
+TEST(UnrolledListTest, EraseMergesNodes) {
+  s21::unrolled_list<int, 4> l1;
+  std::list<int> l2;
+  for (int i = 0; i < 40; ++i) {
+    l1.push_back(i);
+    l2.push_back(i);
+  }
+
+  // Удаляем каждый второй элемент, чтобы узлы опустели наполовину
+  int n = 0;
+  for (auto it = l2.begin(); it != l2.end(); ++n) {
+    if (n % 2) {
+      it = l2.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (int i = 1; i < 40; i += 2) {
+    auto it = l1.begin();
+    while (*it != i) ++it;
+    l1.erase(it);
+  }
+  ExpectEqualToStd(l1, l2);
+
+  EXPECT_ANY_THROW(l1.erase(l1.end()));
+  s21::unrolled_list<int> empty;
+  EXPECT_ANY_THROW(empty.erase(empty.begin()));
+}
+
+TEST(UnrolledListTest, IteratorBidirectional) {
+  s21::unrolled_list<int, 3> l1 = {1, 2, 3, 4, 5, 6, 7};
+  auto it = l1.end();
+  int expected = 7;
+  while (it != l1.begin()) {
+    --it;
+    EXPECT_EQ(*it, expected--);
+  }
+  EXPECT_EQ(expected, 0);
+  --it;
+  EXPECT_EQ(it, l1.end());
+  EXPECT_ANY_THROW(*it);
+
+  s21::unrolled_list<int, 3>::const_iterator cit = l1.begin();
+  EXPECT_EQ(*cit++, 1);
+  EXPECT_EQ(*cit, 2);
+}
+
+TEST(UnrolledListTest, Splice) {
+  s21::unrolled_list<int, 4> l1 = {1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> l2 = {100, 200, 300};
+  s21::unrolled_list<int, 4> l3;
+
+  auto pos = l1.begin();
+  ++pos;
+  ++pos;
+  l1.splice(pos, l2);
+  EXPECT_EQ(ToString(l1), "1, 2, 100, 200, 300, 3, 4, 5, 6, ");
+  EXPECT_EQ(l1.size(), 9);
+  EXPECT_TRUE(l2.empty());
+
+  l1.splice(l1.begin(), l3);
+  EXPECT_EQ(l1.size(), 9);
+
+  l3 = {7, 8};
+  l1.splice(l1.end(), l3);
+  EXPECT_EQ(ToString(l1), "1, 2, 100, 200, 300, 3, 4, 5, 6, 7, 8, ");
+}
+
+TEST(UnrolledListTest, MergeSortReverseUnique) {
+  s21::unrolled_list<int, 4> l1 = {1, 3, 5, 7, 9};
+  s21::unrolled_list<int, 4> l2 = {2, 3, 4, 10};
+  l1.merge(l2);
+  EXPECT_EQ(ToString(l1), "1, 2, 3, 3, 4, 5, 7, 9, 10, ");
+  EXPECT_TRUE(l2.empty());
+
+  l1.unique();
+  EXPECT_EQ(ToString(l1), "1, 2, 3, 4, 5, 7, 9, 10, ");
+
+  l1.reverse();
+  EXPECT_EQ(ToString(l1), "10, 9, 7, 5, 4, 3, 2, 1, ");
+
+  l1.push_back(8);
+  l1.sort();
+  EXPECT_EQ(ToString(l1), "1, 2, 3, 4, 5, 7, 8, 9, 10, ");
+
+  s21::unrolled_list<int> l3;
+  l3.sort();
+  l3.reverse();
+  l3.unique();
+  EXPECT_TRUE(l3.empty());
+}
+
+TEST(UnrolledListTest, InsertMany) {
+  s21::unrolled_list<int, 4> l1 = {1, 2, 3};
+  l1.insert_many(++l1.begin(), 10, 11, 12, 13, 14);
+  EXPECT_EQ(ToString(l1), "1, 10, 11, 12, 13, 14, 2, 3, ");
+
+  l1.insert_many_back(20, 21);
+  EXPECT_EQ(ToString(l1), "1, 10, 11, 12, 13, 14, 2, 3, 20, 21, ");
+
+  l1.insert_many_front(30, 31);
+  EXPECT_EQ(ToString(l1), "31, 30, 1, 10, 11, 12, 13, 14, 2, 3, 20, 21, ");
+}
+
+TEST(UnrolledListTest, NonTrivialType) {
+  s21::unrolled_list<std::string, 2> l1;
+  std::list<std::string> l2;
+  for (int i = 0; i < 10; ++i) {
+    std::string value(32, static_cast<char>('a' + i));
+    l1.push_back(value);
+    l2.push_back(value);
+  }
+  auto it = l1.begin();
+  ++it;
+  l1.insert(it, std::string("middle"));
+  l2.insert(++l2.begin(), "middle");
+  l1.erase(l1.begin());
+  l2.erase(l2.begin());
+
+  ASSERT_EQ(l1.size(), l2.size());
+  auto it2 = l2.begin();
+  for (auto &value : l1) {
+    EXPECT_EQ(value, *it2++);
+  }
+
+  l1.swap(l1);
+  l1.clear();
+  EXPECT_TRUE(l1.empty());
+}
+
+TEST(UnrolledListTest, MaxSize) {
+  s21::unrolled_list<int> l1;
+  EXPECT_GT(l1.max_size(), 0);
+}
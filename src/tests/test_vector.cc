@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -192,6 +193,21 @@ TEST(VectorTest, clear_function) {
   EXPECT_EQ(vectors21.size(), vectorstd.size());
 }
 
+TEST(VectorTest, clear_keeps_buffer) {
+  s21::vector<std::string> vectors21{"a", "b", "c"};
+  size_t capacity = vectors21.capacity();
+  vectors21.clear();
+  EXPECT_EQ(vectors21.size(), 0U);
+  EXPECT_EQ(vectors21.capacity(), capacity);
+  vectors21.push_back("d");
+  EXPECT_EQ(vectors21[0], "d");
+  // T() у s21::vector не noexcept, поэтому и clear() вектора векторов тоже
+  s21::vector<int> ints;
+  s21::vector<s21::vector<int>> nested;
+  EXPECT_TRUE(noexcept(ints.clear()));
+  EXPECT_FALSE(noexcept(nested.clear()));
+}
+
 TEST(VectorTest, iterator_0) {
   s21::vector<int> vectors21{1, 2, 3, 4, 5};
   std::vector<int> vectorstd{1, 2, 3, 4, 5};
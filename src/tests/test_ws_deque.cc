@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../headers/s21_ws_deque.h"
+#include "../headers/s21_ws_scheduler.h"
+
+TEST(WsDequeTest, OwnerIsLifoThiefIsFifo) {
+  s21::ws_deque<int> d1(2);
+  int value = 0;
+  EXPECT_TRUE(d1.empty());
+  EXPECT_FALSE(d1.pop(value));
+  EXPECT_FALSE(d1.steal(value));
+
+  for (int i = 0; i < 10; ++i) d1.push(i);
+  EXPECT_EQ(d1.size_approx(), 10);
+  EXPECT_GE(d1.capacity(), 10);
+
+  EXPECT_TRUE(d1.pop(value));
+  EXPECT_EQ(value, 9);
+  EXPECT_TRUE(d1.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(d1.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(d1.size_approx(), 7);
+
+  for (int i = 8; i >= 2; --i) {
+    EXPECT_TRUE(d1.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(d1.pop(value));
+  EXPECT_TRUE(d1.empty());
+
+  EXPECT_ANY_THROW(s21::ws_deque<int> d2(3));
+}
+
+TEST(WsDequeTest, OwnerAndThievesTakeEachElementOnce) {
+  const int kItems = 50000;
+  const int kThieves = 3;
+  s21::ws_deque<int> d1(4);
+  std::vector<std::atomic<int>> taken(kItems);
+  for (auto &t : taken) t.store(0);
+
+  std::atomic<bool> done(false);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&d1, &taken, &done] {
+      int value = 0;
+      while (!done.load()) {
+        if (d1.steal(value)) ++taken[value];
+      }
+      while (d1.steal(value)) ++taken[value];
+    });
+  }
+  // Неудачный pop() (в том числе проигранная ворам гонка за последний
+  // элемент) не должен менять value
+  bool clobbered = false;
+  auto owner_pop = [&d1, &taken, &clobbered] {
+    int value = -1;
+    if (d1.pop(value)) {
+      ++taken[value];
+      return true;
+    }
+    clobbered |= value != -1;
+    return false;
+  };
+  for (int i = 0; i < kItems; ++i) {
+    d1.push(i);
+    if (i % 3 == 0) owner_pop();
+  }
+  while (owner_pop()) {
+  }
+  done.store(true);
+  for (auto &thread : thieves) thread.join();
+
+  EXPECT_FALSE(clobbered);
+
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(taken[i].load(), 1) << i;
+  }
+}
+
+namespace {
+long long SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+
+long long ParallelFib(s21::ws_scheduler &scheduler, int n) {
+  if (n < 12) return SerialFib(n);
+  long long a = 0;
+  s21::ws_scheduler::task_group group(scheduler);
+  group.run([&scheduler, &a, n] { a = ParallelFib(scheduler, n - 1); });
+  long long b = ParallelFib(scheduler, n - 2);
+  group.wait();
+  return a + b;
+}
+}  // namespace
+
+TEST(WsSchedulerTest, ForkJoin) {
+  s21::ws_scheduler scheduler(4);
+  EXPECT_EQ(scheduler.concurrency(), 4);
+  EXPECT_EQ(ParallelFib(scheduler, 22), SerialFib(22));
+
+  std::atomic<int> counter(0);
+  s21::ws_scheduler::task_group group(scheduler);
+  for (int i = 0; i < 1000; ++i) {
+    group.run([&counter] { ++counter; });
+  }
+  group.wait();
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(WsSchedulerTest, ExceptionIsRethrownByWait) {
+  s21::ws_scheduler scheduler(2);
+  std::atomic<int> counter(0);
+  s21::ws_scheduler::task_group group(scheduler);
+  group.run([] { throw std::runtime_error("task failed"); });
+  for (int i = 0; i < 10; ++i) {
+    group.run([&counter] { ++counter; });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(counter.load(), 10);
+  // Исключение забирается один раз
+  EXPECT_NO_THROW(group.wait());
+}